@@ -572,6 +572,45 @@ static JRESULT restart (
 
 
 
+#if JD_FASTDECODE >= 1
+/*-----------------------------------------------------------------------*/
+/* Skip the rest of a restart interval without decoding it               */
+/*-----------------------------------------------------------------------*/
+
+static JRESULT skip_interval (
+	JDEC* jd		/* Pointer to the decompressor object */
+)
+{
+	uint8_t *dp = jd->dptr;
+	size_t dc = jd->dctr;
+	unsigned int d, flg = 0;
+
+
+	while (!jd->marker) {	/* Scan the stream for the marker that ends the interval */
+		if (!dc) {	/* Buffer empty, re-fill input buffer */
+			dp = jd->inbuf;
+			dc = jd->infunc(jd, dp, JD_SZBUF);
+			if (!dc) return JDR_INP;
+		}
+		d = *dp++; dc--;
+		if (flg) {
+			if (d != 0xFF) {	/* 0xFF 0xFF is fill, 0xFF 0x00 is an escaped 0xFF */
+				flg = 0;
+				if (d != 0) jd->marker = d;
+			}
+		} else if (d == 0xFF) {
+			flg = 1;
+		}
+	}
+	jd->dptr = dp; jd->dctr = dc;
+	jd->dbit = 0;			/* Discard the bits read ahead */
+	return JDR_OK;
+}
+#endif
+
+
+
+
 /*-----------------------------------------------------------------------*/
 /* Apply Inverse-DCT in Arai Algorithm (see also aa_idct.png)            */
 /*-----------------------------------------------------------------------*/
@@ -700,7 +739,8 @@ static void block_idct (
 /*-----------------------------------------------------------------------*/
 
 static JRESULT mcu_load (
-	JDEC* jd		/* Pointer to the decompressor object */
+	JDEC* jd,		/* Pointer to the decompressor object */
+	int skip		/* Only decode the huffman coded stream, for an MCU that is not output */
 )
 {
 	int32_t *tmp = (int32_t*)jd->workbuf;	/* Block working buffer for de-quantize and IDCT */
@@ -735,6 +775,23 @@ static JRESULT mcu_load (
 				d += e;								/* Get current value */
 				jd->dcv[cmp] = (int16_t)d;			/* Save current DC value for next block */
 			}
+			if (skip) {								/* Step over the AC elements without storing them */
+				z = 1;
+				do {
+					d = huffext(jd, id, 1);
+					if (d == 0) break;
+					if (d < 0) return (JRESULT)(0 - d);
+					bc = (unsigned int)d;
+					z += bc >> 4;
+					if (z >= 64) return JDR_FMT1;
+					if (bc &= 0x0F) {
+						d = bitext(jd, bc);
+						if (d < 0) return (JRESULT)(0 - d);
+					}
+				} while (++z < 64);
+				bp += 64;
+				continue;
+			}
 			dqf = jd->qttbl[jd->qtid[cmp]];			/* De-quantizer table ID for this component */
 			tmp[0] = d * dqf[0] >> 8;				/* De-quantize, apply scale factor of Arai algorithm and descale 8 bits */
 
@@ -789,7 +846,8 @@ static JRESULT mcu_output (
 	JDEC* jd,			/* Pointer to the decompressor object */
 	int (*outfunc)(JDEC*, void*, JRECT*),	/* RGB output function */
 	unsigned int x,		/* MCU location in the image */
-	unsigned int y		/* MCU location in the image */
+	unsigned int y,		/* MCU location in the image */
+	int yuv				/* Pass the Y/Cb/Cr blocks to outfunc instead of RGB pixels */
 )
 {
 	const int CVACC = (sizeof (int) > 2) ? 1024 : 128;	/* Adaptive accuracy for both 16-/32-bit systems */
@@ -811,6 +869,9 @@ static JRESULT mcu_output (
 	rect.left = x; rect.right = x + rx - 1;				/* Rectangular area in the frame buffer */
 	rect.top = y; rect.bottom = y + ry - 1;
 
+	if (yuv) {	/* The output function converts the MCU itself */
+		return outfunc(jd, jd->mcubuf, &rect) ? JDR_OK : JDR_INTR;
+	}
 
 	if (!JD_USE_SCALE || jd->scale != 3) {	/* Not for 1/8 scaling */
 		pix = (uint8_t*)jd->workbuf;
@@ -1125,8 +1186,27 @@ JRESULT jd_decomp (
 	uint8_t scale							/* Output de-scaling factor (0 to 3) */
 )
 {
-	unsigned int x, y, mx, my;
-	uint16_t rst, rsc;
+	return jd_decomp_rect(jd, outfunc, scale, 0, 0);
+}
+
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Decompress the part of the JPEG picture in a rectangle                */
+/*-----------------------------------------------------------------------*/
+
+JRESULT jd_decomp_rect (
+	JDEC* jd,								/* Initialized decompression object */
+	int (*outfunc)(JDEC*, void*, JRECT*),	/* RGB output function */
+	uint8_t scale,							/* Output de-scaling factor (0 to 3) */
+	const JRECT* roi,						/* Area of the input image to output (null pointer for all) */
+	int yuv									/* Pass the Y/Cb/Cr blocks to outfunc instead of RGB pixels */
+)
+{
+	unsigned int x, y, mx, my, nx, n, end, i, x0, x1, y0, y1;
+	uint16_t rsc;
+	int use;
 	JRESULT rc;
 
 
@@ -1134,21 +1214,49 @@ JRESULT jd_decomp (
 	jd->scale = scale;
 
 	mx = jd->msx * 8; my = jd->msy * 8;			/* Size of the MCU (pixel) */
+	nx = (jd->width + mx - 1) / mx;				/* Number of MCUs in a row */
+	x0 = y0 = 0;								/* Range of MCUs to output */
+	x1 = nx - 1; y1 = (jd->height + my - 1) / my - 1;
+	if (roi) {
+		x0 = roi->left / mx; y0 = roi->top / my;
+		if (roi->right / mx < x1) x1 = roi->right / mx;
+		if (roi->bottom / my < y1) y1 = roi->bottom / my;
+		if (x0 > x1 || y0 > y1) return JDR_OK;
+	}
+	end = (y1 + 1) * nx;						/* MCUs after the last row to output are not decoded */
 
 	jd->dcv[2] = jd->dcv[1] = jd->dcv[0] = 0;	/* Initialize DC values */
-	rst = rsc = 0;
+	rsc = 0;
 
 	rc = JDR_OK;
-	for (y = 0; y < jd->height; y += my) {		/* Vertical loop of MCUs */
-		for (x = 0; x < jd->width; x += mx) {	/* Horizontal loop of MCUs */
-			if (jd->nrst && rst++ == jd->nrst) {	/* Process restart interval if enabled */
+	for (n = 0; n < end; n++) {					/* Raster order loop of MCUs */
+		if (jd->nrst && n % jd->nrst == 0) {	/* Process restart interval if enabled */
+			if (n) {
 				rc = restart(jd, rsc++);
 				if (rc != JDR_OK) return rc;
-				rst = 1;
 			}
-			rc = mcu_load(jd);					/* Load an MCU (decompress huffman coded stream, dequantize and apply IDCT) */
-			if (rc != JDR_OK) return rc;
-			rc = mcu_output(jd, outfunc, x, y);	/* Output the MCU (YCbCr to RGB, scaling and output) */
+#if JD_FASTDECODE >= 1
+			if (roi) {	/* Skip the whole interval if none of it is output */
+				for (i = n; i < n + jd->nrst && i < end; i++) {
+					x = i % nx; y = i / nx;
+					if (x >= x0 && x <= x1 && y >= y0) break;
+				}
+				if (i == end) break;			/* Nothing more to output */
+				if (i == n + jd->nrst) {
+					rc = skip_interval(jd);
+					if (rc != JDR_OK) return rc;
+					n += jd->nrst - 1;
+					continue;
+				}
+			}
+#endif
+		}
+		x = n % nx; y = n / nx;
+		use = x >= x0 && x <= x1 && y >= y0;
+		rc = mcu_load(jd, !use);				/* Load an MCU (decompress huffman coded stream, dequantize and apply IDCT) */
+		if (rc != JDR_OK) return rc;
+		if (use) {
+			rc = mcu_output(jd, outfunc, x * mx, y * my, yuv);	/* Output the MCU (YCbCr to RGB, scaling and output) */
 			if (rc != JDR_OK) return rc;
 		}
 	}
@@ -207,6 +207,11 @@ void common_hal_dotclockframebuffer_framebuffer_refresh(dotclockframebuffer_fram
     Cache_WriteBack_Addr((uint32_t)(self->bufinfo.buf), self->bufinfo.len);
 }
 
+void common_hal_dotclockframebuffer_framebuffer_refresh_span(dotclockframebuffer_framebuffer_obj_t *self, int y, int x1, int x2) {
+    uint8_t *row = (uint8_t *)self->bufinfo.buf + self->first_pixel_offset + y * self->row_stride;
+    Cache_WriteBack_Addr((uint32_t)(row + x1 * sizeof(uint16_t)), (x2 - x1) * sizeof(uint16_t));
+}
+
 mp_int_t common_hal_dotclockframebuffer_framebuffer_get_refresh_rate(dotclockframebuffer_framebuffer_obj_t *self) {
     return self->refresh_rate;
 }
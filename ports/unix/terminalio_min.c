@@ -0,0 +1,45 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "py/obj.h"
+
+#include "shared-bindings/displayio/Bitmap.h"
+#include "shared-bindings/fontio/BuiltinFont.h"
+#include "supervisor/shared/display.h"
+
+// Boards get terminalio.FONT from tools/gen_display_resources.py. Here the glyphs are blank,
+// which is enough to check which tiles a Terminal writes: printable ASCII and then these
+// characters, in this order.
+
+#define FONT_WIDTH (6)
+#define FONT_HEIGHT (12)
+#define FONT_UNICODE "°±²³µ·×÷ßàáâäçèéêëíîïñóôöøúüĀāČčĚěŌōŠšŽžΩπ‘’“”•…€™←↑→↓"
+#define FONT_GLYPHS (0x7f - 0x20 + 54)
+#define FONT_STRIDE ((FONT_GLYPHS * FONT_WIDTH + 31) / 32)
+
+static uint32_t font_bitmap_data[FONT_STRIDE * FONT_HEIGHT];
+
+displayio_bitmap_t supervisor_terminal_font_bitmap = {
+    .base = {.type = &displayio_bitmap_type },
+    .width = FONT_GLYPHS * FONT_WIDTH,
+    .height = FONT_HEIGHT,
+    .data = font_bitmap_data,
+    .stride = FONT_STRIDE,
+    .bits_per_value = 1,
+    .x_shift = 5,
+    .x_mask = 0x1f,
+    .bitmask = 0x01,
+    .read_only = true
+};
+
+const fontio_builtinfont_t supervisor_terminal_font = {
+    .base = {.type = &fontio_builtinfont_type },
+    .bitmap = &supervisor_terminal_font_bitmap,
+    .width = FONT_WIDTH,
+    .height = FONT_HEIGHT,
+    .unicode_characters = (const uint8_t *)FONT_UNICODE,
+    .unicode_characters_len = sizeof(FONT_UNICODE) - 1
+};
@@ -27,10 +27,13 @@ $(BUILD)/lib/tjpgd/src/tjpgd.o: CFLAGS += -Wno-shadow -Wno-cast-align
 SRC_BITMAP := \
 	shared/runtime/context_manager_helpers.c \
 	displayio_min.c \
+	terminalio_min.c \
 	shared-bindings/__future__/__init__.c \
 	shared-bindings/aesio/aes.c \
 	shared-bindings/aesio/__init__.c \
 	shared-bindings/audiocore/__init__.c \
+	shared-bindings/audiocore/Graph.c \
+	shared-bindings/audiocore/GraphNode.c \
 	shared-bindings/audiocore/RawSample.c \
 	shared-bindings/audiocore/WaveFile.c \
 	shared-bindings/audiomixer/__init__.c \
@@ -43,8 +46,16 @@ SRC_BITMAP := \
 	shared-bindings/codeop/__init__.c \
 	shared-bindings/displayio/Bitmap.c \
 	shared-bindings/displayio/ColorConverter.c \
+	shared-bindings/displayio/OnDiskBitmap.c \
 	shared-bindings/displayio/Palette.c \
+	shared-bindings/displayio/TileGrid.c \
 	shared-bindings/floppyio/__init__.c \
+	shared-bindings/fontio/__init__.c \
+	shared-bindings/fontio/BuiltinFont.c \
+	shared-bindings/fontio/Glyph.c \
+	shared-bindings/gifio/__init__.c \
+	shared-bindings/gifio/GifWriter.c \
+	shared-bindings/gifio/OnDiskGif.c \
 	shared-bindings/jpegio/__init__.c \
 	shared-bindings/jpegio/JpegDecoder.c \
 	shared-bindings/locale/__init__.c \
@@ -56,13 +67,19 @@ SRC_BITMAP := \
 	shared-bindings/synthio/LFO.c \
 	shared-bindings/synthio/Note.c \
 	shared-bindings/synthio/Biquad.c \
+	shared-bindings/synthio/BlockBiquad.c \
 	shared-bindings/synthio/Synthesizer.c \
+	shared-bindings/synthio/Wavetable.c \
+	shared-bindings/terminalio/__init__.c \
+	shared-bindings/terminalio/Terminal.c \
 	shared-bindings/traceback/__init__.c \
 	shared-bindings/util.c \
+	shared-bindings/zlib/Decompress.c \
 	shared-bindings/zlib/__init__.c \
 	shared-module/aesio/aes.c \
 	shared-module/aesio/__init__.c \
 	shared-module/audiocore/__init__.c \
+	shared-module/audiocore/Graph.c \
 	shared-module/audiocore/RawSample.c \
 	shared-module/audiocore/WaveFile.c \
 	shared-module/audiomixer/__init__.c \
@@ -74,8 +91,14 @@ SRC_BITMAP := \
 	shared-module/displayio/area.c \
 	shared-module/displayio/Bitmap.c \
 	shared-module/displayio/ColorConverter.c \
+	shared-module/displayio/OnDiskBitmap.c \
 	shared-module/displayio/Palette.c \
+	shared-module/displayio/TileGrid.c \
 	shared-module/floppyio/__init__.c \
+	shared-module/fontio/__init__.c \
+	shared-module/fontio/BuiltinFont.c \
+	shared-module/gifio/GifWriter.c \
+	shared-module/gifio/OnDiskGif.c \
 	shared-module/jpegio/__init__.c \
 	shared-module/jpegio/JpegDecoder.c \
 	shared-module/os/getenv.c \
@@ -87,12 +110,25 @@ SRC_BITMAP := \
 	shared-module/synthio/LFO.c \
 	shared-module/synthio/Note.c \
 	shared-module/synthio/Biquad.c \
+	shared-module/synthio/BlockBiquad.c \
 	shared-module/synthio/Synthesizer.c \
+	shared-module/synthio/Wavetable.c \
+	shared-module/terminalio/__init__.c \
+	shared-module/terminalio/Terminal.c \
 	shared-module/traceback/__init__.c \
+	shared-module/zlib/Decompress.c \
 	shared-module/zlib/__init__.c \
 
 SRC_C += $(SRC_BITMAP)
 
+# OnDiskBitmap and OnDiskGif read files on a FAT filesystem, such as a VfsFat mounted on a RAM
+# block device
+$(BUILD)/shared-bindings/displayio/OnDiskBitmap.o: CFLAGS += -Dmp_type_fileio=mp_type_vfs_fat_fileio
+$(BUILD)/shared-bindings/gifio/OnDiskGif.o: CFLAGS += -Dmp_type_fileio=mp_type_vfs_fat_fileio
+
+SRC_C += lib/AnimatedGIF/gif.c
+$(BUILD)/lib/AnimatedGIF/gif.o: CFLAGS += -DCIRCUITPY
+
 SRC_C += $(addprefix lib/mp3/src/, \
         bitstream.c \
         buffers.c \
@@ -124,6 +160,7 @@ CFLAGS += \
 	-DCIRCUITPY_CODEOP=1 \
 	-DCIRCUITPY_DISPLAYIO_UNIX=1 \
 	-DCIRCUITPY_FLOPPYIO=1 \
+	-DCIRCUITPY_FONTIO=1 \
 	-DCIRCUITPY_FUTURE=1 \
 	-DCIRCUITPY_GIFIO=1 \
 	-DCIRCUITPY_JPEGIO=1 \
@@ -133,6 +170,7 @@ CFLAGS += \
 	-DCIRCUITPY_STRUCT=1 \
 	-DCIRCUITPY_SYNTHIO=1 \
 	-DCIRCUITPY_SYNTHIO_MAX_CHANNELS=14 \
+	-DCIRCUITPY_TERMINALIO=1 \
 	-DCIRCUITPY_TRACEBACK=1 \
 	-DCIRCUITPY_ZLIB=1
 
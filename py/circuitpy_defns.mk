@@ -614,6 +614,7 @@ SRC_SHARED_MODULE_ALL = \
 	aesio/__init__.c \
 	aesio/aes.c \
 	atexit/__init__.c \
+	audiocore/Graph.c \
 	audiocore/RawSample.c \
 	audiocore/WaveFile.c \
 	audiocore/__init__.c \
@@ -707,11 +708,13 @@ SRC_SHARED_MODULE_ALL = \
 	supervisor/__init__.c \
 	supervisor/StatusBar.c \
 	synthio/Biquad.c \
+	synthio/BlockBiquad.c \
 	synthio/LFO.c \
 	synthio/Math.c \
 	synthio/MidiTrack.c \
 	synthio/Note.c \
 	synthio/Synthesizer.c \
+	synthio/Wavetable.c \
 	synthio/__init__.c \
 	terminalio/Terminal.c \
 	terminalio/__init__.c \
@@ -729,6 +732,7 @@ SRC_SHARED_MODULE_ALL = \
 	vectorio/__init__.c \
 	warnings/__init__.c \
 	watchdog/__init__.c \
+	zlib/Decompress.c \
 	zlib/__init__.c \
 
 # All possible sources are listed here, and are filtered by SRC_PATTERNS.
@@ -811,6 +815,7 @@ endif
 
 ifeq ($(CIRCUITPY_HASHLIB_MBEDTLS_ONLY),1)
 SRC_MOD += $(addprefix lib/mbedtls/library/, \
+        md5.c \
         sha1.c \
         sha256.c \
         sha512.c \
@@ -23,8 +23,10 @@ void common_hal_aesio_aes_rekey(aesio_aes_obj_t *self,
 void common_hal_aesio_aes_set_mode(aesio_aes_obj_t *self,
     int mode);
 void common_hal_aesio_aes_encrypt(aesio_aes_obj_t *self,
-    uint8_t *buffer,
+    const uint8_t *src,
+    uint8_t *dest,
     size_t len);
 void common_hal_aesio_aes_decrypt(aesio_aes_obj_t *self,
-    uint8_t *buffer,
+    const uint8_t *src,
+    uint8_t *dest,
     size_t len);
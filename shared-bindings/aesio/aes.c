@@ -170,12 +170,29 @@ static void validate_length(aesio_aes_obj_t *self, size_t src_length,
     }
 }
 
+// The cipher reads each block before writing it, so it can work in place, but buffers that
+// partly overlap, such as two slices of one bytearray, are copied first and then done in place.
+static const uint8_t *prepare_src(const mp_buffer_info_t *src, const mp_buffer_info_t *dest) {
+    const uint8_t *s = src->buf;
+    uint8_t *d = dest->buf;
+    if (s != d && s < d + dest->len && d < s + src->len) {
+        memmove(d, s, src->len);
+        return d;
+    }
+    return s;
+}
+
 //|     def encrypt_into(self, src: ReadableBuffer, dest: WriteableBuffer) -> None:
 //|         """Encrypt the buffer from ``src`` into ``dest``.
 //|
 //|         For ECB mode, the buffers must be 16 bytes long.  For CBC mode, the
 //|         buffers must be a multiple of 16 bytes, and must be equal length.  For
-//|         CTR mode, there are no restrictions."""
+//|         CTR mode, there are no restrictions.
+//|
+//|         ``src`` and ``dest`` may be the same buffer, to encrypt in place, and either may be a
+//|         `memoryview` slice, so that part of a larger buffer is encrypted without copying it.
+//|         CBC mode, and CTR mode given whole 16-byte blocks, continue from where the previous
+//|         call left off."""
 //|         ...
 static mp_obj_t aesio_aes_encrypt_into(mp_obj_t self_in, mp_obj_t src, mp_obj_t dest) {
     aesio_aes_obj_t *self = MP_OBJ_TO_PTR(self_in);
@@ -185,9 +202,7 @@ static mp_obj_t aesio_aes_encrypt_into(mp_obj_t self_in, mp_obj_t src, mp_obj_t
     mp_get_buffer_raise(dest, &destbufinfo, MP_BUFFER_WRITE);
     validate_length(self, srcbufinfo.len, destbufinfo.len);
 
-    memcpy(destbufinfo.buf, srcbufinfo.buf, srcbufinfo.len);
-
-    common_hal_aesio_aes_encrypt(self, (uint8_t *)destbufinfo.buf, destbufinfo.len);
+    common_hal_aesio_aes_encrypt(self, prepare_src(&srcbufinfo, &destbufinfo), destbufinfo.buf, destbufinfo.len);
     return mp_const_none;
 }
 
@@ -197,7 +212,9 @@ static MP_DEFINE_CONST_FUN_OBJ_3(aesio_aes_encrypt_into_obj, aesio_aes_encrypt_i
 //|         """Decrypt the buffer from ``src`` into ``dest``.
 //|         For ECB mode, the buffers must be 16 bytes long.  For CBC mode, the
 //|         buffers must be a multiple of 16 bytes, and must be equal length.  For
-//|         CTR mode, there are no restrictions."""
+//|         CTR mode, there are no restrictions.
+//|
+//|         As for `encrypt_into`, the buffers may be the same, or slices of larger buffers."""
 //|         ...
 //|
 static mp_obj_t aesio_aes_decrypt_into(mp_obj_t self_in, mp_obj_t src, mp_obj_t dest) {
@@ -208,9 +225,7 @@ static mp_obj_t aesio_aes_decrypt_into(mp_obj_t self_in, mp_obj_t src, mp_obj_t
     mp_get_buffer_raise(dest, &destbufinfo, MP_BUFFER_WRITE);
     validate_length(self, srcbufinfo.len, destbufinfo.len);
 
-    memcpy(destbufinfo.buf, srcbufinfo.buf, srcbufinfo.len);
-
-    common_hal_aesio_aes_decrypt(self, (uint8_t *)destbufinfo.buf, destbufinfo.len);
+    common_hal_aesio_aes_decrypt(self, prepare_src(&srcbufinfo, &destbufinfo), destbufinfo.buf, destbufinfo.len);
     return mp_const_none;
 }
 
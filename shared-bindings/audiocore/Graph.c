@@ -0,0 +1,281 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <stdint.h>
+
+#include "shared/runtime/context_manager_helpers.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/util.h"
+#include "shared-bindings/audiocore/Graph.h"
+#include "shared-bindings/audiocore/GraphNode.h"
+
+//| class Graph:
+//|     """A chain of audio sources and processing nodes, played as a single sample
+//|
+//|     Each time the graph is played from, every node that feeds its `output` runs once, in
+//|     order, on a block of ``block_size`` frames. Nodes hand their output to the next node
+//|     without copying it where they can, and share a small pool of buffers: a buffer is
+//|     reused as soon as the last node that reads it has run. All nodes work on signed 16-bit
+//|     samples in the graph's sample rate and channel count.
+//|
+//|     Playing two samples, one of them quieter, through a graph::
+//|
+//|           import audiocore
+//|           import audiopwmio
+//|           import board
+//|
+//|           graph = audiocore.Graph(sample_rate=22050, channel_count=2)
+//|           music = graph.source(audiocore.WaveFile("music.wav"), loop=True)
+//|           voice = graph.source(audiocore.WaveFile("voice.wav"))
+//|           graph.output = graph.mix((graph.gain(music, 0.5), voice))
+//|
+//|           a = audiopwmio.PWMAudioOut(board.A0, right_channel=board.A1)
+//|           a.play(graph)
+//|           while a.playing:
+//|               pass"""
+//|
+//|     def __init__(
+//|         self, *, sample_rate: int = 8000, channel_count: int = 1, block_size: int = 256
+//|     ) -> None:
+//|         """Create an empty graph. It plays silence until `output` is set.
+//|
+//|         :param int sample_rate: The sample rate of the graph, in Hz
+//|         :param int channel_count: The number of channels, 1 or 2
+//|         :param int block_size: The number of frames processed at a time. Larger blocks
+//|             cost more memory for each buffer, smaller ones more time for each block."""
+//|         ...
+static mp_obj_t audiocore_graph_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_sample_rate, ARG_channel_count, ARG_block_size };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_sample_rate, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 8000} },
+        { MP_QSTR_channel_count, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1} },
+        { MP_QSTR_block_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 256} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_int_t sample_rate = mp_arg_validate_int_min(args[ARG_sample_rate].u_int, 1, MP_QSTR_sample_rate);
+    mp_int_t channel_count = mp_arg_validate_int_range(args[ARG_channel_count].u_int, 1, 2, MP_QSTR_channel_count);
+    mp_int_t block_size = mp_arg_validate_int_range(args[ARG_block_size].u_int, 16, 4096, MP_QSTR_block_size);
+
+    audiocore_graph_obj_t *self = mp_obj_malloc(audiocore_graph_obj_t, &audiocore_graph_type);
+    common_hal_audiocore_graph_construct(self, sample_rate, channel_count, block_size);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def deinit(self) -> None:
+//|         """Deinitialises the Graph and releases its buffers."""
+//|         ...
+static mp_obj_t audiocore_graph_deinit(mp_obj_t self_in) {
+    audiocore_graph_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_audiocore_graph_deinit(self);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(audiocore_graph_deinit_obj, audiocore_graph_deinit);
+
+static void check_for_deinit(audiocore_graph_obj_t *self) {
+    if (common_hal_audiocore_graph_deinited(self)) {
+        raise_deinited_error();
+    }
+}
+
+//|     def __enter__(self) -> Graph:
+//|         """No-op used by Context Managers."""
+//|         ...
+//  Provided by context manager helper.
+
+//|     def __exit__(self) -> None:
+//|         """Automatically deinitializes the graph when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+static mp_obj_t audiocore_graph_obj___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    common_hal_audiocore_graph_deinit(args[0]);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(audiocore_graph___exit___obj, 4, 4, audiocore_graph_obj___exit__);
+
+static mp_float_t validate_level(mp_obj_t level_in) {
+    return mp_arg_validate_obj_float_range(level_in, 0, 1, MP_QSTR_level);
+}
+
+//|     def source(
+//|         self, sample: circuitpython_typing.AudioSample, *, loop: bool = False, level: float = 1.0
+//|     ) -> GraphNode:
+//|         """Make a node that plays a sample, once when ``loop=False`` and continuously when
+//|         ``loop=True``. After it ends, it produces silence.
+//|
+//|         A sample that already has the graph's sample rate and channel count and is signed
+//|         16-bit is read straight from its own buffers. Any other sample is converted as it
+//|         plays, which takes more time.
+//|
+//|         The sample can be another `Graph`, but not this one or a graph that plays this one.
+//|
+//|         :param circuitpython_typing.AudioSample sample: The sample to play
+//|         :param bool loop: Whether to start the sample over when it ends
+//|         :param float level: The volume of the sample, from 0 to 1"""
+//|         ...
+static mp_obj_t audiocore_graph_obj_source(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_sample, ARG_loop, ARG_level };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_sample, MP_ARG_OBJ | MP_ARG_REQUIRED, {} },
+        { MP_QSTR_loop, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
+        { MP_QSTR_level, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_INT(1)} },
+    };
+    audiocore_graph_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t sample = args[ARG_sample].u_obj;
+    mp_proto_get_or_throw(MP_QSTR_protocol_audiosample, sample);
+    mp_float_t level = validate_level(args[ARG_level].u_obj);
+    return MP_OBJ_FROM_PTR(common_hal_audiocore_graph_new_source(self, sample, args[ARG_loop].u_bool, level));
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(audiocore_graph_source_obj, 1, audiocore_graph_obj_source);
+
+//|     def gain(self, input: GraphNode, level: float = 1.0) -> GraphNode:
+//|         """Make a node that changes the volume of another node's output.
+//|
+//|         When it is the only node reading ``input``, it works in place in ``input``'s buffer.
+//|
+//|         :param GraphNode input: The node to read from
+//|         :param float level: The volume, from 0 to 1"""
+//|         ...
+static mp_obj_t audiocore_graph_obj_gain(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_input, ARG_level };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_input, MP_ARG_OBJ | MP_ARG_REQUIRED, {} },
+        { MP_QSTR_level, MP_ARG_OBJ, {.u_obj = MP_ROM_INT(1)} },
+    };
+    audiocore_graph_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_float_t level = validate_level(args[ARG_level].u_obj);
+    return MP_OBJ_FROM_PTR(common_hal_audiocore_graph_new_gain(self, args[ARG_input].u_obj, level));
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(audiocore_graph_gain_obj, 1, audiocore_graph_obj_gain);
+
+//|     def mix(self, inputs: Sequence[GraphNode], *, level: float = 1.0) -> GraphNode:
+//|         """Make a node that adds up the output of other nodes. The sum is limited to the range
+//|         of a 16-bit sample, so lower the level of the inputs to avoid clipping.
+//|
+//|         :param Sequence[GraphNode] inputs: The nodes to add up
+//|         :param float level: The volume of the sum, from 0 to 1"""
+//|         ...
+static mp_obj_t audiocore_graph_obj_mix(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_inputs, ARG_level };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_inputs, MP_ARG_OBJ | MP_ARG_REQUIRED, {} },
+        { MP_QSTR_level, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_INT(1)} },
+    };
+    audiocore_graph_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_float_t level = validate_level(args[ARG_level].u_obj);
+    size_t n_inputs;
+    mp_obj_t *inputs;
+    mp_obj_get_array(args[ARG_inputs].u_obj, &n_inputs, &inputs);
+    return MP_OBJ_FROM_PTR(common_hal_audiocore_graph_new_mix(self, n_inputs, inputs, level));
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(audiocore_graph_mix_obj, 1, audiocore_graph_obj_mix);
+
+//|     output: Optional[GraphNode]
+//|     """The node whose output the graph plays. Only the nodes that feed it are processed.
+//|
+//|     Setting it works out the order to run the nodes in and which buffers they use, which
+//|     may allocate memory. `None` makes the graph play silence."""
+static mp_obj_t audiocore_graph_obj_get_output(mp_obj_t self_in) {
+    audiocore_graph_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return common_hal_audiocore_graph_get_output(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiocore_graph_get_output_obj, audiocore_graph_obj_get_output);
+
+static mp_obj_t audiocore_graph_obj_set_output(mp_obj_t self_in, mp_obj_t output_in) {
+    audiocore_graph_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    audiocore_graph_node_obj_t *output = NULL;
+    if (output_in != mp_const_none) {
+        output = MP_OBJ_TO_PTR(mp_arg_validate_type(output_in, &audiocore_graph_node_type, MP_QSTR_output));
+        if (output->graph != self) {
+            mp_raise_ValueError(MP_ERROR_TEXT("Node belongs to a different graph"));
+        }
+    }
+    common_hal_audiocore_graph_set_output(self, output);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiocore_graph_set_output_obj, audiocore_graph_obj_set_output);
+
+MP_PROPERTY_GETSET(audiocore_graph_output_obj,
+    (mp_obj_t)&audiocore_graph_get_output_obj,
+    (mp_obj_t)&audiocore_graph_set_output_obj);
+
+//|     buffer_count: int
+//|     """The number of block buffers the nodes share, not counting the two that hold the
+//|     graph's output. (read-only)"""
+static mp_obj_t audiocore_graph_obj_get_buffer_count(mp_obj_t self_in) {
+    audiocore_graph_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_audiocore_graph_get_buffer_count(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiocore_graph_get_buffer_count_obj, audiocore_graph_obj_get_buffer_count);
+
+MP_PROPERTY_GETTER(audiocore_graph_buffer_count_obj,
+    (mp_obj_t)&audiocore_graph_get_buffer_count_obj);
+
+//|     sample_rate: int
+//|     """32 bit value that dictates how quickly samples are played in Hertz (cycles per second). (read-only)"""
+//|
+static mp_obj_t audiocore_graph_obj_get_sample_rate(mp_obj_t self_in) {
+    audiocore_graph_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_audiocore_graph_get_sample_rate(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiocore_graph_get_sample_rate_obj, audiocore_graph_obj_get_sample_rate);
+
+MP_PROPERTY_GETTER(audiocore_graph_sample_rate_obj,
+    (mp_obj_t)&audiocore_graph_get_sample_rate_obj);
+
+static const mp_rom_map_elem_t audiocore_graph_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audiocore_graph_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&audiocore_graph___exit___obj) },
+    { MP_ROM_QSTR(MP_QSTR_source), MP_ROM_PTR(&audiocore_graph_source_obj) },
+    { MP_ROM_QSTR(MP_QSTR_gain), MP_ROM_PTR(&audiocore_graph_gain_obj) },
+    { MP_ROM_QSTR(MP_QSTR_mix), MP_ROM_PTR(&audiocore_graph_mix_obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_output), MP_ROM_PTR(&audiocore_graph_output_obj) },
+    { MP_ROM_QSTR(MP_QSTR_buffer_count), MP_ROM_PTR(&audiocore_graph_buffer_count_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sample_rate), MP_ROM_PTR(&audiocore_graph_sample_rate_obj) },
+};
+static MP_DEFINE_CONST_DICT(audiocore_graph_locals_dict, audiocore_graph_locals_dict_table);
+
+static const audiosample_p_t audiocore_graph_proto = {
+    MP_PROTO_IMPLEMENT(MP_QSTR_protocol_audiosample)
+    .sample_rate = (audiosample_sample_rate_fun)common_hal_audiocore_graph_get_sample_rate,
+    .bits_per_sample = (audiosample_bits_per_sample_fun)common_hal_audiocore_graph_get_bits_per_sample,
+    .channel_count = (audiosample_channel_count_fun)common_hal_audiocore_graph_get_channel_count,
+    .reset_buffer = (audiosample_reset_buffer_fun)audiocore_graph_reset_buffer,
+    .get_buffer = (audiosample_get_buffer_fun)audiocore_graph_get_buffer,
+    .get_buffer_structure = (audiosample_get_buffer_structure_fun)audiocore_graph_get_buffer_structure,
+};
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    audiocore_graph_type,
+    MP_QSTR_Graph,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, audiocore_graph_make_new,
+    locals_dict, &audiocore_graph_locals_dict,
+    protocol, &audiocore_graph_proto
+    );
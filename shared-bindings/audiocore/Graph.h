@@ -0,0 +1,25 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-module/audiocore/Graph.h"
+
+extern const mp_obj_type_t audiocore_graph_type;
+
+void common_hal_audiocore_graph_construct(audiocore_graph_obj_t *self,
+    uint32_t sample_rate, uint8_t channel_count, uint16_t block_size);
+void common_hal_audiocore_graph_deinit(audiocore_graph_obj_t *self);
+bool common_hal_audiocore_graph_deinited(audiocore_graph_obj_t *self);
+uint32_t common_hal_audiocore_graph_get_sample_rate(audiocore_graph_obj_t *self);
+uint8_t common_hal_audiocore_graph_get_bits_per_sample(audiocore_graph_obj_t *self);
+uint8_t common_hal_audiocore_graph_get_channel_count(audiocore_graph_obj_t *self);
+uint8_t common_hal_audiocore_graph_get_buffer_count(audiocore_graph_obj_t *self);
+mp_obj_t common_hal_audiocore_graph_get_output(audiocore_graph_obj_t *self);
+void common_hal_audiocore_graph_set_output(audiocore_graph_obj_t *self, audiocore_graph_node_obj_t *output);
+audiocore_graph_node_obj_t *common_hal_audiocore_graph_new_source(audiocore_graph_obj_t *self, mp_obj_t sample, bool loop, mp_float_t level);
+audiocore_graph_node_obj_t *common_hal_audiocore_graph_new_gain(audiocore_graph_obj_t *self, mp_obj_t input, mp_float_t level);
+audiocore_graph_node_obj_t *common_hal_audiocore_graph_new_mix(audiocore_graph_obj_t *self, size_t n_inputs, const mp_obj_t *inputs, mp_float_t level);
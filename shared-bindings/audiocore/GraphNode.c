@@ -0,0 +1,65 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <stdint.h>
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/audiocore/GraphNode.h"
+
+//| class GraphNode:
+//|     """A node of a `Graph`
+//|
+//|     Nodes are made by `Graph.source`, `Graph.gain` and `Graph.mix`, and can only be
+//|     connected to nodes of the same graph."""
+//|
+
+//|     level: float
+//|     """The volume of the node's output, from 0 to 1"""
+static mp_obj_t audiocore_graph_node_obj_get_level(mp_obj_t self_in) {
+    audiocore_graph_node_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_float(common_hal_audiocore_graph_node_get_level(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiocore_graph_node_get_level_obj, audiocore_graph_node_obj_get_level);
+
+static mp_obj_t audiocore_graph_node_obj_set_level(mp_obj_t self_in, mp_obj_t level_in) {
+    audiocore_graph_node_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_float_t level = mp_arg_validate_obj_float_range(level_in, 0, 1, MP_QSTR_level);
+    common_hal_audiocore_graph_node_set_level(self, level);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiocore_graph_node_set_level_obj, audiocore_graph_node_obj_set_level);
+
+MP_PROPERTY_GETSET(audiocore_graph_node_level_obj,
+    (mp_obj_t)&audiocore_graph_node_get_level_obj,
+    (mp_obj_t)&audiocore_graph_node_set_level_obj);
+
+//|     playing: bool
+//|     """True while a source node's sample is playing, or while any source feeding the node
+//|     is. (read-only)"""
+//|
+static mp_obj_t audiocore_graph_node_obj_get_playing(mp_obj_t self_in) {
+    audiocore_graph_node_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_bool(common_hal_audiocore_graph_node_get_playing(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiocore_graph_node_get_playing_obj, audiocore_graph_node_obj_get_playing);
+
+MP_PROPERTY_GETTER(audiocore_graph_node_playing_obj,
+    (mp_obj_t)&audiocore_graph_node_get_playing_obj);
+
+static const mp_rom_map_elem_t audiocore_graph_node_locals_dict_table[] = {
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_level), MP_ROM_PTR(&audiocore_graph_node_level_obj) },
+    { MP_ROM_QSTR(MP_QSTR_playing), MP_ROM_PTR(&audiocore_graph_node_playing_obj) },
+};
+static MP_DEFINE_CONST_DICT(audiocore_graph_node_locals_dict, audiocore_graph_node_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    audiocore_graph_node_type,
+    MP_QSTR_GraphNode,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    locals_dict, &audiocore_graph_node_locals_dict
+    );
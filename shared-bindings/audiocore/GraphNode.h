@@ -0,0 +1,15 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-module/audiocore/GraphNode.h"
+
+extern const mp_obj_type_t audiocore_graph_node_type;
+
+mp_float_t common_hal_audiocore_graph_node_get_level(audiocore_graph_node_obj_t *self);
+void common_hal_audiocore_graph_node_set_level(audiocore_graph_node_obj_t *self, mp_float_t level);
+bool common_hal_audiocore_graph_node_get_playing(audiocore_graph_node_obj_t *self);
@@ -22,13 +22,20 @@
 //|         *,
 //|         channel_count: int = 1,
 //|         sample_rate: int = 8000,
-//|         single_buffer: bool = True
+//|         single_buffer: bool = True,
+//|         bits_per_sample: Optional[int] = None,
+//|         samples_signed: Optional[bool] = None
 //|     ) -> None:
 //|         """Create a RawSample based on the given buffer of values. If channel_count is more than
 //|         1 then each channel's samples should alternate. In other words, for a two channel buffer, the
 //|         first sample will be for channel 1, the second sample will be for channel two, the third for
 //|         channel 1 and so on.
 //|
+//|         The buffer is played from where it is and is never copied, so it can be read-only, such as
+//|         a `bytes` object in a frozen module in flash, or a `memoryview` of part of a larger bank of
+//|         samples. Players such as `audiomixer.Mixer` convert a sample whose format differs from
+//|         theirs as they mix it.
+//|
 //|         :param ~circuitpython_typing.ReadableBuffer buffer: A buffer with samples
 //|         :param int channel_count: The number of channels in the buffer
 //|         :param int sample_rate: The desired playback sample rate
@@ -37,6 +44,12 @@
 //|                                    In single buffered transfers, a change in buffer contents will not affect active playback.
 //|                                    In double buffered transfers, changed buffer contents will
 //|                                    be played back when the transfer reaches the next half-buffer point.
+//|         :param int bits_per_sample: The size of each sample, 8 or 16. By default this comes from the
+//|                                     buffer's type: 16 for arrays of type 'h' or 'H', otherwise 8.
+//|         :param bool samples_signed: Whether the samples are signed. By default this comes from the
+//|                                     buffer's type: signed for arrays of type 'h' or 'b', otherwise
+//|                                     unsigned. Together with ``bits_per_sample``, this lets samples
+//|                                     of any format be played from `bytes`.
 //|
 //|         Playing 8ksps 440 Hz and 880 Hz sine waves::
 //|
@@ -78,12 +91,14 @@
 //|           pwm.deinit()"""
 //|         ...
 static mp_obj_t audioio_rawsample_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
-    enum { ARG_buffer, ARG_channel_count, ARG_sample_rate, ARG_single_buffer };
+    enum { ARG_buffer, ARG_channel_count, ARG_sample_rate, ARG_single_buffer, ARG_bits_per_sample, ARG_samples_signed };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_buffer, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = MP_OBJ_NULL } },
         { MP_QSTR_channel_count, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1 } },
         { MP_QSTR_sample_rate, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 8000} },
         { MP_QSTR_single_buffer, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = true} },
+        { MP_QSTR_bits_per_sample, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        { MP_QSTR_samples_signed, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -98,10 +113,23 @@ static mp_obj_t audioio_rawsample_make_new(const mp_obj_type_t *type, size_t n_a
     } else if (bufinfo.typecode != 'b' && bufinfo.typecode != 'B' && bufinfo.typecode != BYTEARRAY_TYPECODE) {
         mp_raise_ValueError_varg(MP_ERROR_TEXT("%q must be a bytearray or array of type 'h', 'H', 'b', or 'B'"), MP_QSTR_buffer);
     }
+    if (args[ARG_bits_per_sample].u_obj != mp_const_none) {
+        mp_int_t bits_per_sample = mp_obj_get_int(args[ARG_bits_per_sample].u_obj);
+        if (bits_per_sample != 8 && bits_per_sample != 16) {
+            mp_raise_ValueError(MP_ERROR_TEXT("bits_per_sample must be 8 or 16"));
+        }
+        bytes_per_sample = bits_per_sample / 8;
+    }
+    if (args[ARG_samples_signed].u_obj != mp_const_none) {
+        signed_samples = mp_obj_is_true(args[ARG_samples_signed].u_obj);
+    }
+    if (bytes_per_sample == 2 && ((uintptr_t)bufinfo.buf & 1)) {
+        mp_raise_msg_varg(&mp_type_ValueError, MP_ERROR_TEXT("address %08x is not aligned to %d bytes"), (uint32_t)(uintptr_t)bufinfo.buf, 2);
+    }
     if (!args[ARG_single_buffer].u_bool && bufinfo.len % (bytes_per_sample * args[ARG_channel_count].u_int * 2) != 0) {
         mp_raise_ValueError_varg(MP_ERROR_TEXT("Length of %q must be an even multiple of channel_count * type_size"), MP_QSTR_buffer);
     }
-    common_hal_audioio_rawsample_construct(self, ((uint8_t *)bufinfo.buf), bufinfo.len,
+    common_hal_audioio_rawsample_construct(self, args[ARG_buffer].u_obj, ((uint8_t *)bufinfo.buf), bufinfo.len,
         bytes_per_sample, signed_samples, args[ARG_channel_count].u_int,
         args[ARG_sample_rate].u_int, args[ARG_single_buffer].u_bool);
 
@@ -7,11 +7,12 @@
 #include <stdint.h>
 
 #include "shared/runtime/context_manager_helpers.h"
+#include "py/builtin.h"
 #include "py/objproperty.h"
 #include "py/runtime.h"
+#include "py/stream.h"
 #include "shared-bindings/audiocore/WaveFile.h"
 #include "shared-bindings/util.h"
-#include "extmod/vfs_posix.h"
 
 //| class WaveFile:
 //|     """Load a wave file for audio playback
@@ -20,14 +21,29 @@
 //|     be 8 bit unsigned or 16 bit signed. If a buffer is provided, it will be used instead of allocating
 //|     an internal buffer, which can prevent memory fragmentation."""
 //|
-//|     def __init__(self, file: Union[str, typing.BinaryIO], buffer: WriteableBuffer) -> None:
+//|     def __init__(
+//|         self,
+//|         file: Union[str, typing.BinaryIO],
+//|         buffer: Optional[WriteableBuffer] = None,
+//|         *,
+//|         prefetch: int = 2,
+//|     ) -> None:
 //|         """Load a .wav file for playback with `audioio.AudioOut` or `audiobusio.I2SOut`.
 //|
-//|         :param Union[str, typing.BinaryIO] file: The name of a wave file (preferred) or an already opened wave file
+//|         :param Union[str, typing.BinaryIO] file: The name of a wave file (preferred) or an already opened wave file.
+//|           Files that can't seek can only be played once and can't be looped.
 //|         :param ~circuitpython_typing.WriteableBuffer buffer: Optional pre-allocated buffer,
-//|           that will be split in half and used for double-buffering of the data.
-//|           The buffer must be 8 to 1024 bytes long.
-//|           If not provided, two 256 byte buffers are initially allocated internally.
+//|           that will be split into ``prefetch + 2`` equal parts: one playing, one queued and the
+//|           rest read ahead. The buffer must be 8 to 1024 bytes long. A buffer too small to give
+//|           every part at least 4 bytes is split into fewer parts, reading fewer buffers ahead.
+//|           If not provided, ``prefetch + 2`` 256 byte buffers are initially allocated internally.
+//|           That is 1024 bytes with the default ``prefetch``, twice what earlier versions used;
+//|           pass ``prefetch=0`` for the previous two 256 byte buffers.
+//|         :param int prefetch: How many buffers to read ahead of playback, from 0 to 8. They are
+//|           refilled in the background so that a slow or busy file system doesn't interrupt
+//|           playback; see `underruns`. 0 reads each buffer just as it is needed. Streams
+//|           implemented in Python, such as `io.IOBase` subclasses, can't be read in the
+//|           background and always behave as 0.
 //|
 //|         Playing a wave file from flash::
 //|
@@ -50,28 +66,38 @@
 //|           print("stopped")
 //|         """
 //|         ...
-static mp_obj_t audioio_wavefile_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
-    mp_arg_check_num(n_args, n_kw, 1, 2, false);
-    mp_obj_t arg = args[0];
-
+static mp_obj_t audioio_wavefile_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_file, ARG_buffer, ARG_prefetch };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_file, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_buffer, MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_prefetch, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 2} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t arg = args[ARG_file].u_obj;
     if (mp_obj_is_str(arg)) {
         arg = mp_call_function_2(MP_OBJ_FROM_PTR(&mp_builtin_open_obj), arg, MP_ROM_QSTR(MP_QSTR_rb));
     }
 
-    audioio_wavefile_obj_t *self = mp_obj_malloc(audioio_wavefile_obj_t, &audioio_wavefile_type);
-    if (!mp_obj_is_type(arg, &mp_type_vfs_fat_fileio)) {
+    const mp_stream_p_t *stream_p = mp_get_stream(arg);
+    if (stream_p == NULL || stream_p->read == NULL || stream_p->is_text) {
         mp_raise_TypeError(MP_ERROR_TEXT("file must be a file opened in byte mode"));
     }
+    mp_int_t prefetch = mp_arg_validate_int_range(args[ARG_prefetch].u_int, 0, AUDIOIO_WAVEFILE_MAX_PREFETCH, MP_QSTR_prefetch);
+
     uint8_t *buffer = NULL;
     size_t buffer_size = 0;
-    if (n_args >= 2) {
+    if (args[ARG_buffer].u_obj != mp_const_none) {
         mp_buffer_info_t bufinfo;
-        mp_get_buffer_raise(args[1], &bufinfo, MP_BUFFER_WRITE);
+        mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_WRITE);
         buffer = bufinfo.buf;
         buffer_size = mp_arg_validate_length_range(bufinfo.len, 8, 1024, MP_QSTR_buffer);
     }
-    common_hal_audioio_wavefile_construct(self, MP_OBJ_TO_PTR(arg),
-        buffer, buffer_size);
+
+    audioio_wavefile_obj_t *self = mp_obj_malloc(audioio_wavefile_obj_t, &audioio_wavefile_type);
+    common_hal_audioio_wavefile_construct(self, arg, buffer, buffer_size, prefetch);
 
     return MP_OBJ_FROM_PTR(self);
 }
@@ -144,7 +170,6 @@ MP_PROPERTY_GETTER(audioio_wavefile_bits_per_sample_obj,
     (mp_obj_t)&audioio_wavefile_get_bits_per_sample_obj);
 //|     channel_count: int
 //|     """Number of audio channels. (read only)"""
-//|
 static mp_obj_t audioio_wavefile_obj_get_channel_count(mp_obj_t self_in) {
     audioio_wavefile_obj_t *self = MP_OBJ_TO_PTR(self_in);
     check_for_deinit(self);
@@ -155,6 +180,22 @@ MP_DEFINE_CONST_FUN_OBJ_1(audioio_wavefile_get_channel_count_obj, audioio_wavefi
 MP_PROPERTY_GETTER(audioio_wavefile_channel_count_obj,
     (mp_obj_t)&audioio_wavefile_get_channel_count_obj);
 
+//|     underruns: int
+//|     """Number of times playback needed a buffer before it was ready. Either the read ahead
+//|     hadn't finished loading it and playback waited for the file, or a non-blocking stream had
+//|     no data yet and a moment of silence was played instead. If this grows, increase
+//|     ``prefetch``. (read only)"""
+//|
+static mp_obj_t audioio_wavefile_obj_get_underruns(mp_obj_t self_in) {
+    audioio_wavefile_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_uint(common_hal_audioio_wavefile_get_underruns(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioio_wavefile_get_underruns_obj, audioio_wavefile_obj_get_underruns);
+
+MP_PROPERTY_GETTER(audioio_wavefile_underruns_obj,
+    (mp_obj_t)&audioio_wavefile_get_underruns_obj);
+
 
 static const mp_rom_map_elem_t audioio_wavefile_locals_dict_table[] = {
     // Methods
@@ -166,6 +207,7 @@ static const mp_rom_map_elem_t audioio_wavefile_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_sample_rate), MP_ROM_PTR(&audioio_wavefile_sample_rate_obj) },
     { MP_ROM_QSTR(MP_QSTR_bits_per_sample), MP_ROM_PTR(&audioio_wavefile_bits_per_sample_obj) },
     { MP_ROM_QSTR(MP_QSTR_channel_count), MP_ROM_PTR(&audioio_wavefile_channel_count_obj) },
+    { MP_ROM_QSTR(MP_QSTR_underruns), MP_ROM_PTR(&audioio_wavefile_underruns_obj) },
 };
 static MP_DEFINE_CONST_DICT(audioio_wavefile_locals_dict, audioio_wavefile_locals_dict_table);
 
@@ -5,12 +5,17 @@
 // SPDX-License-Identifier: MIT
 
 #include <stdint.h>
+#include <string.h>
 
 #include "py/obj.h"
 #include "py/gc.h"
+#include "py/mphal.h"
 #include "py/runtime.h"
+#include "py/stream.h"
 
 #include "shared-bindings/audiocore/__init__.h"
+#include "shared-bindings/audiocore/Graph.h"
+#include "shared-bindings/audiocore/GraphNode.h"
 #include "shared-bindings/audiocore/RawSample.h"
 #include "shared-bindings/audiocore/WaveFile.h"
 // #include "shared-bindings/audiomixer/Mixer.h"
@@ -72,16 +77,156 @@ static mp_obj_t audiocore_reset_buffer(mp_obj_t sample_in) {
 }
 static MP_DEFINE_CONST_FUN_OBJ_1(audiocore_reset_buffer_obj, audiocore_reset_buffer);
 
+static void audiocore_render_write(mp_obj_t file, const void *buf, size_t len) {
+    int errcode;
+    mp_stream_write_exactly(file, buf, len, &errcode);
+    if (errcode != 0) {
+        mp_raise_OSError(errcode);
+    }
+}
+
+// WAV PCM is unsigned at 8 bits and signed above that, so samples stored the other way have
+// their sign bit flipped on the way out. Samples are little endian, so that's the last byte.
+static void audiocore_render_write_pcm(mp_obj_t file, const uint8_t *buf, size_t len, uint8_t bits_per_sample, bool samples_signed) {
+    if ((bits_per_sample == 8) != samples_signed) {
+        audiocore_render_write(file, buf, len);
+        return;
+    }
+    size_t sample_size = bits_per_sample / 8;
+    uint8_t chunk[64];
+    while (len > 0) {
+        size_t n = MIN(len, sizeof(chunk));
+        memcpy(chunk, buf, n);
+        for (size_t i = sample_size - 1; i < n; i += sample_size) {
+            chunk[i] ^= 0x80;
+        }
+        audiocore_render_write(file, chunk, n);
+        buf += n;
+        len -= n;
+    }
+}
+
+static void audiocore_render_put(uint8_t *p, uint32_t value, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        p[i] = value >> (8 * i);
+    }
+}
+
+static void audiocore_render_wav_header(mp_obj_t file, uint32_t sample_rate, uint8_t channel_count, uint8_t bits_per_sample, uint32_t data_length) {
+    uint8_t header[44];
+    uint32_t block_align = channel_count * bits_per_sample / 8;
+    memcpy(header, "RIFF", 4);
+    audiocore_render_put(header + 4, 36 + data_length, 4);
+    memcpy(header + 8, "WAVEfmt ", 8);
+    audiocore_render_put(header + 16, 16, 4);
+    audiocore_render_put(header + 20, 1, 2); // PCM
+    audiocore_render_put(header + 22, channel_count, 2);
+    audiocore_render_put(header + 24, sample_rate, 4);
+    audiocore_render_put(header + 28, sample_rate * block_align, 4);
+    audiocore_render_put(header + 32, block_align, 2);
+    audiocore_render_put(header + 34, bits_per_sample, 2);
+    memcpy(header + 36, "data", 4);
+    audiocore_render_put(header + 40, data_length, 4);
+    audiocore_render_write(file, header, sizeof(header));
+}
+
+// Pull a sample the way an audio output would, but as fast as possible. Optionally writes
+// what was produced to a WAV file as integer PCM. Returns the number of frames rendered and
+// the duration of each get_buffer call in microseconds, so callers can work out throughput,
+// latency percentiles and real-time headroom. Like get_buffer, this carries on from wherever the
+// sample is; resetting a Mixer would stop its voices, so use reset_buffer to rewind first.
+static mp_obj_t audiocore_render(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_sample, ARG_frames, ARG_file };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_sample, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_frames, MP_ARG_INT | MP_ARG_REQUIRED, {.u_int = 0} },
+        { MP_QSTR_file, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t sample_in = args[ARG_sample].u_obj;
+    mp_int_t frames = mp_arg_validate_int_min(args[ARG_frames].u_int, 0, MP_QSTR_frames);
+    mp_obj_t file = args[ARG_file].u_obj;
+
+    bool single_buffer, samples_signed;
+    uint32_t max_buffer_length;
+    uint8_t spacing;
+    audiosample_get_buffer_structure(sample_in, false, &single_buffer, &samples_signed, &max_buffer_length, &spacing);
+    uint32_t sample_rate = audiosample_sample_rate(sample_in);
+    uint8_t channel_count = audiosample_channel_count(sample_in);
+    uint8_t bits_per_sample = audiosample_bits_per_sample(sample_in);
+    uint32_t frame_size = channel_count * bits_per_sample / 8;
+
+    if (file != mp_const_none) {
+        mp_get_stream_raise(file, MP_STREAM_OP_WRITE);
+        audiocore_render_wav_header(file, sample_rate, channel_count, bits_per_sample, 0);
+    }
+
+    // Start small and grow: samples that end early would otherwise pay for every
+    // call a huge frame count could have taken
+    size_t calls_alloc = MIN(frames / MAX(1, max_buffer_length / frame_size) + 1, 64);
+    uint32_t *latencies = m_new(uint32_t, calls_alloc);
+    size_t calls = 0;
+    mp_int_t rendered = 0;
+
+    while (rendered < frames) {
+        uint8_t *buffer = NULL;
+        uint32_t buffer_length = 0;
+        mp_uint_t start = mp_hal_ticks_us();
+        audioio_get_buffer_result_t gbr = audiosample_get_buffer(sample_in, false, 0, &buffer, &buffer_length);
+        mp_uint_t elapsed = mp_hal_ticks_us() - start;
+        if (gbr == GET_BUFFER_ERROR) {
+            break;
+        }
+
+        if (calls == calls_alloc) {
+            latencies = m_renew(uint32_t, latencies, calls_alloc, calls_alloc * 2);
+            calls_alloc *= 2;
+        }
+        latencies[calls++] = MIN(elapsed, UINT32_MAX);
+
+        uint32_t buffer_frames = MIN(buffer_length / frame_size, (uint32_t)(frames - rendered));
+        if (file != mp_const_none) {
+            audiocore_render_write_pcm(file, buffer, buffer_frames * frame_size, bits_per_sample, samples_signed);
+        }
+        rendered += buffer_frames;
+        if (gbr == GET_BUFFER_DONE) {
+            break;
+        }
+    }
+
+    if (file != mp_const_none) {
+        // Patch the lengths into the header if the file can seek; otherwise they stay zero,
+        // which most tools read as "until end of file".
+        int errcode;
+        if (mp_stream_seek(file, 0, MP_SEEK_SET, &errcode) == 0) {
+            audiocore_render_wav_header(file, sample_rate, channel_count, bits_per_sample, rendered * frame_size);
+            mp_stream_seek(file, 0, MP_SEEK_END, &errcode);
+        }
+    }
+
+    mp_obj_t result[2] = {
+        mp_obj_new_int(rendered),
+        mp_obj_new_memoryview('I', calls, latencies),
+    };
+    return mp_obj_new_tuple(2, result);
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(audiocore_render_obj, 2, audiocore_render);
+
 #endif
 
 static const mp_rom_map_elem_t audiocore_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_audiocore) },
+    { MP_ROM_QSTR(MP_QSTR_Graph), MP_ROM_PTR(&audiocore_graph_type) },
+    { MP_ROM_QSTR(MP_QSTR_GraphNode), MP_ROM_PTR(&audiocore_graph_node_type) },
     { MP_ROM_QSTR(MP_QSTR_RawSample), MP_ROM_PTR(&audioio_rawsample_type) },
     { MP_ROM_QSTR(MP_QSTR_WaveFile), MP_ROM_PTR(&audioio_wavefile_type) },
     #if CIRCUITPY_AUDIOCORE_DEBUG
     { MP_ROM_QSTR(MP_QSTR_get_buffer), MP_ROM_PTR(&audiocore_get_buffer_obj) },
     { MP_ROM_QSTR(MP_QSTR_reset_buffer), MP_ROM_PTR(&audiocore_reset_buffer_obj) },
     { MP_ROM_QSTR(MP_QSTR_get_structure), MP_ROM_PTR(&audiocore_get_structure_obj) },
+    { MP_ROM_QSTR(MP_QSTR_render), MP_ROM_PTR(&audiocore_render_obj) },
     #endif
 };
 
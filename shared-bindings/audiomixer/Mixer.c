@@ -27,15 +27,15 @@
 //|         samples_signed: bool = True,
 //|         sample_rate: int = 8000,
 //|     ) -> None:
-//|         """Create a Mixer object that can mix multiple channels with the same sample rate.
+//|         """Create a Mixer object that can mix multiple samples together.
 //|         Samples are accessed and controlled with the mixer's `audiomixer.MixerVoice` objects.
 //|
 //|         :param int voice_count: The maximum number of voices to mix
 //|         :param int buffer_size: The total size in bytes of the buffers to mix into
-//|         :param int channel_count: The number of channels the source samples contain. 1 = mono; 2 = stereo.
-//|         :param int bits_per_sample: The bits per sample of the samples being played
-//|         :param bool samples_signed: Samples are signed (True) or unsigned (False)
-//|         :param int sample_rate: The sample rate to be used for all samples
+//|         :param int channel_count: The number of channels the mixer outputs. 1 = mono; 2 = stereo.
+//|         :param int bits_per_sample: The bits per sample the mixer outputs
+//|         :param bool samples_signed: The mixer outputs signed (True) or unsigned (False) samples
+//|         :param int sample_rate: The sample rate the mixer outputs. Samples at other rates are converted.
 //|
 //|         Playing a wave file from flash::
 //|
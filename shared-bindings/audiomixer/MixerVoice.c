@@ -38,7 +38,10 @@ static mp_obj_t audiomixer_mixervoice_make_new(const mp_obj_type_t *type, size_t
 //|
 //|         Sample must be an `audiocore.WaveFile`, `audiocore.RawSample`, `audiomixer.Mixer` or `audiomp3.MP3Decoder`.
 //|
-//|         The sample must match the `audiomixer.Mixer`'s encoding settings given in the constructor.
+//|         Samples with a different sample rate, channel count, bit depth or signedness than the
+//|         `audiomixer.Mixer` are converted while they play. The sample rate is converted by linear
+//|         interpolation, which costs some CPU time, so samples that already match the mixer play
+//|         most efficiently. Samples must be 8 or 16 bit, mono or stereo.
 //|         """
 //|         ...
 static mp_obj_t audiomixer_mixervoice_obj_play(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
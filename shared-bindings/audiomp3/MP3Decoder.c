@@ -65,7 +65,12 @@
 //|             pass
 //|           print("stopped")
 //|
-//|         It is possible to seek within a file before playing it::
+//|         It is possible to seek within a file, before or while playing it::
+//|
+//|             decoder.seek(decoder.sample_rate * 30) # Seek 30s into the file
+//|
+//|         A stream can also be moved to where playback should start before it is given to the
+//|         decoder::
 //|
 //|             with open("/test.mp3", "rb") as stream:
 //|                 stream.seek(128000 * 30 // 8) # Seek about 30s into a 128kbit/s stream
@@ -177,6 +182,25 @@ static mp_obj_t audiomp3_mp3file_obj_open(mp_obj_t self_in, mp_obj_t path) {
 }
 MP_DEFINE_CONST_FUN_OBJ_2(audiomp3_mp3file_open_obj, audiomp3_mp3file_obj_open);
 
+//|     def seek(self, sample: int) -> None:
+//|         """Move to a point in the file, given as a number of samples from its start for each
+//|         channel, so that ``sample_rate`` samples is one second. Playback resumes from the start
+//|         of the frame that contains that sample, and `samples_decoded` is updated to match.
+//|
+//|         The decoder remembers where frames start as it plays and seeks, so going back to a
+//|         point it has passed is quick. Going further ahead means reading the frames in
+//|         between, but not decoding them. The file must be able to seek, so this doesn't work
+//|         with a socket."""
+//|         ...
+static mp_obj_t audiomp3_mp3file_obj_seek(mp_obj_t self_in, mp_obj_t sample_in) {
+    audiomp3_mp3file_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    mp_int_t sample = mp_arg_validate_int_min(mp_obj_get_int(sample_in), 0, MP_QSTR_sample);
+    common_hal_audiomp3_mp3file_seek(self, sample);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiomp3_mp3file_seek_obj, audiomp3_mp3file_obj_seek);
+
 MP_PROPERTY_GETSET(audiomp3_mp3file_file_obj,
     (mp_obj_t)&audiomp3_mp3file_get_file_obj,
     (mp_obj_t)&audiomp3_mp3file_set_file_obj);
@@ -258,6 +282,7 @@ MP_PROPERTY_GETTER(audiomp3_mp3file_samples_decoded_obj,
 static const mp_rom_map_elem_t audiomp3_mp3file_locals_dict_table[] = {
     // Methods
     { MP_ROM_QSTR(MP_QSTR_open), MP_ROM_PTR(&audiomp3_mp3file_open_obj) },
+    { MP_ROM_QSTR(MP_QSTR_seek), MP_ROM_PTR(&audiomp3_mp3file_seek_obj) },
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audiomp3_mp3file_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR___del__), MP_ROM_PTR(&audiomp3_mp3file_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
@@ -324,6 +324,36 @@ static const mp_obj_namedtuple_type_t bitmapfilter_channel_mixer_offset_type = {
     },
 };
 
+static void get_mix_weights(mp_obj_t weights_obj, mp_float_t weights[12]) {
+    memset(weights, 0, 12 * sizeof(mp_float_t));
+
+    if (mp_obj_is_type(weights_obj, (const mp_obj_type_t *)&bitmapfilter_channel_scale_type)) {
+        for (int i = 0; i < 3; i++) {
+            weights[5 * i] = float_subscr(weights_obj, i);
+        }
+    } else if (mp_obj_is_type(weights_obj, (const mp_obj_type_t *)&bitmapfilter_channel_scale_offset_type)) {
+        for (int i = 0; i < 3; i++) {
+            weights[5 * i] = float_subscr(weights_obj, i * 2);
+            weights[4 * i + 3] = float_subscr(weights_obj, i * 2 + 1);
+        }
+    } else if (mp_obj_is_type(weights_obj, (const mp_obj_type_t *)&bitmapfilter_channel_mixer_type)) {
+        for (int i = 0; i < 9; i++) {
+            weights[i + i / 3] = float_subscr(weights_obj, i);
+        }
+    } else if (mp_obj_is_type(weights_obj, (const mp_obj_type_t *)&bitmapfilter_channel_mixer_offset_type)) {
+        for (int i = 0; i < 12; i++) {
+            weights[i] = float_subscr(weights_obj, i);
+        }
+    } else {
+        mp_raise_ValueError_varg(
+            MP_ERROR_TEXT("weights must be an object of type %q, %q, %q, or %q, not %q "),
+            MP_QSTR_ScaleMixer, MP_QSTR_ScaleMixerOffset,
+            MP_QSTR_ChannelMixer, MP_QSTR_ChannelMixerOffset,
+            mp_obj_get_type_qstr(weights_obj)
+            );
+    }
+}
+
 //| def mix(
 //|     bitmap: displayio.Bitmap,
 //|     weights: ChannelScale | ChannelScaleOffset | ChannelMixer | ChannelMixerOffset,
@@ -365,35 +395,7 @@ static mp_obj_t bitmapfilter_mix(size_t n_args, const mp_obj_t *pos_args, mp_map
     displayio_bitmap_t *bitmap = MP_OBJ_TO_PTR(args[ARG_bitmap].u_obj);
 
     mp_float_t weights[12];
-    memset(weights, 0, sizeof(weights));
-
-    mp_obj_t weights_obj = args[ARG_weights].u_obj;
-    if (mp_obj_is_type(weights_obj, (const mp_obj_type_t *)&bitmapfilter_channel_scale_type)) {
-        for (int i = 0; i < 3; i++) {
-            weights[5 * i] = float_subscr(weights_obj, i);
-        }
-    } else if (mp_obj_is_type(weights_obj, (const mp_obj_type_t *)&bitmapfilter_channel_scale_offset_type)) {
-        for (int i = 0; i < 3; i++) {
-            weights[5 * i] = float_subscr(weights_obj, i * 2);
-            weights[4 * i + 3] = float_subscr(weights_obj, i * 2 + 1);
-        }
-    } else if (mp_obj_is_type(weights_obj, (const mp_obj_type_t *)&bitmapfilter_channel_mixer_type)) {
-        for (int i = 0; i < 9; i++) {
-            weights[i + i / 3] = float_subscr(weights_obj, i);
-        }
-    } else if (mp_obj_is_type(weights_obj, (const mp_obj_type_t *)&bitmapfilter_channel_mixer_offset_type)) {
-        for (int i = 0; i < 12; i++) {
-            weights[i] = float_subscr(weights_obj, i);
-        }
-    } else {
-        mp_raise_ValueError_varg(
-            MP_ERROR_TEXT("weights must be an object of type %q, %q, %q, or %q, not %q "),
-            MP_QSTR_ScaleMixer, MP_QSTR_ScaleMixerOffset,
-            MP_QSTR_ChannelMixer, MP_QSTR_ChannelMixerOffset,
-            mp_obj_get_type_qstr(weights_obj)
-            );
-    }
-
+    get_mix_weights(args[ARG_weights].u_obj, weights);
 
     displayio_bitmap_t *mask = NULL;
     if (args[ARG_mask].u_obj != mp_const_none) {
@@ -406,6 +408,10 @@ static mp_obj_t bitmapfilter_mix(size_t n_args, const mp_obj_t *pos_args, mp_map
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(bitmapfilter_mix_obj, 0, bitmapfilter_mix);
 
+static mp_float_t get_solarize_threshold(mp_obj_t threshold_obj) {
+    return (threshold_obj == MP_OBJ_NULL) ? MICROPY_FLOAT_CONST(0.5) : mp_obj_get_float(threshold_obj);
+}
+
 //| def solarize(
 //|     bitmap: displayio.Bitmap,
 //|     threshold: float = 0.5,
@@ -434,7 +440,7 @@ static mp_obj_t bitmapfilter_solarize(size_t n_args, const mp_obj_t *pos_args, m
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
-    mp_float_t threshold = (args[ARG_threshold].u_obj == NULL) ? MICROPY_FLOAT_CONST(0.5) : mp_obj_get_float(args[ARG_threshold].u_obj);
+    mp_float_t threshold = get_solarize_threshold(args[ARG_threshold].u_obj);
     mp_arg_validate_type(args[ARG_bitmap].u_obj, &displayio_bitmap_type, MP_QSTR_bitmap);
     displayio_bitmap_t *bitmap = MP_OBJ_TO_PTR(args[ARG_bitmap].u_obj);
 
@@ -494,6 +500,28 @@ static int scaled_lut(int maxval, mp_obj_t func, int i) {
     return (int)MICROPY_FLOAT_C_FUN(round)(val * maxval);
 }
 
+static void get_lookup_table(mp_obj_t lookup, bitmapfilter_lookup_table_t *table) {
+    mp_obj_t lookup_r, lookup_g, lookup_b;
+
+    if (mp_obj_is_tuple_compatible(lookup)) {
+        mp_obj_tuple_t *lookup_tuple = MP_OBJ_TO_PTR(lookup);
+        mp_arg_validate_length(lookup_tuple->len, 3, MP_QSTR_lookup);
+        lookup_r = lookup_tuple->items[0];
+        lookup_g = lookup_tuple->items[1];
+        lookup_b = lookup_tuple->items[2];
+    } else {
+        lookup_r = lookup_g = lookup_b = lookup;
+    }
+
+    for (int i = 0; i < 32; i++) {
+        table->r[i] = scaled_lut(31, lookup_r, i);
+        table->b[i] = lookup_r == lookup_b ? table->r[i] : scaled_lut(31, lookup_b, i);
+    }
+    for (int i = 0; i < 64; i++) {
+        table->g[i] = scaled_lut(63, lookup_g, i);
+    }
+}
+
 static mp_obj_t bitmapfilter_lookup(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     enum { ARG_bitmap, ARG_lookup, ARG_mask };
     static const mp_arg_t allowed_args[] = {
@@ -507,27 +535,8 @@ static mp_obj_t bitmapfilter_lookup(size_t n_args, const mp_obj_t *pos_args, mp_
     mp_arg_validate_type(args[ARG_bitmap].u_obj, &displayio_bitmap_type, MP_QSTR_bitmap);
     displayio_bitmap_t *bitmap = MP_OBJ_TO_PTR(args[ARG_bitmap].u_obj);
 
-    mp_obj_t lookup_r, lookup_g, lookup_b;
-
-    if (mp_obj_is_tuple_compatible(args[ARG_lookup].u_obj)) {
-        mp_obj_tuple_t *lookup_tuple = MP_OBJ_TO_PTR(args[ARG_lookup].u_obj);
-        mp_arg_validate_length(lookup_tuple->len, 3, MP_QSTR_lookup);
-        lookup_r = lookup_tuple->items[0];
-        lookup_g = lookup_tuple->items[1];
-        lookup_b = lookup_tuple->items[2];
-    } else {
-        lookup_r = lookup_g = lookup_b = args[ARG_lookup].u_obj;
-    }
-
     bitmapfilter_lookup_table_t table;
-
-    for (int i = 0; i < 32; i++) {
-        table.r[i] = scaled_lut(31, lookup_r, i);
-        table.b[i] = lookup_r == lookup_b ? table.r[i] : scaled_lut(31, lookup_b, i);
-    }
-    for (int i = 0; i < 64; i++) {
-        table.g[i] = scaled_lut(63, lookup_g, i);
-    }
+    get_lookup_table(args[ARG_lookup].u_obj, &table);
 
     displayio_bitmap_t *mask = NULL;
     if (args[ARG_mask].u_obj != mp_const_none) {
@@ -541,6 +550,13 @@ static mp_obj_t bitmapfilter_lookup(size_t n_args, const mp_obj_t *pos_args, mp_
 
 MP_DEFINE_CONST_FUN_OBJ_KW(bitmapfilter_lookup_obj, 0, bitmapfilter_lookup);
 
+static displayio_palette_t *get_false_color_palette(mp_obj_t palette_obj) {
+    mp_arg_validate_type(palette_obj, &displayio_palette_type, MP_QSTR_palette);
+    displayio_palette_t *palette = MP_OBJ_TO_PTR(palette_obj);
+    mp_arg_validate_length(palette->color_count, 256, MP_QSTR_palette);
+    return palette;
+}
+
 //| def false_color(
 //|     bitmap: displayio.Bitmap,
 //|     palette: displayio.Palette,
@@ -579,9 +595,7 @@ static mp_obj_t bitmapfilter_false_color(size_t n_args, const mp_obj_t *pos_args
     mp_arg_validate_type(args[ARG_bitmap].u_obj, &displayio_bitmap_type, MP_QSTR_bitmap);
     displayio_bitmap_t *bitmap = MP_OBJ_TO_PTR(args[ARG_bitmap].u_obj);
 
-    mp_arg_validate_type(args[ARG_palette].u_obj, &displayio_palette_type, MP_QSTR_palette);
-    displayio_palette_t *palette = MP_OBJ_TO_PTR(args[ARG_palette].u_obj);
-    mp_arg_validate_length(palette->color_count, 256, MP_QSTR_palette);
+    displayio_palette_t *palette = get_false_color_palette(args[ARG_palette].u_obj);
 
     displayio_bitmap_t *mask = NULL;
     if (args[ARG_mask].u_obj != mp_const_none) {
@@ -594,6 +608,91 @@ static mp_obj_t bitmapfilter_false_color(size_t n_args, const mp_obj_t *pos_args
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(bitmapfilter_false_color_obj, 0, bitmapfilter_false_color);
 
+//| def chain(
+//|     bitmap: displayio.Bitmap,
+//|     filters: Sequence[Tuple[Callable[..., displayio.Bitmap], Any]],
+//|     mask: displayio.Bitmap | None = None,
+//| ) -> displayio.Bitmap:
+//|     """Apply several filters to the bitmap in one pass
+//|
+//|     Each item of ``filters`` is a tuple of one of the functions `mix`, `solarize`,
+//|     `lookup` or `false_color`, followed by the argument that would be given to it after
+//|     ``bitmap``. For `solarize` the argument can be left out to use the default threshold.
+//|
+//|     The result is the same as calling each function in turn with the same ``mask``, but
+//|     each pixel is read and written once rather than once per filter, so a chain of
+//|     filters applied to every frame from a camera runs much faster.
+//|
+//|     `morph` and `blend` use neighbouring pixels or a second image, so they can't be
+//|     part of a chain.
+//|
+//|     .. code-block:: python
+//|
+//|         bitmapfilter.chain(bitmap, (
+//|             (bitmapfilter.mix, sepia_weights),
+//|             (bitmapfilter.solarize, 0.75),
+//|             (bitmapfilter.lookup, gamma),
+//|         ))
+//|     """
+//|
+static mp_obj_t bitmapfilter_chain(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_bitmap, ARG_filters, ARG_mask };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_bitmap, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_obj = MP_OBJ_NULL } },
+        { MP_QSTR_filters, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_obj = MP_OBJ_NULL } },
+        { MP_QSTR_mask, MP_ARG_OBJ, { .u_obj = MP_ROM_NONE } },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_arg_validate_type(args[ARG_bitmap].u_obj, &displayio_bitmap_type, MP_QSTR_bitmap);
+    displayio_bitmap_t *bitmap = MP_OBJ_TO_PTR(args[ARG_bitmap].u_obj);
+
+    displayio_bitmap_t *mask = NULL;
+    if (args[ARG_mask].u_obj != mp_const_none) {
+        mp_arg_validate_type(args[ARG_mask].u_obj, &displayio_bitmap_type, MP_QSTR_mask);
+        mask = MP_OBJ_TO_PTR(args[ARG_mask].u_obj);
+    }
+
+    size_t n_filters;
+    mp_obj_t *filters;
+    mp_obj_get_array(args[ARG_filters].u_obj, &n_filters, &filters);
+
+    bitmapfilter_step_t *steps = m_new(bitmapfilter_step_t, n_filters);
+    for (size_t i = 0; i < n_filters; i++) {
+        size_t n_items;
+        mp_obj_t *items;
+        mp_obj_get_array(filters[i], &n_items, &items);
+        mp_arg_validate_length_range(n_items, 1, 2, MP_QSTR_filters);
+        mp_obj_t fun = items[0];
+        mp_obj_t arg = n_items > 1 ? items[1] : MP_OBJ_NULL;
+
+        if (fun == MP_OBJ_FROM_PTR(&bitmapfilter_solarize_obj)) {
+            shared_module_bitmapfilter_solarize_step(&steps[i], get_solarize_threshold(arg));
+            continue;
+        }
+        mp_arg_validate_length(n_items, 2, MP_QSTR_filters);
+        if (fun == MP_OBJ_FROM_PTR(&bitmapfilter_mix_obj)) {
+            mp_float_t weights[12];
+            get_mix_weights(arg, weights);
+            shared_module_bitmapfilter_mix_step(&steps[i], weights);
+        } else if (fun == MP_OBJ_FROM_PTR(&bitmapfilter_lookup_obj)) {
+            bitmapfilter_lookup_table_t table;
+            get_lookup_table(arg, &table);
+            shared_module_bitmapfilter_lookup_step(&steps[i], &table);
+        } else if (fun == MP_OBJ_FROM_PTR(&bitmapfilter_false_color_obj)) {
+            shared_module_bitmapfilter_false_color_step(&steps[i], get_false_color_palette(arg)->colors);
+        } else {
+            mp_arg_error_invalid(MP_QSTR_filters);
+        }
+    }
+
+    shared_module_bitmapfilter_chain(bitmap, mask, steps, n_filters);
+    m_del(bitmapfilter_step_t, steps, n_filters);
+    return args[ARG_bitmap].u_obj;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(bitmapfilter_chain_obj, 0, bitmapfilter_chain);
+
 #define BLEND_TABLE_SIZE (4096)
 static uint8_t *get_blend_table(mp_obj_t lookup, int mode) {
     mp_buffer_info_t lookup_buf;
@@ -724,6 +823,7 @@ static const mp_rom_map_elem_t bitmapfilter_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_solarize), MP_ROM_PTR(&bitmapfilter_solarize_obj) },
     { MP_ROM_QSTR(MP_QSTR_false_color), MP_ROM_PTR(&bitmapfilter_false_color_obj) },
     { MP_ROM_QSTR(MP_QSTR_lookup), MP_ROM_PTR(&bitmapfilter_lookup_obj) },
+    { MP_ROM_QSTR(MP_QSTR_chain), MP_ROM_PTR(&bitmapfilter_chain_obj) },
     { MP_ROM_QSTR(MP_QSTR_ChannelScale), MP_ROM_PTR(&bitmapfilter_channel_scale_type) },
     { MP_ROM_QSTR(MP_QSTR_ChannelScaleOffset), MP_ROM_PTR(&bitmapfilter_channel_scale_offset_type) },
     { MP_ROM_QSTR(MP_QSTR_ChannelMixer), MP_ROM_PTR(&bitmapfilter_channel_mixer_type) },
@@ -54,6 +54,35 @@ void shared_module_bitmapfilter_false_color(
     displayio_bitmap_t *mask,
     _displayio_color_t palette[256]);
 
+// One point filter in a chain, with its parameters already converted for the pixel loop
+typedef enum {
+    BITMAPFILTER_STEP_MIX,
+    BITMAPFILTER_STEP_SOLARIZE,
+    BITMAPFILTER_STEP_LOOKUP,
+    BITMAPFILTER_STEP_FALSE_COLOR,
+} bitmapfilter_step_kind_t;
+
+typedef struct {
+    bitmapfilter_step_kind_t kind;
+    union {
+        int32_t mix[12];
+        int32_t threshold;
+        bitmapfilter_lookup_table_t lookup;
+        uint16_t false_color[256];
+    };
+} bitmapfilter_step_t;
+
+void shared_module_bitmapfilter_mix_step(bitmapfilter_step_t *step, const mp_float_t weights[12]);
+void shared_module_bitmapfilter_solarize_step(bitmapfilter_step_t *step, const mp_float_t threshold);
+void shared_module_bitmapfilter_lookup_step(bitmapfilter_step_t *step, const bitmapfilter_lookup_table_t *table);
+void shared_module_bitmapfilter_false_color_step(bitmapfilter_step_t *step, _displayio_color_t palette[256]);
+
+void shared_module_bitmapfilter_chain(
+    displayio_bitmap_t *bitmap,
+    displayio_bitmap_t *mask,
+    const bitmapfilter_step_t *steps,
+    size_t n_steps);
+
 void shared_module_bitmapfilter_blend_precompute(mp_obj_t fun, uint8_t lookup[4096]);
 
 void shared_module_bitmapfilter_blend(
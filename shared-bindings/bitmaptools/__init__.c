@@ -830,12 +830,18 @@ MP_DEFINE_CONST_FUN_OBJ_KW(bitmaptools_readinto_obj, 0, bitmaptools_readinto);
 //|     FloydStenberg: "DitherAlgorithm"
 //|     """The Floyd-Stenberg dither"""
 //|
+//|     Bayer: "DitherAlgorithm"
+//|     """An ordered dither with an 8x8 Bayer matrix. It is the fastest, and a change in one part
+//|     of the image leaves the rest of the output alone, but it shows a regular cross-hatch texture"""
+//|
 MAKE_ENUM_VALUE(bitmaptools_dither_algorithm_type, dither_algorithm, Atkinson, DITHER_ALGORITHM_ATKINSON);
 MAKE_ENUM_VALUE(bitmaptools_dither_algorithm_type, dither_algorithm, FloydStenberg, DITHER_ALGORITHM_FLOYD_STENBERG);
+MAKE_ENUM_VALUE(bitmaptools_dither_algorithm_type, dither_algorithm, Bayer, DITHER_ALGORITHM_BAYER);
 
 MAKE_ENUM_MAP(bitmaptools_dither_algorithm) {
     MAKE_ENUM_MAP_ENTRY(dither_algorithm, Atkinson),
     MAKE_ENUM_MAP_ENTRY(dither_algorithm, FloydStenberg),
+    MAKE_ENUM_MAP_ENTRY(dither_algorithm, Bayer),
 };
 static MP_DEFINE_CONST_DICT(bitmaptools_dither_algorithm_locals_dict, bitmaptools_dither_algorithm_locals_table);
 
@@ -15,7 +15,7 @@
 #include "extmod/vfs_fat.h"
 
 typedef enum {
-    DITHER_ALGORITHM_ATKINSON, DITHER_ALGORITHM_FLOYD_STENBERG,
+    DITHER_ALGORITHM_ATKINSON, DITHER_ALGORITHM_FLOYD_STENBERG, DITHER_ALGORITHM_BAYER,
 } bitmaptools_dither_algorithm_t;
 
 extern const mp_obj_type_t bitmaptools_dither_algorithm_type;
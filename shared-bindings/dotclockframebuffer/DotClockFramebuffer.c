@@ -286,6 +286,17 @@ static void dotclockframebuffer_framebuffer_swapbuffers(mp_obj_t self_in, uint8_
     common_hal_dotclockframebuffer_framebuffer_refresh(self);
 }
 
+// Only write back the cache lines that displayio changed instead of the whole framebuffer.
+static void dotclockframebuffer_framebuffer_swapbuffers_spans(mp_obj_t self_in, uint8_t *dirty_row_bitmap, const framebuffer_dirty_span_t *dirty_spans) {
+    dotclockframebuffer_framebuffer_obj_t *self = (dotclockframebuffer_framebuffer_obj_t *)self_in;
+    int height = common_hal_dotclockframebuffer_framebuffer_get_height(self);
+    for (int y = 0; y < height; y++) {
+        if (dirty_row_bitmap[y / 8] & (1 << (y & 7))) {
+            common_hal_dotclockframebuffer_framebuffer_refresh_span(self, y, dirty_spans[y].x1, dirty_spans[y].x2);
+        }
+    }
+}
+
 static void dotclockframebuffer_framebuffer_deinit_proto(mp_obj_t self_in) {
     common_hal_dotclockframebuffer_framebuffer_deinit(self_in);
 }
@@ -347,6 +358,7 @@ static const framebuffer_p_t dotclockframebuffer_framebuffer_proto = {
     .get_bytes_per_cell = dotclockframebuffer_framebuffer_get_bytes_per_cell_proto,
     .get_native_frames_per_second = dotclockframebuffer_framebuffer_get_native_frames_per_second_proto,
     .swapbuffers = dotclockframebuffer_framebuffer_swapbuffers,
+    .swapbuffers_spans = dotclockframebuffer_framebuffer_swapbuffers_spans,
     .deinit = dotclockframebuffer_framebuffer_deinit_proto,
 };
 
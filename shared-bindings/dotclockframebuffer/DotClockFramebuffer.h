@@ -38,3 +38,5 @@ mp_int_t common_hal_dotclockframebuffer_framebuffer_get_refresh_rate(dotclockfra
 mp_int_t common_hal_dotclockframebuffer_framebuffer_get_row_stride(dotclockframebuffer_framebuffer_obj_t *self);
 mp_int_t common_hal_dotclockframebuffer_framebuffer_get_first_pixel_offset(dotclockframebuffer_framebuffer_obj_t *self);
 void common_hal_dotclockframebuffer_framebuffer_refresh(dotclockframebuffer_framebuffer_obj_t *self);
+// Refresh only pixels x1 up to x2 of row y.
+void common_hal_dotclockframebuffer_framebuffer_refresh_span(dotclockframebuffer_framebuffer_obj_t *self, int y, int x1, int x2);
@@ -12,7 +12,6 @@
 #include "py/binary.h"
 #include "py/objproperty.h"
 #include "py/runtime.h"
-#include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/util.h"
 
 //| from typing_extensions import Protocol  # for compat with python < 3.8
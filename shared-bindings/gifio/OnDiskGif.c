@@ -13,6 +13,9 @@
 #include "shared/runtime/context_manager_helpers.h"
 #include "shared-bindings/util.h"
 #include "shared-bindings/gifio/OnDiskGif.h"
+#if CIRCUITPY_FRAMEBUFFERIO
+#include "shared-bindings/framebufferio/FramebufferDisplay.h"
+#endif
 
 //| class OnDiskGif:
 //|     """Loads one frame of a GIF into memory at a time.
@@ -104,7 +107,7 @@
 static mp_obj_t gifio_ondiskgif_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
     enum { ARG_filename, ARG_use_palette, NUM_ARGS };
     static const mp_arg_t allowed_args[] = {
-        { MP_QSTR_filename, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_filename, MP_ARG_REQUIRED | MP_ARG_OBJ, {} },
         { MP_QSTR_use_palette, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
     };
     MP_STATIC_ASSERT(MP_ARRAY_SIZE(allowed_args) == NUM_ARGS);
@@ -204,16 +207,65 @@ MP_DEFINE_CONST_FUN_OBJ_1(gifio_ondiskgif_get_palette_obj, gifio_ondiskgif_obj_g
 MP_PROPERTY_GETTER(gifio_ondiskgif_palette_obj,
     (mp_obj_t)&gifio_ondiskgif_get_palette_obj);
 
-//|     def next_frame(self) -> float:
-//|         """Loads the next frame. Returns expected delay before the next frame in seconds."""
-static mp_obj_t gifio_ondiskgif_obj_next_frame(mp_obj_t self_in) {
-    gifio_ondiskgif_t *self = MP_OBJ_TO_PTR(self_in);
+//|     def next_frame(
+//|         self,
+//|         display: Optional[framebufferio.FramebufferDisplay] = None,
+//|         *,
+//|         x: int = 0,
+//|         y: int = 0,
+//|     ) -> float:
+//|         """Loads the next frame. Returns expected delay before the next frame in seconds.
+//|
+//|         Only the rectangle the frame covers is marked dirty in `bitmap`, so a display
+//|         only redraws the part of the image that changed.
+//|
+//|         With a ``display``, the frame is instead decoded straight into that display's
+//|         framebuffer, with the top left corner of the GIF at (``x``, ``y``), and only the
+//|         rows the frame covers are sent on to the display. `bitmap` is not updated. The
+//|         display must not be rotated and must use 16-bit color, and the GIF must not have
+//|         been opened with ``use_palette``. Anything the display itself redraws over the
+//|         GIF replaces it, so show an empty `displayio.Group` or turn off ``auto_refresh``:
+//|
+//|         .. code-block:: Python
+//|
+//|           display.root_group = displayio.Group()
+//|           while True:
+//|               time.sleep(odg.next_frame(display))
+//|
+//|         :param framebufferio.FramebufferDisplay display: The display to draw to, or `None` to
+//|             load the frame into `bitmap`
+//|         :param int x: Where the left edge of the GIF goes on the display
+//|         :param int y: Where the top edge of the GIF goes on the display
+//|         """
+static mp_obj_t gifio_ondiskgif_obj_next_frame(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_display, ARG_x, ARG_y };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_display, MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_x, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0} },
+        { MP_QSTR_y, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0} },
+    };
+    gifio_ondiskgif_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
     check_for_deinit(self);
-    return mp_obj_new_float((float)common_hal_gifio_ondiskgif_next_frame(self, true) / 1000);
+    uint32_t delay;
+    if (args[ARG_display].u_obj == mp_const_none) {
+        delay = common_hal_gifio_ondiskgif_next_frame(self, true);
+    } else {
+        #if CIRCUITPY_FRAMEBUFFERIO
+        framebufferio_framebufferdisplay_obj_t *display = mp_arg_validate_type(args[ARG_display].u_obj, &framebufferio_framebufferdisplay_type, MP_QSTR_display);
+        int x = mp_arg_validate_int_range(args[ARG_x].u_int, 0, common_hal_framebufferio_framebufferdisplay_get_width(display), MP_QSTR_x);
+        int y = mp_arg_validate_int_range(args[ARG_y].u_int, 0, common_hal_framebufferio_framebufferdisplay_get_height(display), MP_QSTR_y);
+        delay = common_hal_gifio_ondiskgif_next_frame_to_display(self, display, x, y);
+        #else
+        mp_arg_error_invalid(MP_QSTR_display);
+        #endif
+    }
+    return mp_obj_new_float((float)delay / 1000);
 }
 
-MP_DEFINE_CONST_FUN_OBJ_1(gifio_ondiskgif_next_frame_obj, gifio_ondiskgif_obj_next_frame);
+MP_DEFINE_CONST_FUN_OBJ_KW(gifio_ondiskgif_next_frame_obj, 1, gifio_ondiskgif_obj_next_frame);
 
 
 //|     duration: float
@@ -8,6 +8,9 @@
 
 #include "shared-module/gifio/OnDiskGif.h"
 #include "extmod/vfs_fat.h"
+#if CIRCUITPY_FRAMEBUFFERIO
+#include "shared-module/framebufferio/FramebufferDisplay.h"
+#endif
 
 extern const mp_obj_type_t gifio_ondiskgif_type;
 
@@ -21,6 +24,9 @@ mp_obj_t common_hal_gifio_ondiskgif_get_bitmap(gifio_ondiskgif_t *self);
 mp_obj_t common_hal_gifio_ondiskgif_get_palette(gifio_ondiskgif_t *self);
 uint16_t common_hal_gifio_ondiskgif_get_width(gifio_ondiskgif_t *self);
 uint32_t common_hal_gifio_ondiskgif_next_frame(gifio_ondiskgif_t *self, bool setDirty);
+#if CIRCUITPY_FRAMEBUFFERIO
+uint32_t common_hal_gifio_ondiskgif_next_frame_to_display(gifio_ondiskgif_t *self, framebufferio_framebufferdisplay_obj_t *display, int x, int y);
+#endif
 int32_t common_hal_gifio_ondiskgif_get_duration(gifio_ondiskgif_t *self);
 int32_t common_hal_gifio_ondiskgif_get_frame_count(gifio_ondiskgif_t *self);
 int32_t common_hal_gifio_ondiskgif_get_min_delay(gifio_ondiskgif_t *self);
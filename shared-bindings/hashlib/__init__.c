@@ -8,7 +8,9 @@
 
 #include "py/obj.h"
 #include "py/mpconfig.h"
+#include "py/mperrno.h"
 #include "py/runtime.h"
+#include "py/stream.h"
 #include "shared-bindings/hashlib/__init__.h"
 #include "shared-bindings/hashlib/Hash.h"
 
@@ -21,38 +23,160 @@
 //|     """Returns a Hash object setup for the named algorithm. Raises ValueError when the named
 //|        algorithm is unsupported.
 //|
+//|     Where the port's hashing library provides them, the algorithms are ``"md5"``, ``"sha1"``,
+//|     ``"sha224"``, ``"sha256"``, ``"sha384"`` and ``"sha512"``. Each also has a function of
+//|     the same name, such as `hashlib.sha256`, that takes the optional data.
+//|
 //|     :return: a hash object for the given algorithm
 //|     :rtype: hashlib.Hash"""
 //|     ...
 //|
+static mp_obj_t hashlib_make(const char *algorithm, mp_obj_t data) {
+    hashlib_hash_obj_t *self = mp_obj_malloc(hashlib_hash_obj_t, &hashlib_hash_type);
+
+    if (!common_hal_hashlib_new(self, algorithm)) {
+        mp_raise_ValueError(MP_ERROR_TEXT("Unsupported hash algorithm"));
+    }
+
+    if (data != mp_const_none) {
+        hashlib_hash_update(self, data);
+    }
+    return self;
+}
+
 static mp_obj_t hashlib_new(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     enum { ARG_name, ARG_data };
     static const mp_arg_t allowed_args[] = {
-        { MP_QSTR_name, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_name, MP_ARG_REQUIRED | MP_ARG_OBJ, {} },
         { MP_QSTR_data,  MP_ARG_OBJ, {.u_obj = mp_const_none} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
-    const char *algorithm = mp_obj_str_get_str(args[ARG_name].u_obj);
+    return hashlib_make(mp_obj_str_get_str(args[ARG_name].u_obj), args[ARG_data].u_obj);
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(hashlib_new_obj, 1, hashlib_new);
 
-    hashlib_hash_obj_t *self = mp_obj_malloc(hashlib_hash_obj_t, &hashlib_hash_type);
+#define HASHLIB_CONSTRUCTOR(name) \
+    static mp_obj_t hashlib_##name(size_t n_args, const mp_obj_t *args) { \
+        return hashlib_make(#name, n_args > 0 ? args[0] : mp_const_none); \
+    } \
+    static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(hashlib_##name##_obj, 0, 1, hashlib_##name);
 
-    if (!common_hal_hashlib_new(self, algorithm)) {
-        mp_raise_ValueError(MP_ERROR_TEXT("Unsupported hash algorithm"));
+//| def md5(data: bytes = b"") -> hashlib.Hash:
+//|     """Returns a Hash object for MD5, like ``hashlib.new("md5", data)``"""
+//|     ...
+//|
+HASHLIB_CONSTRUCTOR(md5)
+
+//| def sha1(data: bytes = b"") -> hashlib.Hash:
+//|     """Returns a Hash object for SHA-1, like ``hashlib.new("sha1", data)``"""
+//|     ...
+//|
+HASHLIB_CONSTRUCTOR(sha1)
+
+//| def sha224(data: bytes = b"") -> hashlib.Hash:
+//|     """Returns a Hash object for SHA-224, like ``hashlib.new("sha224", data)``"""
+//|     ...
+//|
+HASHLIB_CONSTRUCTOR(sha224)
+
+//| def sha256(data: bytes = b"") -> hashlib.Hash:
+//|     """Returns a Hash object for SHA-256, like ``hashlib.new("sha256", data)``"""
+//|     ...
+//|
+HASHLIB_CONSTRUCTOR(sha256)
+
+//| def sha384(data: bytes = b"") -> hashlib.Hash:
+//|     """Returns a Hash object for SHA-384, like ``hashlib.new("sha384", data)``"""
+//|     ...
+//|
+HASHLIB_CONSTRUCTOR(sha384)
+
+//| def sha512(data: bytes = b"") -> hashlib.Hash:
+//|     """Returns a Hash object for SHA-512, like ``hashlib.new("sha512", data)``"""
+//|     ...
+//|
+HASHLIB_CONSTRUCTOR(sha512)
+
+// Read this much of the file at a time. Reads of whole sectors go straight from the disk into
+// the buffer, so a larger buffer makes fewer, larger reads.
+#define FILE_DIGEST_BUFFER_SIZE (4096)
+// When the heap is too fragmented for that, read this much at a time instead
+#define FILE_DIGEST_SMALL_BUFFER_SIZE (256)
+
+//| def file_digest(fileobj: BinaryIO, digest: str) -> hashlib.Hash:
+//|     """Returns a Hash object for the named algorithm, updated with the rest of the file.
+//|
+//|     The file is read a few kilobytes at a time into one buffer that is reused for every read,
+//|     so large files can be hashed quickly and without making a bytes object per read.
+//|
+//|     :param BinaryIO fileobj: a file opened for reading in binary mode, or another object
+//|       with a ``readinto`` method
+//|     :param str digest: the name of the algorithm, as for `hashlib.new`
+//|     :return: a hash object for the given algorithm
+//|     :rtype: hashlib.Hash"""
+//|     ...
+//|
+static mp_obj_t hashlib_file_digest(mp_obj_t fileobj, mp_obj_t digest) {
+    hashlib_hash_obj_t *self = MP_OBJ_TO_PTR(hashlib_make(mp_obj_str_get_str(digest), mp_const_none));
+
+    size_t size = FILE_DIGEST_BUFFER_SIZE;
+    uint8_t *buffer = m_malloc_maybe(size);
+    if (buffer == NULL) {
+        size = FILE_DIGEST_SMALL_BUFFER_SIZE;
+        buffer = m_malloc(size);
     }
 
-    if (args[ARG_data].u_obj != mp_const_none) {
-        hashlib_hash_update(self, args[ARG_data].u_obj);
+    const mp_stream_p_t *proto = mp_get_stream(fileobj);
+    if (proto && proto->read && !proto->is_text) {
+        while (true) {
+            int errcode;
+            mp_uint_t n = proto->read(fileobj, buffer, size, &errcode);
+            if (n == MP_STREAM_ERROR) {
+                mp_raise_OSError(errcode);
+            }
+            if (n == 0) {
+                break;
+            }
+            common_hal_hashlib_hash_update(self, buffer, n);
+        }
+        m_del(uint8_t, buffer, size);
+    } else {
+        // Any other object with readinto, reading into a bytearray that shares the buffer.
+        // readinto may keep a reference to the bytearray, so the buffer is left for the
+        // garbage collector to free.
+        mp_obj_t dest[3];
+        mp_load_method(fileobj, MP_QSTR_readinto, dest);
+        dest[2] = mp_obj_new_bytearray_by_ref(size, buffer);
+        while (true) {
+            mp_obj_t n_obj = mp_call_method_n_kw(1, 0, dest);
+            if (n_obj == mp_const_none) {
+                mp_raise_OSError(MP_EAGAIN);
+            }
+            size_t n = mp_obj_get_int(n_obj);
+            if (n == 0) {
+                break;
+            }
+            common_hal_hashlib_hash_update(self, buffer, MIN(n, size));
+        }
     }
-    return self;
+
+    return MP_OBJ_FROM_PTR(self);
 }
-static MP_DEFINE_CONST_FUN_OBJ_KW(hashlib_new_obj, 1, hashlib_new);
+static MP_DEFINE_CONST_FUN_OBJ_2(hashlib_file_digest_obj, hashlib_file_digest);
 
 static const mp_rom_map_elem_t hashlib_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_hashlib) },
 
     { MP_ROM_QSTR(MP_QSTR_new), MP_ROM_PTR(&hashlib_new_obj) },
+    { MP_ROM_QSTR(MP_QSTR_file_digest), MP_ROM_PTR(&hashlib_file_digest_obj) },
+    { MP_ROM_QSTR(MP_QSTR_md5), MP_ROM_PTR(&hashlib_md5_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sha1), MP_ROM_PTR(&hashlib_sha1_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sha224), MP_ROM_PTR(&hashlib_sha224_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sha256), MP_ROM_PTR(&hashlib_sha256_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sha384), MP_ROM_PTR(&hashlib_sha384_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sha512), MP_ROM_PTR(&hashlib_sha512_obj) },
 
     // Hash is deliberately omitted here because CPython doesn't expose the
     // object on `hashlib` only the internal `_hashlib`.
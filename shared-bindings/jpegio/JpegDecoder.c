@@ -105,6 +105,11 @@ MP_DEFINE_CONST_FUN_OBJ_2(jpegio_jpegdecoder_open_obj, jpegio_jpegdecoder_open);
 //|         The image is optionally downscaled by a factor of ``2**scale``.
 //|         Scaling by a factor of 8 (scale=3) is particularly efficient in terms of decoding time.
 //|
+//|         Only the part of the image inside the ``x1``, ``y1``, ``x2``, ``y2`` box that fits in the
+//|         bitmap is fully decoded, and decoding stops below it, so small crops are much faster
+//|         than the whole image. Images saved with restart markers crop faster still, because
+//|         whole runs of data outside the box are skipped without decoding.
+//|
 //|         The remaining parameters are as for `bitmaptools.blit`.
 //|         Because JPEG is a lossy data format, chroma keying based on the "source
 //|         index" is not reliable, because the same original RGB value might end
@@ -50,16 +50,29 @@ static void verify_buffer_size(qrio_qrdecoder_obj_t *self, mp_obj_t *buffer, siz
 }
 
 //|     def decode(
-//|         self, buffer: ReadableBuffer, pixel_policy: PixelPolicy = PixelPolicy.EVERY_BYTE
+//|         self,
+//|         buffer: ReadableBuffer,
+//|         pixel_policy: PixelPolicy = PixelPolicy.EVERY_BYTE,
+//|         *,
+//|         subsample: int = 1,
+//|         track: bool = False,
 //|     ) -> List[QRInfo]:
-//|         """Decode zero or more QR codes from the given image.  The size of the buffer must be at least ``length``×``width`` bytes for `EVERY_BYTE`, and 2×``length``×``width`` bytes for `EVEN_BYTES` or `ODD_BYTES`."""
+//|         """Decode zero or more QR codes from the given image.  The size of the buffer must be at least ``length``×``width`` bytes for `EVERY_BYTE`, and 2×``length``×``width`` bytes for `EVEN_BYTES` or `ODD_BYTES`.
+//|
+//|         :param int subsample: Look for codes in a copy of the image shrunk by this factor, from 1 to 4, and then decode them from just the region around them at full resolution. This is faster, but only finds codes whose squares are at least about twice ``subsample`` pixels across.
+//|         :param bool track: Look first in the region where codes were found by the last call, and only search the whole image when there are none there any more. This suits a camera held on a code, but new codes elsewhere in the image are not noticed while the old ones stay in view.
+//|
+//|         The decoder keeps a working copy of the image, taking about a byte per pixel. While ``subsample`` is more than 1, that copy is of the shrunk image instead. Once ``subsample`` or ``track`` is used, the decoder also keeps a second copy of the region around the codes, of up to the size of the whole image.
+//|         """
 static mp_obj_t qrio_qrdecoder_decode(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     qrio_qrdecoder_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
 
-    enum { ARG_buffer, ARG_pixel_policy };
+    enum { ARG_buffer, ARG_pixel_policy, ARG_subsample, ARG_track };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_buffer, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_int = 0} },
         { MP_QSTR_pixel_policy, MP_ARG_OBJ, {.u_obj = MP_ROM_PTR((mp_obj_t *)&qrio_pixel_policy_EVERY_BYTE_obj)} },
+        { MP_QSTR_subsample, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1} },
+        { MP_QSTR_track, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -68,23 +81,31 @@ static mp_obj_t qrio_qrdecoder_decode(size_t n_args, const mp_obj_t *pos_args, m
     mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_READ);
     qrio_pixel_policy_t policy = cp_enum_value(&qrio_pixel_policy_type, args[ARG_pixel_policy].u_obj, MP_QSTR_pixel_policy);
     verify_buffer_size(self, &args[ARG_buffer].u_obj, bufinfo.len, policy);
+    int subsample = mp_arg_validate_int_range(args[ARG_subsample].u_int, 1, 4, MP_QSTR_subsample);
 
-    return shared_module_qrio_qrdecoder_decode(self, &bufinfo, policy);
+    return shared_module_qrio_qrdecoder_decode(self, &bufinfo, policy, subsample, args[ARG_track].u_bool);
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(qrio_qrdecoder_decode_obj, 1, qrio_qrdecoder_decode);
 
 
 //|     def find(
-//|         self, buffer: ReadableBuffer, pixel_policy: PixelPolicy = PixelPolicy.EVERY_BYTE
+//|         self,
+//|         buffer: ReadableBuffer,
+//|         pixel_policy: PixelPolicy = PixelPolicy.EVERY_BYTE,
+//|         *,
+//|         subsample: int = 1,
+//|         track: bool = False,
 //|     ) -> List[QRPosition]:
-//|         """Find all visible QR codes from the given image.  The size of the buffer must be at least ``length``×``width`` bytes for `EVERY_BYTE`, and 2×``length``×``width`` bytes for `EVEN_BYTES` or `ODD_BYTES`."""
+//|         """Find all visible QR codes from the given image.  The size of the buffer must be at least ``length``×``width`` bytes for `EVERY_BYTE`, and 2×``length``×``width`` bytes for `EVEN_BYTES` or `ODD_BYTES`. ``subsample`` and ``track`` work as for `decode`, and positions are always in full resolution pixels."""
 static mp_obj_t qrio_qrdecoder_find(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     qrio_qrdecoder_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
 
-    enum { ARG_buffer, ARG_pixel_policy };
+    enum { ARG_buffer, ARG_pixel_policy, ARG_subsample, ARG_track };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_buffer, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_int = 0} },
         { MP_QSTR_pixel_policy, MP_ARG_OBJ, {.u_obj = MP_ROM_PTR((mp_obj_t *)&qrio_pixel_policy_EVERY_BYTE_obj)} },
+        { MP_QSTR_subsample, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1} },
+        { MP_QSTR_track, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -93,8 +114,9 @@ static mp_obj_t qrio_qrdecoder_find(size_t n_args, const mp_obj_t *pos_args, mp_
     mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_READ);
     qrio_pixel_policy_t policy = cp_enum_value(&qrio_pixel_policy_type, args[ARG_pixel_policy].u_obj, MP_QSTR_pixel_policy);
     verify_buffer_size(self, &args[ARG_buffer].u_obj, bufinfo.len, policy);
+    int subsample = mp_arg_validate_int_range(args[ARG_subsample].u_int, 1, 4, MP_QSTR_subsample);
 
-    return shared_module_qrio_qrdecoder_find(self, &bufinfo, policy);
+    return shared_module_qrio_qrdecoder_find(self, &bufinfo, policy, subsample, args[ARG_track].u_bool);
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(qrio_qrdecoder_find_obj, 1, qrio_qrdecoder_find);
 
@@ -0,0 +1,140 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "py/enum.h"
+#include "py/obj.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/util.h"
+#include "shared-bindings/synthio/BlockBiquad.h"
+#include "shared-module/synthio/BlockBiquad.h"
+
+MAKE_ENUM_VALUE(synthio_filter_mode_type, filter_mode, LOW_PASS, SYNTHIO_LOW_PASS);
+MAKE_ENUM_VALUE(synthio_filter_mode_type, filter_mode, HIGH_PASS, SYNTHIO_HIGH_PASS);
+MAKE_ENUM_VALUE(synthio_filter_mode_type, filter_mode, BAND_PASS, SYNTHIO_BAND_PASS);
+
+//| class FilterMode:
+//|     """The type of filter a `BlockBiquad` implements"""
+//|
+//|     LOW_PASS: FilterMode
+//|     """A low-pass filter"""
+//|     HIGH_PASS: FilterMode
+//|     """A high-pass filter"""
+//|     BAND_PASS: FilterMode
+//|     """A band-pass filter"""
+//|
+MAKE_ENUM_MAP(synthio_filter_mode) {
+    MAKE_ENUM_MAP_ENTRY(filter_mode, LOW_PASS),
+    MAKE_ENUM_MAP_ENTRY(filter_mode, HIGH_PASS),
+    MAKE_ENUM_MAP_ENTRY(filter_mode, BAND_PASS),
+};
+
+static MP_DEFINE_CONST_DICT(synthio_filter_mode_locals_dict, synthio_filter_mode_locals_table);
+MAKE_PRINTER(synthio, synthio_filter_mode);
+MAKE_ENUM_TYPE(synthio, FilterMode, synthio_filter_mode);
+
+//| class BlockBiquad:
+//|     """A filter whose cutoff frequency and Q can be driven by blocks
+//|
+//|     Use it as a `Note.filter` to sweep a filter from an `LFO` or `Math` block.
+//|     The coefficients are recomputed only when `frequency` or `Q` change, from
+//|     a table rather than trigonometric functions, and each change is ramped in
+//|     over the following 256 samples so that sweeps are smooth.
+//|
+//|     Using the same BlockBiquad in several notes is OK; each note keeps its own filter
+//|     state."""
+//|
+//|     def __init__(
+//|         self, mode: FilterMode, frequency: BlockInput, Q: BlockInput = 0.7071067811865475
+//|     ) -> None:
+//|         """Construct a biquad filter
+//|
+//|         :param FilterMode mode: The kind of filter
+//|         :param BlockInput frequency: The center frequency of the filter, in Hz
+//|         :param BlockInput Q: How peaked the response is at the center frequency"""
+static mp_obj_t synthio_block_biquad_make_new(const mp_obj_type_t *type_in, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_mode, ARG_frequency, ARG_Q };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_mode, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = MP_OBJ_NULL } },
+        { MP_QSTR_frequency, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = MP_OBJ_NULL } },
+        { MP_QSTR_Q, MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL } },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    synthio_filter_mode_t mode = cp_enum_value(&synthio_filter_mode_type, args[ARG_mode].u_obj, MP_QSTR_mode);
+    mp_obj_t Q = args[ARG_Q].u_obj;
+    if (Q == MP_OBJ_NULL) {
+        Q = mp_obj_new_float(MICROPY_FLOAT_CONST(0.7071067811865475));
+    }
+
+    synthio_block_biquad_t *self = mp_obj_malloc(synthio_block_biquad_t, &synthio_block_biquad_type);
+    common_hal_synthio_block_biquad_construct(self, mode, args[ARG_frequency].u_obj, Q);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     mode: FilterMode
+//|     """The kind of filter (read-only)"""
+static mp_obj_t synthio_block_biquad_get_mode(mp_obj_t self_in) {
+    synthio_block_biquad_t *self = MP_OBJ_TO_PTR(self_in);
+    return cp_enum_find(&synthio_filter_mode_type, common_hal_synthio_block_biquad_get_mode(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_block_biquad_get_mode_obj, synthio_block_biquad_get_mode);
+
+MP_PROPERTY_GETTER(synthio_block_biquad_mode_obj,
+    (mp_obj_t)&synthio_block_biquad_get_mode_obj);
+
+//|     frequency: BlockInput
+//|     """The center frequency of the filter, in Hz"""
+static mp_obj_t synthio_block_biquad_get_frequency(mp_obj_t self_in) {
+    synthio_block_biquad_t *self = MP_OBJ_TO_PTR(self_in);
+    return common_hal_synthio_block_biquad_get_frequency(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_block_biquad_get_frequency_obj, synthio_block_biquad_get_frequency);
+
+static mp_obj_t synthio_block_biquad_set_frequency(mp_obj_t self_in, mp_obj_t arg) {
+    synthio_block_biquad_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_synthio_block_biquad_set_frequency(self, arg);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(synthio_block_biquad_set_frequency_obj, synthio_block_biquad_set_frequency);
+MP_PROPERTY_GETSET(synthio_block_biquad_frequency_obj,
+    (mp_obj_t)&synthio_block_biquad_get_frequency_obj,
+    (mp_obj_t)&synthio_block_biquad_set_frequency_obj);
+
+//|     Q: BlockInput
+//|     """How peaked the response is at the center frequency"""
+//|
+static mp_obj_t synthio_block_biquad_get_Q(mp_obj_t self_in) {
+    synthio_block_biquad_t *self = MP_OBJ_TO_PTR(self_in);
+    return common_hal_synthio_block_biquad_get_Q(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_block_biquad_get_Q_obj, synthio_block_biquad_get_Q);
+
+static mp_obj_t synthio_block_biquad_set_Q(mp_obj_t self_in, mp_obj_t arg) {
+    synthio_block_biquad_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_synthio_block_biquad_set_Q(self, arg);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(synthio_block_biquad_set_Q_obj, synthio_block_biquad_set_Q);
+MP_PROPERTY_GETSET(synthio_block_biquad_Q_obj,
+    (mp_obj_t)&synthio_block_biquad_get_Q_obj,
+    (mp_obj_t)&synthio_block_biquad_set_Q_obj);
+
+static const mp_rom_map_elem_t synthio_block_biquad_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_mode), MP_ROM_PTR(&synthio_block_biquad_mode_obj) },
+    { MP_ROM_QSTR(MP_QSTR_frequency), MP_ROM_PTR(&synthio_block_biquad_frequency_obj) },
+    { MP_ROM_QSTR(MP_QSTR_Q), MP_ROM_PTR(&synthio_block_biquad_Q_obj) },
+};
+static MP_DEFINE_CONST_DICT(synthio_block_biquad_locals_dict, synthio_block_biquad_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    synthio_block_biquad_type,
+    MP_QSTR_BlockBiquad,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, synthio_block_biquad_make_new,
+    locals_dict, &synthio_block_biquad_locals_dict
+    );
@@ -0,0 +1,29 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+
+typedef enum {
+    SYNTHIO_LOW_PASS,
+    SYNTHIO_HIGH_PASS,
+    SYNTHIO_BAND_PASS,
+} synthio_filter_mode_t;
+
+typedef struct synthio_block_biquad synthio_block_biquad_t;
+extern const mp_obj_type_t synthio_block_biquad_type;
+extern const mp_obj_type_t synthio_filter_mode_type;
+
+void common_hal_synthio_block_biquad_construct(synthio_block_biquad_t *self, synthio_filter_mode_t mode, mp_obj_t frequency, mp_obj_t Q);
+
+synthio_filter_mode_t common_hal_synthio_block_biquad_get_mode(synthio_block_biquad_t *self);
+
+mp_obj_t common_hal_synthio_block_biquad_get_frequency(synthio_block_biquad_t *self);
+void common_hal_synthio_block_biquad_set_frequency(synthio_block_biquad_t *self, mp_obj_t frequency);
+
+mp_obj_t common_hal_synthio_block_biquad_get_Q(synthio_block_biquad_t *self);
+void common_hal_synthio_block_biquad_set_Q(synthio_block_biquad_t *self, mp_obj_t Q);
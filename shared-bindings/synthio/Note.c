@@ -42,7 +42,7 @@ static const mp_arg_t note_properties[] = {
 //|         envelope: Optional[Envelope] = None,
 //|         amplitude: BlockInput = 0.0,
 //|         bend: BlockInput = 0.0,
-//|         filter: Optional[Biquad] = None,
+//|         filter: Optional[Biquad | BlockBiquad] = None,
 //|         ring_frequency: float = 0.0,
 //|         ring_bend: float = 0.0,
 //|         ring_waveform: Optional[ReadableBuffer] = None,
@@ -85,12 +85,15 @@ MP_PROPERTY_GETSET(synthio_note_frequency_obj,
     (mp_obj_t)&synthio_note_get_frequency_obj,
     (mp_obj_t)&synthio_note_set_frequency_obj);
 
-//|     filter: Optional[Biquad]
+//|     filter: Optional[Biquad | BlockBiquad]
 //|     """If not None, the output of this Note is filtered according to the provided coefficients.
 //|
 //|     Construct an appropriate filter by calling a filter-making method on the
 //|     `Synthesizer` object where you plan to play the note, as filter coefficients depend
-//|     on the sample rate"""
+//|     on the sample rate. To sweep the filter, use a `BlockBiquad` instead.
+//|
+//|     When the filter changes while the note plays, the new coefficients are ramped in
+//|     over the next 256 samples."""
 static mp_obj_t synthio_note_get_filter(mp_obj_t self_in) {
     synthio_note_obj_t *self = MP_OBJ_TO_PTR(self_in);
     return common_hal_synthio_note_get_filter_obj(self);
@@ -25,6 +25,39 @@
 //| LFOOrLFOSequence = Union["LFO", Sequence["LFO"]]
 //| """An LFO or a sequence of LFOs"""
 //|
+
+MAKE_ENUM_VALUE(synthio_voice_stealing_type, voice_stealing, NONE, SYNTHIO_VOICE_STEALING_NONE);
+MAKE_ENUM_VALUE(synthio_voice_stealing_type, voice_stealing, OLDEST, SYNTHIO_VOICE_STEALING_OLDEST);
+MAKE_ENUM_VALUE(synthio_voice_stealing_type, voice_stealing, QUIETEST, SYNTHIO_VOICE_STEALING_QUIETEST);
+MAKE_ENUM_VALUE(synthio_voice_stealing_type, voice_stealing, SAME_NOTE, SYNTHIO_VOICE_STEALING_SAME_NOTE);
+
+//| class VoiceStealing:
+//|     """How a `Synthesizer` finds a voice for a new note when all of its voices are in use.
+//|
+//|     In every case a free voice is used if there is one, and then the quietest
+//|     voice whose note has been released."""
+//|
+//|     NONE: VoiceStealing
+//|     """The new note is not played"""
+//|     OLDEST: VoiceStealing
+//|     """The note that was pressed longest ago is cut off"""
+//|     QUIETEST: VoiceStealing
+//|     """The note with the lowest envelope level is cut off"""
+//|     SAME_NOTE: VoiceStealing
+//|     """A note with the same frequency as a sounding note replaces it, even if
+//|     there are free voices. Otherwise, like `OLDEST`."""
+//|
+MAKE_ENUM_MAP(synthio_voice_stealing) {
+    MAKE_ENUM_MAP_ENTRY(voice_stealing, NONE),
+    MAKE_ENUM_MAP_ENTRY(voice_stealing, OLDEST),
+    MAKE_ENUM_MAP_ENTRY(voice_stealing, QUIETEST),
+    MAKE_ENUM_MAP_ENTRY(voice_stealing, SAME_NOTE),
+};
+
+static MP_DEFINE_CONST_DICT(synthio_voice_stealing_locals_dict, synthio_voice_stealing_locals_table);
+MAKE_PRINTER(synthio, synthio_voice_stealing);
+MAKE_ENUM_TYPE(synthio, VoiceStealing, synthio_voice_stealing);
+
 //| class Synthesizer:
 //|     def __init__(
 //|         self,
@@ -33,6 +66,8 @@
 //|         channel_count: int = 1,
 //|         waveform: Optional[ReadableBuffer] = None,
 //|         envelope: Optional[Envelope] = None,
+//|         polyphony: Optional[int] = None,
+//|         voice_stealing: VoiceStealing = VoiceStealing.NONE,
 //|     ) -> None:
 //|         """Create a synthesizer object.
 //|
@@ -46,25 +81,34 @@
 //|         :param int channel_count: The number of output channels (1=mono, 2=stereo)
 //|         :param ReadableBuffer waveform: A single-cycle waveform. Default is a 50% duty cycle square wave. If specified, must be a ReadableBuffer of type 'h' (signed 16 bit)
 //|         :param Optional[Envelope] envelope: An object that defines the loudness of a note over time. The default envelope, `None` provides no ramping, voices turn instantly on and off.
+//|         :param Optional[int] polyphony: The number of notes that can sound at once, from 1 to 255. `None`, the default, uses `max_polyphony`, a number suited to the board. Each voice takes about 40 bytes of memory, and only sounding notes take processing time.
+//|         :param VoiceStealing voice_stealing: What to do when a note is pressed and all voices are in use
 //|         """
 static mp_obj_t synthio_synthesizer_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
-    enum { ARG_sample_rate, ARG_channel_count, ARG_waveform, ARG_envelope };
+    enum { ARG_sample_rate, ARG_channel_count, ARG_waveform, ARG_envelope, ARG_polyphony, ARG_voice_stealing };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_sample_rate, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 11025} },
         { MP_QSTR_channel_count, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1} },
         { MP_QSTR_waveform, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none } },
         { MP_QSTR_envelope, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none } },
+        { MP_QSTR_polyphony, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none } },
+        { MP_QSTR_voice_stealing, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_FROM_PTR(&voice_stealing_NONE_obj) } },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
+    mp_int_t polyphony = args[ARG_polyphony].u_obj == mp_const_none ?
+        CIRCUITPY_SYNTHIO_MAX_CHANNELS : mp_obj_get_int(args[ARG_polyphony].u_obj);
+
     synthio_synthesizer_obj_t *self = mp_obj_malloc(synthio_synthesizer_obj_t, &synthio_synthesizer_type);
 
     common_hal_synthio_synthesizer_construct(self,
         args[ARG_sample_rate].u_int,
         args[ARG_channel_count].u_int,
         args[ARG_waveform].u_obj,
-        args[ARG_envelope].u_obj);
+        args[ARG_envelope].u_obj,
+        polyphony,
+        cp_enum_value(&synthio_voice_stealing_type, args[ARG_voice_stealing].u_obj, MP_QSTR_voice_stealing));
 
     return MP_OBJ_FROM_PTR(self);
 }
@@ -284,8 +328,43 @@ MP_PROPERTY_GETTER(synthio_synthesizer_blocks_obj,
     (mp_obj_t)&synthio_synthesizer_get_blocks_obj);
 
 //|     max_polyphony: int
-//|     """Maximum polyphony of the synthesizer (read-only class property)"""
+//|     """Polyphony of a synthesizer created without ``polyphony`` (read-only class property)"""
+//|
+//|     polyphony: int
+//|     """The number of notes this synthesizer can sound at once (read-only)"""
+static mp_obj_t synthio_synthesizer_obj_get_polyphony(mp_obj_t self_in) {
+    synthio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_synthio_synthesizer_get_polyphony(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_synthesizer_get_polyphony_obj, synthio_synthesizer_obj_get_polyphony);
+
+MP_PROPERTY_GETTER(synthio_synthesizer_polyphony_obj,
+    (mp_obj_t)&synthio_synthesizer_get_polyphony_obj);
+
+//|     voice_stealing: VoiceStealing
+//|     """What to do when a note is pressed and all voices are in use"""
 //|
+static mp_obj_t synthio_synthesizer_obj_get_voice_stealing(mp_obj_t self_in) {
+    synthio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return cp_enum_find(&synthio_voice_stealing_type, common_hal_synthio_synthesizer_get_voice_stealing(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_synthesizer_get_voice_stealing_obj, synthio_synthesizer_obj_get_voice_stealing);
+
+static mp_obj_t synthio_synthesizer_obj_set_voice_stealing(mp_obj_t self_in, mp_obj_t voice_stealing) {
+    synthio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_synthio_synthesizer_set_voice_stealing(self,
+        cp_enum_value(&synthio_voice_stealing_type, voice_stealing, MP_QSTR_voice_stealing));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(synthio_synthesizer_set_voice_stealing_obj, synthio_synthesizer_obj_set_voice_stealing);
+
+MP_PROPERTY_GETSET(synthio_synthesizer_voice_stealing_obj,
+    (mp_obj_t)&synthio_synthesizer_get_voice_stealing_obj,
+    (mp_obj_t)&synthio_synthesizer_set_voice_stealing_obj);
+
 
 //|     def low_pass_filter(cls, frequency: float, q_factor: float = 0.7071067811865475) -> Biquad:
 //|         """Construct a low-pass filter with the given parameters.
@@ -414,6 +493,8 @@ static const mp_rom_map_elem_t synthio_synthesizer_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_envelope), MP_ROM_PTR(&synthio_synthesizer_envelope_obj) },
     { MP_ROM_QSTR(MP_QSTR_sample_rate), MP_ROM_PTR(&synthio_synthesizer_sample_rate_obj) },
     { MP_ROM_QSTR(MP_QSTR_max_polyphony), MP_ROM_INT(CIRCUITPY_SYNTHIO_MAX_CHANNELS) },
+    { MP_ROM_QSTR(MP_QSTR_polyphony), MP_ROM_PTR(&synthio_synthesizer_polyphony_obj) },
+    { MP_ROM_QSTR(MP_QSTR_voice_stealing), MP_ROM_PTR(&synthio_synthesizer_voice_stealing_obj) },
     { MP_ROM_QSTR(MP_QSTR_pressed), MP_ROM_PTR(&synthio_synthesizer_pressed_obj) },
     { MP_ROM_QSTR(MP_QSTR_note_info), MP_ROM_PTR(&synthio_synthesizer_note_info_obj) },
     { MP_ROM_QSTR(MP_QSTR_blocks), MP_ROM_PTR(&synthio_synthesizer_blocks_obj) },
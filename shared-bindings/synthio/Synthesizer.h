@@ -13,7 +13,7 @@ extern const mp_obj_type_t synthio_synthesizer_type;
 
 void common_hal_synthio_synthesizer_construct(synthio_synthesizer_obj_t *self,
     uint32_t sample_rate, int channel_count, mp_obj_t waveform_obj,
-    mp_obj_t envelope_obj);
+    mp_obj_t envelope_obj, int polyphony, synthio_voice_stealing_t voice_stealing);
 void common_hal_synthio_synthesizer_deinit(synthio_synthesizer_obj_t *self);
 bool common_hal_synthio_synthesizer_deinited(synthio_synthesizer_obj_t *self);
 uint32_t common_hal_synthio_synthesizer_get_sample_rate(synthio_synthesizer_obj_t *self);
@@ -26,3 +26,6 @@ void common_hal_synthio_synthesizer_release_all(synthio_synthesizer_obj_t *self)
 mp_obj_t common_hal_synthio_synthesizer_get_pressed_notes(synthio_synthesizer_obj_t *self);
 mp_obj_t common_hal_synthio_synthesizer_get_blocks(synthio_synthesizer_obj_t *self);
 envelope_state_e common_hal_synthio_synthesizer_note_info(synthio_synthesizer_obj_t *self, mp_obj_t note, mp_float_t *vol_out);
+mp_int_t common_hal_synthio_synthesizer_get_polyphony(synthio_synthesizer_obj_t *self);
+synthio_voice_stealing_t common_hal_synthio_synthesizer_get_voice_stealing(synthio_synthesizer_obj_t *self);
+void common_hal_synthio_synthesizer_set_voice_stealing(synthio_synthesizer_obj_t *self, synthio_voice_stealing_t voice_stealing);
@@ -0,0 +1,96 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "py/obj.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/synthio/Wavetable.h"
+#include "shared-module/synthio/Wavetable.h"
+
+//| class Wavetable:
+//|     """A waveform prepared for playback without aliasing
+//|
+//|     A plain waveform is played by taking the nearest sample, so it needs to be long to sound
+//|     smooth, and its upper harmonics fold back into audible noise on high notes. A Wavetable
+//|     holds copies of one cycle of the waveform with fewer and fewer harmonics, one copy per
+//|     octave. A note plays the copy with the most harmonics that are all below half the sample
+//|     rate, interpolating between its samples, so even small waveforms sound clean at any
+//|     pitch.
+//|
+//|     Use a Wavetable anywhere a waveform is accepted: as a `Note.waveform`,
+//|     `Note.ring_waveform` or the `Synthesizer`'s waveform. The whole table is one cycle;
+//|     loop points do not apply to it. Elsewhere, for instance in an `LFO`, it acts like the
+//|     buffer of the first copy.
+//|
+//|     The copies are made once, when the Wavetable is constructed, and take about three times
+//|     as much memory as the waveform, or as a 256-sample waveform if it is shorter."""
+//|
+//|     def __init__(self, waveform: ReadableBuffer) -> None:
+//|         """Construct a Wavetable
+//|
+//|         :param ReadableBuffer waveform: One cycle of the waveform, with elements of type ``'h'``.
+//|           Each sample is held for an equal share of the cycle, as when it is played
+//|           directly, so a short waveform such as the default square wave keeps its
+//|           character. Later changes to the waveform do not affect the Wavetable."""
+static mp_obj_t synthio_wavetable_make_new(const mp_obj_type_t *type_in, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_waveform };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_waveform, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = MP_OBJ_NULL } },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    synthio_wavetable_t *self = mp_obj_malloc(synthio_wavetable_t, &synthio_wavetable_type);
+    common_hal_synthio_wavetable_construct(self, args[ARG_waveform].u_obj);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     waveform: ReadableBuffer
+//|     """The waveform the Wavetable was made from (read-only)"""
+static mp_obj_t synthio_wavetable_get_waveform(mp_obj_t self_in) {
+    synthio_wavetable_t *self = MP_OBJ_TO_PTR(self_in);
+    return common_hal_synthio_wavetable_get_waveform_obj(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_wavetable_get_waveform_obj, synthio_wavetable_get_waveform);
+
+MP_PROPERTY_GETTER(synthio_wavetable_waveform_obj,
+    (mp_obj_t)&synthio_wavetable_get_waveform_obj);
+
+//|     levels: int
+//|     """The number of band-limited copies of the waveform (read-only)"""
+//|
+static mp_obj_t synthio_wavetable_get_levels(mp_obj_t self_in) {
+    synthio_wavetable_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_synthio_wavetable_get_levels(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_wavetable_get_levels_obj, synthio_wavetable_get_levels);
+
+MP_PROPERTY_GETTER(synthio_wavetable_levels_obj,
+    (mp_obj_t)&synthio_wavetable_get_levels_obj);
+
+static mp_int_t synthio_wavetable_get_buffer(mp_obj_t self_in, mp_buffer_info_t *bufinfo, mp_uint_t flags) {
+    synthio_wavetable_t *self = MP_OBJ_TO_PTR(self_in);
+    if (flags & MP_BUFFER_WRITE) {
+        return 1;
+    }
+    common_hal_synthio_wavetable_get_buffer(self, bufinfo);
+    return 0;
+}
+
+static const mp_rom_map_elem_t synthio_wavetable_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_waveform), MP_ROM_PTR(&synthio_wavetable_waveform_obj) },
+    { MP_ROM_QSTR(MP_QSTR_levels), MP_ROM_PTR(&synthio_wavetable_levels_obj) },
+};
+static MP_DEFINE_CONST_DICT(synthio_wavetable_locals_dict, synthio_wavetable_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    synthio_wavetable_type,
+    MP_QSTR_Wavetable,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, synthio_wavetable_make_new,
+    locals_dict, &synthio_wavetable_locals_dict,
+    buffer, synthio_wavetable_get_buffer
+    );
@@ -0,0 +1,17 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+
+typedef struct synthio_wavetable synthio_wavetable_t;
+extern const mp_obj_type_t synthio_wavetable_type;
+
+void common_hal_synthio_wavetable_construct(synthio_wavetable_t *self, mp_obj_t waveform_obj);
+mp_obj_t common_hal_synthio_wavetable_get_waveform_obj(synthio_wavetable_t *self);
+mp_int_t common_hal_synthio_wavetable_get_levels(synthio_wavetable_t *self);
+void common_hal_synthio_wavetable_get_buffer(synthio_wavetable_t *self, mp_buffer_info_t *bufinfo);
@@ -20,9 +20,14 @@ typedef enum synthio_bend_mode_e {
     SYNTHIO_BEND_MODE_STATIC, SYNTHIO_BEND_MODE_VIBRATO, SYNTHIO_BEND_MODE_SWEEP, SYNTHIO_BEND_MODE_SWEEP_IN
 } synthio_bend_mode_t;
 
+typedef enum synthio_voice_stealing_e {
+    SYNTHIO_VOICE_STEALING_NONE, SYNTHIO_VOICE_STEALING_OLDEST, SYNTHIO_VOICE_STEALING_QUIETEST, SYNTHIO_VOICE_STEALING_SAME_NOTE
+} synthio_voice_stealing_t;
+
 extern const mp_obj_type_t synthio_note_state_type;
 extern const cp_enum_obj_t bend_mode_VIBRATO_obj;
 extern const mp_obj_type_t synthio_bend_mode_type;
+extern const mp_obj_type_t synthio_voice_stealing_type;
 typedef struct synthio_synth synthio_synth_t;
 extern int16_t shared_bindings_synthio_square_wave[];
 extern const mp_obj_namedtuple_type_t synthio_envelope_type_obj;
@@ -49,8 +49,8 @@
 static mp_obj_t terminalio_terminal_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
     enum { ARG_scroll_area, ARG_font, ARG_status_bar };
     static const mp_arg_t allowed_args[] = {
-        { MP_QSTR_scroll_area, MP_ARG_REQUIRED | MP_ARG_OBJ },
-        { MP_QSTR_font, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_scroll_area, MP_ARG_REQUIRED | MP_ARG_OBJ, {} },
+        { MP_QSTR_font, MP_ARG_REQUIRED | MP_ARG_OBJ, {} },
         { MP_QSTR_status_bar, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_obj = mp_const_none } },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
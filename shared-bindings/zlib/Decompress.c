@@ -0,0 +1,107 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "py/obj.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/zlib/Decompress.h"
+
+//| class Decompress:
+//|     """Decompress a stream that arrives in pieces
+//|
+//|     Only the stream's window of recent output is kept between pieces, so large data can be
+//|     decompressed as it is read from a file or the network without holding all of it."""
+//|
+//|     def __init__(self, wbits: Optional[int] = 0) -> None:
+//|         """Make a Decompress object. `zlib.decompressobj` does the same.
+//|
+//|         :param int wbits: DEFLATE dictionary window size used during compression, as for
+//|           `zlib.decompress`. Up to 32kB is needed for the window."""
+static mp_obj_t zlib_decompress_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_wbits };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_wbits, MP_ARG_INT, {.u_int = 0} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    zlib_decompress_obj_t *self = mp_obj_malloc(zlib_decompress_obj_t, &zlib_decompress_type);
+    common_hal_zlib_decompress_construct(self, args[ARG_wbits].u_int);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def decompress(self, data: ReadableBuffer, max_length: int = 0) -> bytes:
+//|         """Decompress *data* and return as much output as can be decoded so far. Input
+//|         that can't be decoded yet is kept for the next call.
+//|
+//|         :param ReadableBuffer data: the next piece of the stream
+//|         :param int max_length: if not 0, return at most this many bytes. The rest is
+//|           returned by later calls, which may pass empty *data*."""
+//|         ...
+static mp_obj_t zlib_decompress_decompress(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_data, ARG_max_length };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_data, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_max_length, MP_ARG_INT, {.u_int = 0} },
+    };
+    zlib_decompress_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_data].u_obj, &bufinfo, MP_BUFFER_READ);
+    mp_int_t max_length = mp_arg_validate_int_min(args[ARG_max_length].u_int, 0, MP_QSTR_max_length);
+    return common_hal_zlib_decompress_decompress(self, bufinfo.buf, bufinfo.len, max_length);
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(zlib_decompress_decompress_obj, 1, zlib_decompress_decompress);
+
+//|     def flush(self) -> bytes:
+//|         """Return the output that is left from the input given so far"""
+//|         ...
+static mp_obj_t zlib_decompress_flush(mp_obj_t self_in) {
+    zlib_decompress_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return common_hal_zlib_decompress_decompress(self, NULL, 0, 0);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(zlib_decompress_flush_obj, zlib_decompress_flush);
+
+//|     eof: bool
+//|     """True once the end of the stream has been decompressed (read-only)"""
+static mp_obj_t zlib_decompress_get_eof(mp_obj_t self_in) {
+    zlib_decompress_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_bool(common_hal_zlib_decompress_get_eof(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(zlib_decompress_get_eof_obj, zlib_decompress_get_eof);
+
+MP_PROPERTY_GETTER(zlib_decompress_eof_obj,
+    (mp_obj_t)&zlib_decompress_get_eof_obj);
+
+//|     unused_data: bytes
+//|     """The data given after the end of the stream (read-only)"""
+//|
+static mp_obj_t zlib_decompress_get_unused_data(mp_obj_t self_in) {
+    zlib_decompress_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return common_hal_zlib_decompress_get_unused_data(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(zlib_decompress_get_unused_data_obj, zlib_decompress_get_unused_data);
+
+MP_PROPERTY_GETTER(zlib_decompress_unused_data_obj,
+    (mp_obj_t)&zlib_decompress_get_unused_data_obj);
+
+static const mp_rom_map_elem_t zlib_decompress_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_decompress), MP_ROM_PTR(&zlib_decompress_decompress_obj) },
+    { MP_ROM_QSTR(MP_QSTR_flush), MP_ROM_PTR(&zlib_decompress_flush_obj) },
+    { MP_ROM_QSTR(MP_QSTR_eof), MP_ROM_PTR(&zlib_decompress_eof_obj) },
+    { MP_ROM_QSTR(MP_QSTR_unused_data), MP_ROM_PTR(&zlib_decompress_unused_data_obj) },
+};
+static MP_DEFINE_CONST_DICT(zlib_decompress_locals_dict, zlib_decompress_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    zlib_decompress_type,
+    MP_QSTR_Decompress,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, zlib_decompress_make_new,
+    locals_dict, &zlib_decompress_locals_dict
+    );
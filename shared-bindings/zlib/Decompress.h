@@ -0,0 +1,16 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-module/zlib/Decompress.h"
+
+extern const mp_obj_type_t zlib_decompress_type;
+
+void common_hal_zlib_decompress_construct(zlib_decompress_obj_t *self, mp_int_t wbits);
+mp_obj_t common_hal_zlib_decompress_decompress(zlib_decompress_obj_t *self, const byte *data, size_t len, size_t max_length);
+bool common_hal_zlib_decompress_get_eof(zlib_decompress_obj_t *self);
+mp_obj_t common_hal_zlib_decompress_get_unused_data(zlib_decompress_obj_t *self);
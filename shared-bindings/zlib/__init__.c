@@ -18,6 +18,7 @@
 #include "py/parsenum.h"
 
 #include "shared-bindings/zlib/__init__.h"
+#include "shared-bindings/zlib/Decompress.h"
 
 //| """zlib decompression functionality
 //|
@@ -44,23 +45,75 @@
 //|
 //|     :param bytes data: data to be decompressed
 //|     :param int wbits: DEFLATE dictionary window size used during compression. See above.
-//|     :param int bufsize: ignored for compatibility with CPython only
+//|     :param int bufsize: the expected size of the decompressed data, to allocate it all at
+//|       once. Otherwise, the size stored at the end of a gzip stream is used, or the output
+//|       grows as needed.
 //|     """
 //|     ...
 //|
-static mp_obj_t zlib_decompress(size_t n_args, const mp_obj_t *args) {
-    mp_int_t wbits = 0;
-    if (n_args > 1) {
-        wbits = MP_OBJ_SMALL_INT_VALUE(args[1]);
-    }
+static mp_obj_t zlib_decompress(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_data, ARG_wbits, ARG_bufsize };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_data, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_wbits, MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_bufsize, MP_ARG_INT, {.u_int = 0} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
-    return common_hal_zlib_decompress(args[0], wbits);
+    mp_int_t bufsize = mp_arg_validate_int_min(args[ARG_bufsize].u_int, 0, MP_QSTR_bufsize);
+    return common_hal_zlib_decompress(args[ARG_data].u_obj, args[ARG_wbits].u_int, bufsize);
 }
-static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(zlib_decompress_obj, 1, 3, zlib_decompress);
+static MP_DEFINE_CONST_FUN_OBJ_KW(zlib_decompress_obj, 1, zlib_decompress);
+
+//| def decompress_into(data: ReadableBuffer, buffer: WriteableBuffer, wbits: Optional[int] = 0) -> int:
+//|     """Decompress *data* into *buffer* without allocating memory for the output, and
+//|     return the number of bytes decompressed. *wbits* is as for `decompress`.
+//|
+//|     :param ReadableBuffer data: data to be decompressed
+//|     :param WriteableBuffer buffer: where to put the decompressed data. A ValueError is
+//|       raised if it is too small.
+//|     :param int wbits: DEFLATE dictionary window size used during compression"""
+//|     ...
+//|
+static mp_obj_t zlib_decompress_into(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_data, ARG_buffer, ARG_wbits };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_data, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_buffer, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_wbits, MP_ARG_INT, {.u_int = 0} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    return MP_OBJ_NEW_SMALL_INT(common_hal_zlib_decompress_into(args[ARG_data].u_obj, args[ARG_buffer].u_obj, args[ARG_wbits].u_int));
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(zlib_decompress_into_obj, 2, zlib_decompress_into);
+
+//| def decompressobj(wbits: Optional[int] = 0) -> Decompress:
+//|     """Return a `Decompress` object, to decompress a stream that arrives in pieces.
+//|     *wbits* is as for `decompress`."""
+//|     ...
+//|
+static mp_obj_t zlib_decompressobj(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_wbits };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_wbits, MP_ARG_INT, {.u_int = 0} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t wbits = MP_OBJ_NEW_SMALL_INT(args[ARG_wbits].u_int);
+    return MP_OBJ_TYPE_GET_SLOT(&zlib_decompress_type, make_new)(&zlib_decompress_type, 1, 0, &wbits);
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(zlib_decompressobj_obj, 0, zlib_decompressobj);
 
 static const mp_rom_map_elem_t zlib_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_zlib) },
     { MP_ROM_QSTR(MP_QSTR_decompress), MP_ROM_PTR(&zlib_decompress_obj) },
+    { MP_ROM_QSTR(MP_QSTR_decompress_into), MP_ROM_PTR(&zlib_decompress_into_obj) },
+    { MP_ROM_QSTR(MP_QSTR_decompressobj), MP_ROM_PTR(&zlib_decompressobj_obj) },
+    { MP_ROM_QSTR(MP_QSTR_Decompress), MP_ROM_PTR(&zlib_decompress_type) },
 };
 
 static MP_DEFINE_CONST_DICT(zlib_globals, zlib_globals_table);
@@ -6,4 +6,5 @@
 
 #pragma once
 
-mp_obj_t common_hal_zlib_decompress(mp_obj_t data, mp_int_t wbits);
+mp_obj_t common_hal_zlib_decompress(mp_obj_t data, mp_int_t wbits, mp_int_t bufsize);
+mp_int_t common_hal_zlib_decompress_into(mp_obj_t data, mp_obj_t buffer, mp_int_t wbits);
@@ -33,32 +33,32 @@ void common_hal_aesio_aes_set_mode(aesio_aes_obj_t *self, int mode) {
     self->mode = mode;
 }
 
-void common_hal_aesio_aes_encrypt(aesio_aes_obj_t *self, uint8_t *buffer,
-    size_t length) {
+void common_hal_aesio_aes_encrypt(aesio_aes_obj_t *self, const uint8_t *src,
+    uint8_t *dest, size_t length) {
     switch (self->mode) {
         case AES_MODE_ECB:
-            AES_ECB_encrypt(&self->ctx, buffer);
+            AES_ECB_encrypt(&self->ctx, src, dest);
             break;
         case AES_MODE_CBC:
-            AES_CBC_encrypt_buffer(&self->ctx, buffer, length);
+            AES_CBC_encrypt_buffer(&self->ctx, src, dest, length);
             break;
         case AES_MODE_CTR:
-            AES_CTR_xcrypt_buffer(&self->ctx, buffer, length);
+            AES_CTR_xcrypt_buffer(&self->ctx, src, dest, length);
             break;
     }
 }
 
-void common_hal_aesio_aes_decrypt(aesio_aes_obj_t *self, uint8_t *buffer,
-    size_t length) {
+void common_hal_aesio_aes_decrypt(aesio_aes_obj_t *self, const uint8_t *src,
+    uint8_t *dest, size_t length) {
     switch (self->mode) {
         case AES_MODE_ECB:
-            AES_ECB_decrypt(&self->ctx, buffer);
+            AES_ECB_decrypt(&self->ctx, src, dest);
             break;
         case AES_MODE_CBC:
-            AES_CBC_decrypt_buffer(&self->ctx, buffer, length);
+            AES_CBC_decrypt_buffer(&self->ctx, src, dest, length);
             break;
         case AES_MODE_CTR:
-            AES_CTR_xcrypt_buffer(&self->ctx, buffer, length);
+            AES_CTR_xcrypt_buffer(&self->ctx, src, dest, length);
             break;
     }
 }
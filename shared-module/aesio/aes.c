@@ -1,612 +1,505 @@
-// SPDX-License-Identifier: Unlicense
-// From https://github.com/kokke/tiny-AES-c
-/*
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2016 Thomas Pornin <pornin@bolet.org>
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+// Constant-time AES after the bitsliced "aes_ct" implementation in BearSSL. There are no table
+// lookups and no branches that depend on the key or the data, so timing does not leak them.
+//
+// Eight 32-bit words hold two blocks: word i holds bit i of each of the 32 bytes. The S-box is
+// then a fixed circuit of boolean operations applied to all 32 bytes at once, and the other
+// steps are shifts and masks. Counter mode and CBC decryption fill both lanes; CBC encryption
+// and ECB use one.
+
+#include <string.h>
 
-This is an implementation of the AES algorithm, specifically ECB, CTR and CBC mode.
-Block size can be chosen in aes.h - available choices are AES128, AES192, AES256.
-
-The implementation is verified against the test vectors in:
-  National Institute of Standards and Technology Special Publication 800-38A 2001 ED
-
-ECB-AES128
-----------
-
-  plain-text:
-    6bc1bee22e409f96e93d7e117393172a
-    ae2d8a571e03ac9c9eb76fac45af8e51
-    30c81c46a35ce411e5fbc1191a0a52ef
-    f69f2445df4f9b17ad2b417be66c3710
-
-  key:
-    2b7e151628aed2a6abf7158809cf4f3c
-
-  resulting cipher
-    3ad77bb40d7a3660a89ecaf32466ef97
-    f5d3d58503b9699de785895a96fdbaaf
-    43b1cd7f598ece23881b00e3ed030688
-    7b0c785e27e8ad3f8223207104725dd4
-
-
-NOTE:   String length must be evenly divisible by 16byte (str_len % 16 == 0)
-        You should pad the end of the string with zeros if this is not the case.
-        For AES192/256 the key size is proportionally larger.
-
-*/
-
-/*****************************************************************************/
-/* Includes:                                                                 */
-/*****************************************************************************/
-#include <string.h> // CBC mode, for memset
 #include "aes.h"
 
-/*****************************************************************************/
-/* Defines:                                                                  */
-/*****************************************************************************/
-// The number of columns comprising a state in AES. This is a constant in AES.
-// Value=4
-#define Nb 4UL
-
-#if defined(AES256) && (AES256 == 1)
-    #define Nk256 8UL
-    #define Nr256 14UL
-#endif
-#if defined(AES192) && (AES192 == 1)
-    #define Nk192 6UL
-    #define Nr192 12UL
-#endif
-#if defined(AES128) && (AES128 == 1)
-    #define Nk128 4UL        // The number of 32 bit words in a key.
-    #define Nr128 10UL       // The number of rounds in AES Cipher.
-#endif
-
-// jcallan@github points out that declaring Multiply as a function reduces code
-// size considerably with the Keil ARM compiler. See this link for more
-// information: https://github.com/kokke/tiny-AES-C/pull/3
-#ifndef MULTIPLY_AS_A_FUNCTION
-  #define MULTIPLY_AS_A_FUNCTION 0
-#endif
-
-
-
-
-/*****************************************************************************/
-/* Private variables:                                                        */
-/*****************************************************************************/
-// state - array holding the intermediate results during decryption.
-typedef uint8_t state_t[4][4];
-
-
-
-// The lookup-tables are marked const so they can be placed in read-only storage
-// instead of RAM The numbers below can be computed dynamically trading ROM for
-// RAM - This can be useful in (embedded) bootloader applications, where ROM is
-// often limited.
-static const uint8_t sbox[256] = {
-    // 0     1    2      3     4    5     6     7      8    9     A      B    C     D     E     F
-    0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5, 0x30, 0x01, 0x67, 0x2b, 0xfe, 0xd7, 0xab, 0x76,
-    0xca, 0x82, 0xc9, 0x7d, 0xfa, 0x59, 0x47, 0xf0, 0xad, 0xd4, 0xa2, 0xaf, 0x9c, 0xa4, 0x72, 0xc0,
-    0xb7, 0xfd, 0x93, 0x26, 0x36, 0x3f, 0xf7, 0xcc, 0x34, 0xa5, 0xe5, 0xf1, 0x71, 0xd8, 0x31, 0x15,
-    0x04, 0xc7, 0x23, 0xc3, 0x18, 0x96, 0x05, 0x9a, 0x07, 0x12, 0x80, 0xe2, 0xeb, 0x27, 0xb2, 0x75,
-    0x09, 0x83, 0x2c, 0x1a, 0x1b, 0x6e, 0x5a, 0xa0, 0x52, 0x3b, 0xd6, 0xb3, 0x29, 0xe3, 0x2f, 0x84,
-    0x53, 0xd1, 0x00, 0xed, 0x20, 0xfc, 0xb1, 0x5b, 0x6a, 0xcb, 0xbe, 0x39, 0x4a, 0x4c, 0x58, 0xcf,
-    0xd0, 0xef, 0xaa, 0xfb, 0x43, 0x4d, 0x33, 0x85, 0x45, 0xf9, 0x02, 0x7f, 0x50, 0x3c, 0x9f, 0xa8,
-    0x51, 0xa3, 0x40, 0x8f, 0x92, 0x9d, 0x38, 0xf5, 0xbc, 0xb6, 0xda, 0x21, 0x10, 0xff, 0xf3, 0xd2,
-    0xcd, 0x0c, 0x13, 0xec, 0x5f, 0x97, 0x44, 0x17, 0xc4, 0xa7, 0x7e, 0x3d, 0x64, 0x5d, 0x19, 0x73,
-    0x60, 0x81, 0x4f, 0xdc, 0x22, 0x2a, 0x90, 0x88, 0x46, 0xee, 0xb8, 0x14, 0xde, 0x5e, 0x0b, 0xdb,
-    0xe0, 0x32, 0x3a, 0x0a, 0x49, 0x06, 0x24, 0x5c, 0xc2, 0xd3, 0xac, 0x62, 0x91, 0x95, 0xe4, 0x79,
-    0xe7, 0xc8, 0x37, 0x6d, 0x8d, 0xd5, 0x4e, 0xa9, 0x6c, 0x56, 0xf4, 0xea, 0x65, 0x7a, 0xae, 0x08,
-    0xba, 0x78, 0x25, 0x2e, 0x1c, 0xa6, 0xb4, 0xc6, 0xe8, 0xdd, 0x74, 0x1f, 0x4b, 0xbd, 0x8b, 0x8a,
-    0x70, 0x3e, 0xb5, 0x66, 0x48, 0x03, 0xf6, 0x0e, 0x61, 0x35, 0x57, 0xb9, 0x86, 0xc1, 0x1d, 0x9e,
-    0xe1, 0xf8, 0x98, 0x11, 0x69, 0xd9, 0x8e, 0x94, 0x9b, 0x1e, 0x87, 0xe9, 0xce, 0x55, 0x28, 0xdf,
-    0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42, 0x68, 0x41, 0x99, 0x2d, 0x0f, 0xb0, 0x54, 0xbb, 0x16
-};
-
-static const uint8_t rsbox[256] = {
-    0x52, 0x09, 0x6a, 0xd5, 0x30, 0x36, 0xa5, 0x38, 0xbf, 0x40, 0xa3, 0x9e, 0x81, 0xf3, 0xd7, 0xfb,
-    0x7c, 0xe3, 0x39, 0x82, 0x9b, 0x2f, 0xff, 0x87, 0x34, 0x8e, 0x43, 0x44, 0xc4, 0xde, 0xe9, 0xcb,
-    0x54, 0x7b, 0x94, 0x32, 0xa6, 0xc2, 0x23, 0x3d, 0xee, 0x4c, 0x95, 0x0b, 0x42, 0xfa, 0xc3, 0x4e,
-    0x08, 0x2e, 0xa1, 0x66, 0x28, 0xd9, 0x24, 0xb2, 0x76, 0x5b, 0xa2, 0x49, 0x6d, 0x8b, 0xd1, 0x25,
-    0x72, 0xf8, 0xf6, 0x64, 0x86, 0x68, 0x98, 0x16, 0xd4, 0xa4, 0x5c, 0xcc, 0x5d, 0x65, 0xb6, 0x92,
-    0x6c, 0x70, 0x48, 0x50, 0xfd, 0xed, 0xb9, 0xda, 0x5e, 0x15, 0x46, 0x57, 0xa7, 0x8d, 0x9d, 0x84,
-    0x90, 0xd8, 0xab, 0x00, 0x8c, 0xbc, 0xd3, 0x0a, 0xf7, 0xe4, 0x58, 0x05, 0xb8, 0xb3, 0x45, 0x06,
-    0xd0, 0x2c, 0x1e, 0x8f, 0xca, 0x3f, 0x0f, 0x02, 0xc1, 0xaf, 0xbd, 0x03, 0x01, 0x13, 0x8a, 0x6b,
-    0x3a, 0x91, 0x11, 0x41, 0x4f, 0x67, 0xdc, 0xea, 0x97, 0xf2, 0xcf, 0xce, 0xf0, 0xb4, 0xe6, 0x73,
-    0x96, 0xac, 0x74, 0x22, 0xe7, 0xad, 0x35, 0x85, 0xe2, 0xf9, 0x37, 0xe8, 0x1c, 0x75, 0xdf, 0x6e,
-    0x47, 0xf1, 0x1a, 0x71, 0x1d, 0x29, 0xc5, 0x89, 0x6f, 0xb7, 0x62, 0x0e, 0xaa, 0x18, 0xbe, 0x1b,
-    0xfc, 0x56, 0x3e, 0x4b, 0xc6, 0xd2, 0x79, 0x20, 0x9a, 0xdb, 0xc0, 0xfe, 0x78, 0xcd, 0x5a, 0xf4,
-    0x1f, 0xdd, 0xa8, 0x33, 0x88, 0x07, 0xc7, 0x31, 0xb1, 0x12, 0x10, 0x59, 0x27, 0x80, 0xec, 0x5f,
-    0x60, 0x51, 0x7f, 0xa9, 0x19, 0xb5, 0x4a, 0x0d, 0x2d, 0xe5, 0x7a, 0x9f, 0x93, 0xc9, 0x9c, 0xef,
-    0xa0, 0xe0, 0x3b, 0x4d, 0xae, 0x2a, 0xf5, 0xb0, 0xc8, 0xeb, 0xbb, 0x3c, 0x83, 0x53, 0x99, 0x61,
-    0x17, 0x2b, 0x04, 0x7e, 0xba, 0x77, 0xd6, 0x26, 0xe1, 0x69, 0x14, 0x63, 0x55, 0x21, 0x0c, 0x7d
-};
-
-// The round constant word array, Rcon[i], contains the values given by x to the
-// power (i-1) being powers of x (x is denoted as {02}) in the field GF(2^8)
-static const uint8_t Rcon[11] = {
-    0x8d, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1b, 0x36
-};
-
-/*
- * Jordan Goulder points out in PR #12
- * (https://github.com/kokke/tiny-AES-C/pull/12), that you can remove most of
- * the elements in the Rcon array, because they are unused.
- *
- * From Wikipedia's article on the Rijndael key schedule @
- * https://en.wikipedia.org/wiki/Rijndael_key_schedule#Rcon
- *
- * "Only the first some of these constants are actually used – up to rcon[10]
- *  for AES-128 (as 11 round keys are needed), up to rcon[8] for AES-192, up to
- *  rcon[7] for AES-256. rcon[0] is not used in AES algorithm."
- */
-
-
-/*****************************************************************************/
-/* Private functions:                                                        */
-/*****************************************************************************/
-static const uint8_t *GetRoundKey(const struct AES_ctx *ctx) {
-    switch (ctx->KeyLength) {
-        #if defined(AES128) && (AES128 == 1)
-        case 16:
-            return ctx->RoundKey128;
-        #endif
-        #if defined(AES192) && (AES192 == 1)
-        case 24:
-            return ctx->RoundKey192;
-        #endif
-        #if defined(AES256) && (AES256 == 1)
-        case 32:
-            return ctx->RoundKey256;
-        #endif
-    }
-    return NULL;
+static inline uint32_t dec32le(const uint8_t *src) {
+    return (uint32_t)src[0]
+           | ((uint32_t)src[1] << 8)
+           | ((uint32_t)src[2] << 16)
+           | ((uint32_t)src[3] << 24);
 }
 
+static inline void enc32le(uint8_t *dst, uint32_t x) {
+    dst[0] = (uint8_t)x;
+    dst[1] = (uint8_t)(x >> 8);
+    dst[2] = (uint8_t)(x >> 16);
+    dst[3] = (uint8_t)(x >> 24);
+}
 
-/*
-static uint8_t getSBoxValue(uint8_t num)
-{
-  return sbox[num];
+// The AES S-box on all 32 bytes, as the 113-gate circuit by Boyar and Peralta
+static void bitslice_sbox(uint32_t *q) {
+    uint32_t x0, x1, x2, x3, x4, x5, x6, x7;
+    uint32_t y1, y2, y3, y4, y5, y6, y7, y8, y9;
+    uint32_t y10, y11, y12, y13, y14, y15, y16, y17, y18, y19;
+    uint32_t y20, y21;
+    uint32_t z0, z1, z2, z3, z4, z5, z6, z7, z8, z9;
+    uint32_t z10, z11, z12, z13, z14, z15, z16, z17;
+    uint32_t t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+    uint32_t t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+    uint32_t t20, t21, t22, t23, t24, t25, t26, t27, t28, t29;
+    uint32_t t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+    uint32_t t40, t41, t42, t43, t44, t45, t46, t47, t48, t49;
+    uint32_t t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+    uint32_t t60, t61, t62, t63, t64, t65, t66, t67;
+    uint32_t s0, s1, s2, s3, s4, s5, s6, s7;
+
+    x0 = q[7];
+    x1 = q[6];
+    x2 = q[5];
+    x3 = q[4];
+    x4 = q[3];
+    x5 = q[2];
+    x6 = q[1];
+    x7 = q[0];
+
+    // Top linear transformation
+    y14 = x3 ^ x5;
+    y13 = x0 ^ x6;
+    y9 = x0 ^ x3;
+    y8 = x0 ^ x5;
+    t0 = x1 ^ x2;
+    y1 = t0 ^ x7;
+    y4 = y1 ^ x3;
+    y12 = y13 ^ y14;
+    y2 = y1 ^ x0;
+    y5 = y1 ^ x6;
+    y3 = y5 ^ y8;
+    t1 = x4 ^ y12;
+    y15 = t1 ^ x5;
+    y20 = t1 ^ x1;
+    y6 = y15 ^ x7;
+    y10 = y15 ^ t0;
+    y11 = y20 ^ y9;
+    y7 = x7 ^ y11;
+    y17 = y10 ^ y11;
+    y19 = y10 ^ y8;
+    y16 = t0 ^ y11;
+    y21 = y13 ^ y16;
+    y18 = x0 ^ y16;
+
+    // Non-linear section
+    t2 = y12 & y15;
+    t3 = y3 & y6;
+    t4 = t3 ^ t2;
+    t5 = y4 & x7;
+    t6 = t5 ^ t2;
+    t7 = y13 & y16;
+    t8 = y5 & y1;
+    t9 = t8 ^ t7;
+    t10 = y2 & y7;
+    t11 = t10 ^ t7;
+    t12 = y9 & y11;
+    t13 = y14 & y17;
+    t14 = t13 ^ t12;
+    t15 = y8 & y10;
+    t16 = t15 ^ t12;
+    t17 = t4 ^ t14;
+    t18 = t6 ^ t16;
+    t19 = t9 ^ t14;
+    t20 = t11 ^ t16;
+    t21 = t17 ^ y20;
+    t22 = t18 ^ y19;
+    t23 = t19 ^ y21;
+    t24 = t20 ^ y18;
+
+    t25 = t21 ^ t22;
+    t26 = t21 & t23;
+    t27 = t24 ^ t26;
+    t28 = t25 & t27;
+    t29 = t28 ^ t22;
+    t30 = t23 ^ t24;
+    t31 = t22 ^ t26;
+    t32 = t31 & t30;
+    t33 = t32 ^ t24;
+    t34 = t23 ^ t33;
+    t35 = t27 ^ t33;
+    t36 = t24 & t35;
+    t37 = t36 ^ t34;
+    t38 = t27 ^ t36;
+    t39 = t29 & t38;
+    t40 = t25 ^ t39;
+
+    t41 = t40 ^ t37;
+    t42 = t29 ^ t33;
+    t43 = t29 ^ t40;
+    t44 = t33 ^ t37;
+    t45 = t42 ^ t41;
+    z0 = t44 & y15;
+    z1 = t37 & y6;
+    z2 = t33 & x7;
+    z3 = t43 & y16;
+    z4 = t40 & y1;
+    z5 = t29 & y7;
+    z6 = t42 & y11;
+    z7 = t45 & y17;
+    z8 = t41 & y10;
+    z9 = t44 & y12;
+    z10 = t37 & y3;
+    z11 = t33 & y4;
+    z12 = t43 & y13;
+    z13 = t40 & y5;
+    z14 = t29 & y2;
+    z15 = t42 & y9;
+    z16 = t45 & y14;
+    z17 = t41 & y8;
+
+    // Bottom linear transformation
+    t46 = z15 ^ z16;
+    t47 = z10 ^ z11;
+    t48 = z5 ^ z13;
+    t49 = z9 ^ z10;
+    t50 = z2 ^ z12;
+    t51 = z2 ^ z5;
+    t52 = z7 ^ z8;
+    t53 = z0 ^ z3;
+    t54 = z6 ^ z7;
+    t55 = z16 ^ z17;
+    t56 = z12 ^ t48;
+    t57 = t50 ^ t53;
+    t58 = z4 ^ t46;
+    t59 = z3 ^ t54;
+    t60 = t46 ^ t57;
+    t61 = z14 ^ t57;
+    t62 = t52 ^ t58;
+    t63 = t49 ^ t58;
+    t64 = z4 ^ t59;
+    t65 = t61 ^ t62;
+    t66 = z1 ^ t63;
+    s0 = t59 ^ t63;
+    s6 = t56 ^ ~t62;
+    s7 = t48 ^ ~t60;
+    t67 = t64 ^ t65;
+    s3 = t53 ^ t66;
+    s4 = t51 ^ t66;
+    s5 = t47 ^ t65;
+    s1 = t64 ^ ~s3;
+    s2 = t55 ^ ~t67;
+
+    q[7] = s0;
+    q[6] = s1;
+    q[5] = s2;
+    q[4] = s3;
+    q[3] = s4;
+    q[2] = s5;
+    q[1] = s6;
+    q[0] = s7;
 }
-*/
-#define getSBoxValue(num) (sbox[(num)])
-/*
-static uint8_t getSBoxInvert(uint8_t num)
-{
-  return rsbox[num];
+
+// The inverse of the S-box's affine transform, with its constant
+static void bitslice_inv_affine(uint32_t *q) {
+    uint32_t q0 = ~q[0];
+    uint32_t q1 = ~q[1];
+    uint32_t q2 = q[2];
+    uint32_t q3 = q[3];
+    uint32_t q4 = q[4];
+    uint32_t q5 = ~q[5];
+    uint32_t q6 = ~q[6];
+    uint32_t q7 = q[7];
+    q[7] = q1 ^ q4 ^ q6;
+    q[6] = q0 ^ q3 ^ q5;
+    q[5] = q7 ^ q2 ^ q4;
+    q[4] = q6 ^ q1 ^ q3;
+    q[3] = q5 ^ q0 ^ q2;
+    q[2] = q4 ^ q7 ^ q1;
+    q[1] = q3 ^ q6 ^ q0;
+    q[0] = q2 ^ q5 ^ q7;
 }
-*/
-#define getSBoxInvert(num) (rsbox[(num)])
-
-// This function produces Nb(Nr+1) round keys. The round keys are used in each
-// round to decrypt the states.
-static void KeyExpansion(struct AES_ctx *ctx, const uint8_t *Key) {
-    uint8_t *RoundKey = (uint8_t *)GetRoundKey(ctx);
-
-    unsigned i, j, k;
-    uint8_t tempa[4]; // Used for the column/row operations
-
-    // The first round key is the key itself.
-    for (i = 0; i < ctx->Nk; ++i)
-    {
-        RoundKey[(i * 4) + 0] = Key[(i * 4) + 0];
-        RoundKey[(i * 4) + 1] = Key[(i * 4) + 1];
-        RoundKey[(i * 4) + 2] = Key[(i * 4) + 2];
-        RoundKey[(i * 4) + 3] = Key[(i * 4) + 3];
-    }
 
-    // All other round keys are found from the previous round keys.
-    for (i = ctx->Nk; i < Nb * (ctx->Nr + 1); ++i)
-    {
-        {
-            k = (i - 1) * 4;
-            tempa[0] = RoundKey[k + 0];
-            tempa[1] = RoundKey[k + 1];
-            tempa[2] = RoundKey[k + 2];
-            tempa[3] = RoundKey[k + 3];
+// The S-box is an inversion in GF(2^8) followed by an affine transform, and inversion is its
+// own inverse, so the inverse S-box reuses the S-box between two inverse affine transforms.
+static void bitslice_inv_sbox(uint32_t *q) {
+    bitslice_inv_affine(q);
+    bitslice_sbox(q);
+    bitslice_inv_affine(q);
+}
 
-        }
+// Convert between eight words of two interleaved blocks and the bitsliced form. It is its own
+// inverse.
+static void ortho(uint32_t *q) {
+    #define SWAPN(cl, ch, s, x, y) do { \
+        uint32_t a = (x), b = (y); \
+        (x) = (a & (uint32_t)(cl)) | ((b & (uint32_t)(cl)) << (s)); \
+        (y) = ((a & (uint32_t)(ch)) >> (s)) | (b & (uint32_t)(ch)); \
+} while (0)
+    #define SWAP2(x, y) SWAPN(0x55555555, 0xAAAAAAAA, 1, x, y)
+    #define SWAP4(x, y) SWAPN(0x33333333, 0xCCCCCCCC, 2, x, y)
+    #define SWAP8(x, y) SWAPN(0x0F0F0F0F, 0xF0F0F0F0, 4, x, y)
+
+    SWAP2(q[0], q[1]);
+    SWAP2(q[2], q[3]);
+    SWAP2(q[4], q[5]);
+    SWAP2(q[6], q[7]);
+
+    SWAP4(q[0], q[2]);
+    SWAP4(q[1], q[3]);
+    SWAP4(q[4], q[6]);
+    SWAP4(q[5], q[7]);
+
+    SWAP8(q[0], q[4]);
+    SWAP8(q[1], q[5]);
+    SWAP8(q[2], q[6]);
+    SWAP8(q[3], q[7]);
+
+    #undef SWAPN
+    #undef SWAP2
+    #undef SWAP4
+    #undef SWAP8
+}
 
-        if (i % ctx->Nk == 0) {
-            // This function shifts the 4 bytes in a word to the left once.
-            // [a0,a1,a2,a3] becomes [a1,a2,a3,a0]
-
-            // Function RotWord()
-            {
-                const uint8_t u8tmp = tempa[0];
-                tempa[0] = tempa[1];
-                tempa[1] = tempa[2];
-                tempa[2] = tempa[3];
-                tempa[3] = u8tmp;
-            }
-
-            // SubWord() is a function that takes a four-byte input word and applies
-            // the S-box to each of the four bytes to produce an output word.
-
-            // Function Subword()
-            {
-                tempa[0] = getSBoxValue(tempa[0]);
-                tempa[1] = getSBoxValue(tempa[1]);
-                tempa[2] = getSBoxValue(tempa[2]);
-                tempa[3] = getSBoxValue(tempa[3]);
-            }
-
-            tempa[0] = tempa[0] ^ Rcon[i / ctx->Nk];
-        }
-        #if defined(AES256) && (AES256 == 1)
-        if (ctx->KeyLength == 32) {
-            if (i % ctx->Nk == 4) {
-                // Function Subword()
-                {
-                    tempa[0] = getSBoxValue(tempa[0]);
-                    tempa[1] = getSBoxValue(tempa[1]);
-                    tempa[2] = getSBoxValue(tempa[2]);
-                    tempa[3] = getSBoxValue(tempa[3]);
-                }
-            }
-        }
-        #endif
-        j = i * 4;
-        k = (i - ctx->Nk) * 4;
-        RoundKey[j + 0] = RoundKey[k + 0] ^ tempa[0];
-        RoundKey[j + 1] = RoundKey[k + 1] ^ tempa[1];
-        RoundKey[j + 2] = RoundKey[k + 2] ^ tempa[2];
-        RoundKey[j + 3] = RoundKey[k + 3] ^ tempa[3];
+static inline void add_round_key(uint32_t *q, const uint32_t *sk) {
+    for (int i = 0; i < 8; i++) {
+        q[i] ^= sk[i];
     }
 }
 
-void AES_init_ctx(struct AES_ctx *ctx, const uint8_t *key, uint32_t keylen) {
-    ctx->KeyLength = keylen;
-    switch (ctx->KeyLength) {
-        #if defined(AES128) && (AES128 == 1)
-        case 16:
-            ctx->Nr = Nr128;
-            ctx->Nk = Nk128;
-            break;
-        #endif
-        #if defined(AES192) && (AES192 == 1)
-        case 24:
-            ctx->Nr = Nr192;
-            ctx->Nk = Nk192;
-            break;
-        #endif
-        #if defined(AES256) && (AES256 == 1)
-        case 32:
-            ctx->Nr = Nr256;
-            ctx->Nk = Nk256;
-            break;
-        #endif
-        default:
-            ctx->Nr = 0;
-            ctx->Nk = 0;
-            break;
+static inline void shift_rows(uint32_t *q) {
+    for (int i = 0; i < 8; i++) {
+        uint32_t x = q[i];
+        q[i] = (x & 0x000000FF)
+            | ((x & 0x0000FC00) >> 2) | ((x & 0x00000300) << 6)
+            | ((x & 0x00F00000) >> 4) | ((x & 0x000F0000) << 4)
+            | ((x & 0xC0000000) >> 6) | ((x & 0x3F000000) << 2);
     }
-    KeyExpansion(ctx, key);
-}
-#if (defined(CBC) && (CBC == 1)) || (defined(CTR) && (CTR == 1))
-void AES_init_ctx_iv(struct AES_ctx *ctx, const uint8_t *key, uint32_t keylen, const uint8_t *iv) {
-    AES_init_ctx(ctx, key, keylen);
-    memcpy(ctx->Iv, iv, AES_BLOCKLEN);
 }
-void AES_ctx_set_iv(struct AES_ctx *ctx, const uint8_t *iv) {
-    memcpy(ctx->Iv, iv, AES_BLOCKLEN);
-}
-#endif
-
-// This function adds the round key to state. The round key is added to the
-// state by an XOR function.
-static void AddRoundKey(uint8_t round, state_t *state, const uint8_t *RoundKey) {
-    uint8_t i, j;
-    for (i = 0; i < 4; ++i)
-    {
-        for (j = 0; j < 4; ++j)
-        {
-            (*state)[i][j] ^= RoundKey[(round * Nb * 4) + (i * Nb) + j];
-        }
+
+static inline void inv_shift_rows(uint32_t *q) {
+    for (int i = 0; i < 8; i++) {
+        uint32_t x = q[i];
+        q[i] = (x & 0x000000FF)
+            | ((x & 0x00003F00) << 2) | ((x & 0x0000C000) >> 6)
+            | ((x & 0x000F0000) << 4) | ((x & 0x00F00000) >> 4)
+            | ((x & 0x03000000) << 6) | ((x & 0xFC000000) >> 2);
     }
 }
 
-// The SubBytes Function Substitutes the values in the state matrix with values
-// in an S-box.
-static void SubBytes(state_t *state) {
-    uint8_t i, j;
-    for (i = 0; i < 4; ++i)
-    {
-        for (j = 0; j < 4; ++j)
-        {
-            (*state)[j][i] = getSBoxValue((*state)[j][i]);
-        }
-    }
+static inline uint32_t rotr16(uint32_t x) {
+    return (x << 16) | (x >> 16);
 }
 
-// The ShiftRows() function shifts the rows in the state to the left. Each row
-// is shifted with different offset. Offset = Row number. So the first row is
-// not shifted.
-static void ShiftRows(state_t *state) {
-    uint8_t temp;
-
-    // Rotate first row 1 columns to left
-    temp = (*state)[0][1];
-    (*state)[0][1] = (*state)[1][1];
-    (*state)[1][1] = (*state)[2][1];
-    (*state)[2][1] = (*state)[3][1];
-    (*state)[3][1] = temp;
-
-    // Rotate second row 2 columns to left
-    temp = (*state)[0][2];
-    (*state)[0][2] = (*state)[2][2];
-    (*state)[2][2] = temp;
-
-    temp = (*state)[1][2];
-    (*state)[1][2] = (*state)[3][2];
-    (*state)[3][2] = temp;
-
-    // Rotate third row 3 columns to left
-    temp = (*state)[0][3];
-    (*state)[0][3] = (*state)[3][3];
-    (*state)[3][3] = (*state)[2][3];
-    (*state)[2][3] = (*state)[1][3];
-    (*state)[1][3] = temp;
+static inline void mix_columns(uint32_t *q) {
+    uint32_t q0 = q[0], q1 = q[1], q2 = q[2], q3 = q[3];
+    uint32_t q4 = q[4], q5 = q[5], q6 = q[6], q7 = q[7];
+    uint32_t r0 = (q0 >> 8) | (q0 << 24);
+    uint32_t r1 = (q1 >> 8) | (q1 << 24);
+    uint32_t r2 = (q2 >> 8) | (q2 << 24);
+    uint32_t r3 = (q3 >> 8) | (q3 << 24);
+    uint32_t r4 = (q4 >> 8) | (q4 << 24);
+    uint32_t r5 = (q5 >> 8) | (q5 << 24);
+    uint32_t r6 = (q6 >> 8) | (q6 << 24);
+    uint32_t r7 = (q7 >> 8) | (q7 << 24);
+
+    q[0] = q7 ^ r7 ^ r0 ^ rotr16(q0 ^ r0);
+    q[1] = q0 ^ r0 ^ q7 ^ r7 ^ r1 ^ rotr16(q1 ^ r1);
+    q[2] = q1 ^ r1 ^ r2 ^ rotr16(q2 ^ r2);
+    q[3] = q2 ^ r2 ^ q7 ^ r7 ^ r3 ^ rotr16(q3 ^ r3);
+    q[4] = q3 ^ r3 ^ q7 ^ r7 ^ r4 ^ rotr16(q4 ^ r4);
+    q[5] = q4 ^ r4 ^ r5 ^ rotr16(q5 ^ r5);
+    q[6] = q5 ^ r5 ^ r6 ^ rotr16(q6 ^ r6);
+    q[7] = q6 ^ r6 ^ r7 ^ rotr16(q7 ^ r7);
 }
 
-static uint8_t xtime(uint8_t x) {
-    return (x << 1) ^ (((x >> 7) & 1) * 0x1b);
+static inline void inv_mix_columns(uint32_t *q) {
+    uint32_t q0 = q[0], q1 = q[1], q2 = q[2], q3 = q[3];
+    uint32_t q4 = q[4], q5 = q[5], q6 = q[6], q7 = q[7];
+    uint32_t r0 = (q0 >> 8) | (q0 << 24);
+    uint32_t r1 = (q1 >> 8) | (q1 << 24);
+    uint32_t r2 = (q2 >> 8) | (q2 << 24);
+    uint32_t r3 = (q3 >> 8) | (q3 << 24);
+    uint32_t r4 = (q4 >> 8) | (q4 << 24);
+    uint32_t r5 = (q5 >> 8) | (q5 << 24);
+    uint32_t r6 = (q6 >> 8) | (q6 << 24);
+    uint32_t r7 = (q7 >> 8) | (q7 << 24);
+
+    q[0] = q5 ^ q6 ^ q7 ^ r0 ^ r5 ^ r7 ^ rotr16(q0 ^ q5 ^ q6 ^ r0 ^ r5);
+    q[1] = q0 ^ q5 ^ r0 ^ r1 ^ r5 ^ r6 ^ r7 ^ rotr16(q1 ^ q5 ^ q7 ^ r1 ^ r5 ^ r6);
+    q[2] = q0 ^ q1 ^ q6 ^ r1 ^ r2 ^ r6 ^ r7 ^ rotr16(q0 ^ q2 ^ q6 ^ r2 ^ r6 ^ r7);
+    q[3] = q0 ^ q1 ^ q2 ^ q5 ^ q6 ^ r0 ^ r2 ^ r3 ^ r5 ^ rotr16(q0 ^ q1 ^ q3 ^ q5 ^ q6 ^ q7 ^ r0 ^ r3 ^ r5 ^ r7);
+    q[4] = q1 ^ q2 ^ q3 ^ q5 ^ r1 ^ r3 ^ r4 ^ r5 ^ r6 ^ r7 ^ rotr16(q1 ^ q2 ^ q4 ^ q5 ^ q7 ^ r1 ^ r4 ^ r5 ^ r6);
+    q[5] = q2 ^ q3 ^ q4 ^ q6 ^ r2 ^ r4 ^ r5 ^ r6 ^ r7 ^ rotr16(q2 ^ q3 ^ q5 ^ q6 ^ r2 ^ r5 ^ r6 ^ r7);
+    q[6] = q3 ^ q4 ^ q5 ^ q7 ^ r3 ^ r5 ^ r6 ^ r7 ^ rotr16(q3 ^ q4 ^ q6 ^ q7 ^ r3 ^ r6 ^ r7);
+    q[7] = q4 ^ q5 ^ q6 ^ r4 ^ r6 ^ r7 ^ rotr16(q4 ^ q5 ^ q7 ^ r4 ^ r7);
 }
 
-// MixColumns function mixes the columns of the state matrix
-static void MixColumns(state_t *state) {
-    uint8_t i;
-    uint8_t Tmp, Tm, t;
-    for (i = 0; i < 4; ++i)
-    {
-        t = (*state)[i][0];
-        Tmp = (*state)[i][0] ^ (*state)[i][1] ^ (*state)[i][2] ^ (*state)[i][3];
-        Tm = (*state)[i][0] ^ (*state)[i][1];
-        Tm = xtime(Tm);
-        (*state)[i][0] ^= Tm ^ Tmp;
-        Tm = (*state)[i][1] ^ (*state)[i][2];
-        Tm = xtime(Tm);
-        (*state)[i][1] ^= Tm ^ Tmp;
-        Tm = (*state)[i][2] ^ (*state)[i][3];
-        Tm = xtime(Tm);
-        (*state)[i][2] ^= Tm ^ Tmp;
-        Tm = (*state)[i][3] ^ t;
-        Tm = xtime(Tm);
-        (*state)[i][3] ^= Tm ^ Tmp;
+static void bitslice_encrypt(const struct AES_ctx *ctx, uint32_t *q) {
+    const uint32_t *skey = ctx->skey;
+    add_round_key(q, skey);
+    for (unsigned u = 1; u < ctx->Nr; u++) {
+        bitslice_sbox(q);
+        shift_rows(q);
+        mix_columns(q);
+        add_round_key(q, skey + (u << 3));
     }
+    bitslice_sbox(q);
+    shift_rows(q);
+    add_round_key(q, skey + (ctx->Nr << 3));
 }
 
-// Multiply is used to multiply numbers in the field GF(2^8)
-// Note: The last call to xtime() is unneeded, but often ends up generating a smaller binary
-//       The compiler seems to be able to vectorize the operation better this way.
-//       See https://github.com/kokke/tiny-AES-c/pull/34
-#if MULTIPLY_AS_A_FUNCTION
-static uint8_t Multiply(uint8_t x, uint8_t y) {
-    return ((y & 1) * x) ^
-           ((y >> 1 & 1) * xtime(x)) ^
-           ((y >> 2 & 1) * xtime(xtime(x))) ^
-           ((y >> 3 & 1) * xtime(xtime(xtime(x)))) ^
-           ((y >> 4 & 1) * xtime(xtime(xtime(xtime(x))))); /* this last call to xtime() can be omitted */
-}
-#else
-#define Multiply(x, y)                                \
-    (((y & 1) * x) ^                              \
-    ((y >> 1 & 1) * xtime(x)) ^                       \
-    ((y >> 2 & 1) * xtime(xtime(x))) ^                \
-    ((y >> 3 & 1) * xtime(xtime(xtime(x)))) ^         \
-    ((y >> 4 & 1) * xtime(xtime(xtime(xtime(x))))))   \
-
-#endif
-
-#if (defined(CBC) && CBC == 1) || (defined(ECB) && ECB == 1)
-// MixColumns function mixes the columns of the state matrix. The method used to
-// multiply may be difficult to understand for the inexperienced. Please use the
-// references to gain more information.
-static void InvMixColumns(state_t *state) {
-    int i;
-    uint8_t a, b, c, d;
-    for (i = 0; i < 4; ++i)
-    {
-        a = (*state)[i][0];
-        b = (*state)[i][1];
-        c = (*state)[i][2];
-        d = (*state)[i][3];
-
-        (*state)[i][0] = Multiply(a, 0x0e) ^ Multiply(b, 0x0b) ^ Multiply(c, 0x0d) ^ Multiply(d, 0x09);
-        (*state)[i][1] = Multiply(a, 0x09) ^ Multiply(b, 0x0e) ^ Multiply(c, 0x0b) ^ Multiply(d, 0x0d);
-        (*state)[i][2] = Multiply(a, 0x0d) ^ Multiply(b, 0x09) ^ Multiply(c, 0x0e) ^ Multiply(d, 0x0b);
-        (*state)[i][3] = Multiply(a, 0x0b) ^ Multiply(b, 0x0d) ^ Multiply(c, 0x09) ^ Multiply(d, 0x0e);
+static void bitslice_decrypt(const struct AES_ctx *ctx, uint32_t *q) {
+    const uint32_t *skey = ctx->skey;
+    add_round_key(q, skey + (ctx->Nr << 3));
+    for (unsigned u = ctx->Nr - 1; u > 0; u--) {
+        inv_shift_rows(q);
+        bitslice_inv_sbox(q);
+        add_round_key(q, skey + (u << 3));
+        inv_mix_columns(q);
     }
+    inv_shift_rows(q);
+    bitslice_inv_sbox(q);
+    add_round_key(q, skey);
 }
 
-
-// The SubBytes Function Substitutes the values in the state matrix with values
-// in an S-box.
-static void InvSubBytes(state_t *state) {
-    uint8_t i, j;
-    for (i = 0; i < 4; ++i)
-    {
-        for (j = 0; j < 4; ++j)
-        {
-            (*state)[j][i] = getSBoxInvert((*state)[j][i]);
-        }
+// Load up to two blocks into the interleaved form; b may be NULL to leave its lane empty
+static inline void load_blocks(uint32_t *q, const uint8_t *a, const uint8_t *b) {
+    for (int i = 0; i < 4; i++) {
+        q[i << 1] = dec32le(a + (i << 2));
+        q[(i << 1) + 1] = b ? dec32le(b + (i << 2)) : 0;
     }
+    ortho(q);
 }
 
-static void InvShiftRows(state_t *state) {
-    uint8_t temp;
-
-    // Rotate first row 1 columns to right
-    temp = (*state)[3][1];
-    (*state)[3][1] = (*state)[2][1];
-    (*state)[2][1] = (*state)[1][1];
-    (*state)[1][1] = (*state)[0][1];
-    (*state)[0][1] = temp;
-
-    // Rotate second row 2 columns to right
-    temp = (*state)[0][2];
-    (*state)[0][2] = (*state)[2][2];
-    (*state)[2][2] = temp;
-
-    temp = (*state)[1][2];
-    (*state)[1][2] = (*state)[3][2];
-    (*state)[3][2] = temp;
-
-    // Rotate third row 3 columns to right
-    temp = (*state)[0][3];
-    (*state)[0][3] = (*state)[1][3];
-    (*state)[1][3] = (*state)[2][3];
-    (*state)[2][3] = (*state)[3][3];
-    (*state)[3][3] = temp;
-}
-#endif // #if (defined(CBC) && CBC == 1) || (defined(ECB) && ECB == 1)
-
-// Cipher is the main function that encrypts the PlainText.
-static void Cipher(state_t *state, const struct AES_ctx *ctx) {
-    const uint8_t *RoundKey = GetRoundKey(ctx);
-    uint8_t round = 0;
-
-    // Add the First round key to the state before starting the rounds.
-    AddRoundKey(0, state, RoundKey);
-
-    // There will be Nr rounds. The first Nr-1 rounds are identical. These Nr
-    // rounds are executed in the loop below. Last one without MixColumns()
-    for (round = 1; ; ++round)
-    {
-        SubBytes(state);
-        ShiftRows(state);
-        if (round == ctx->Nr) {
-            break;
+static inline void store_blocks(uint32_t *q, uint8_t *a, uint8_t *b) {
+    ortho(q);
+    for (int i = 0; i < 4; i++) {
+        enc32le(a + (i << 2), q[i << 1]);
+        if (b) {
+            enc32le(b + (i << 2), q[(i << 1) + 1]);
         }
-        MixColumns(state);
-        AddRoundKey(round, state, RoundKey);
     }
-    // Add round key to last round
-    AddRoundKey(ctx->Nr, state, RoundKey);
 }
 
-#if (defined(CBC) && CBC == 1) || (defined(ECB) && ECB == 1)
-static void InvCipher(state_t *state, const struct AES_ctx *ctx) {
-    const uint8_t *RoundKey = GetRoundKey(ctx);
-    uint8_t round = 0;
-
-    // Add the First round key to the state before starting the rounds.
-    AddRoundKey(ctx->Nr, state, RoundKey);
-
-    // There will be Nr rounds. The first Nr-1 rounds are identical. These Nr
-    // rounds are executed in the loop below. Last one without InvMixColumn()
-    for (round = (ctx->Nr - 1); ; --round)
-    {
-        InvShiftRows(state);
-        InvSubBytes(state);
-        AddRoundKey(round, state, RoundKey);
-        if (round == 0) {
-            break;
+static uint32_t sub_word(uint32_t x) {
+    uint32_t q[8] = { x };
+    ortho(q);
+    bitslice_sbox(q);
+    ortho(q);
+    return q[0];
+}
+
+void AES_init_ctx(struct AES_ctx *ctx, const uint8_t *key, uint32_t keylen) {
+    static const uint8_t Rcon[] = { 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1B, 0x36 };
+    // The key schedule in words, each word twice to fill both lanes, then bitsliced in place
+    uint32_t *skey = ctx->skey;
+
+    ctx->Nr = keylen == AES_KEYLEN256 ? 14 : keylen == AES_KEYLEN192 ? 12 : 10;
+    int nk = keylen >> 2;
+    int nkf = (ctx->Nr + 1) << 2;
+    uint32_t tmp = 0;
+    for (int i = 0; i < nk; i++) {
+        tmp = dec32le(key + (i << 2));
+        skey[(i << 1) + 0] = tmp;
+        skey[(i << 1) + 1] = tmp;
+    }
+    for (int i = nk, j = 0, k = 0; i < nkf; i++) {
+        if (j == 0) {
+            tmp = (tmp << 24) | (tmp >> 8);
+            tmp = sub_word(tmp) ^ Rcon[k];
+        } else if (nk > 6 && j == 4) {
+            tmp = sub_word(tmp);
+        }
+        tmp ^= skey[(i - nk) << 1];
+        skey[(i << 1) + 0] = tmp;
+        skey[(i << 1) + 1] = tmp;
+        if (++j == nk) {
+            j = 0;
+            k++;
         }
-        InvMixColumns(state);
     }
-
+    for (int i = 0; i < nkf; i += 4) {
+        ortho(skey + (i << 1));
+    }
 }
-#endif // #if (defined(CBC) && CBC == 1) || (defined(ECB) && ECB == 1)
-
-/*****************************************************************************/
-/* Public functions:                                                         */
-/*****************************************************************************/
-#if defined(ECB) && (ECB == 1)
 
-
-void AES_ECB_encrypt(const struct AES_ctx *ctx, uint8_t *buf) {
-    // The next function call encrypts the PlainText with the Key using AES
-    // algorithm.
-    Cipher((state_t *)buf, ctx);
+void AES_init_ctx_iv(struct AES_ctx *ctx, const uint8_t *key, uint32_t keylen, const uint8_t *iv) {
+    AES_init_ctx(ctx, key, keylen);
+    memcpy(ctx->Iv, iv, AES_BLOCKLEN);
 }
 
-void AES_ECB_decrypt(const struct AES_ctx *ctx, uint8_t *buf) {
-    // The next function call decrypts the PlainText with the Key using AES
-    // algorithm.
-    InvCipher((state_t *)buf, ctx);
+void AES_ctx_set_iv(struct AES_ctx *ctx, const uint8_t *iv) {
+    memcpy(ctx->Iv, iv, AES_BLOCKLEN);
 }
 
+void AES_ECB_encrypt(const struct AES_ctx *ctx, const uint8_t *in, uint8_t *out) {
+    uint32_t q[8];
+    load_blocks(q, in, NULL);
+    bitslice_encrypt(ctx, q);
+    store_blocks(q, out, NULL);
+}
 
-#endif // #if defined(ECB) && (ECB == 1)
-
-
-
-
-
-#if defined(CBC) && (CBC == 1)
-
+void AES_ECB_decrypt(const struct AES_ctx *ctx, const uint8_t *in, uint8_t *out) {
+    uint32_t q[8];
+    load_blocks(q, in, NULL);
+    bitslice_decrypt(ctx, q);
+    store_blocks(q, out, NULL);
+}
 
-static void XorWithIv(uint8_t *buf, const uint8_t *Iv) {
-    uint8_t i;
-    for (i = 0; i < AES_BLOCKLEN; ++i) // The block in AES is always 128bit no matter the key size
-    {
-        buf[i] ^= Iv[i];
+static inline void xor_block(uint8_t *dst, const uint8_t *a, const uint8_t *b, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        dst[i] = a[i] ^ b[i];
     }
 }
 
-void AES_CBC_encrypt_buffer(struct AES_ctx *ctx, uint8_t *buf, uint32_t length) {
-    uintptr_t i;
-    uint8_t *Iv = ctx->Iv;
-    for (i = 0; i < length; i += AES_BLOCKLEN)
-    {
-        XorWithIv(buf, Iv);
-        Cipher((state_t *)buf, ctx);
-        Iv = buf;
-        buf += AES_BLOCKLEN;
+void AES_CBC_encrypt_buffer(struct AES_ctx *ctx, const uint8_t *in, uint8_t *out, size_t length) {
+    // Each block depends on the one before, so only one lane is used
+    uint8_t block[AES_BLOCKLEN];
+    for (size_t i = 0; i < length; i += AES_BLOCKLEN) {
+        xor_block(block, in + i, ctx->Iv, AES_BLOCKLEN);
+        AES_ECB_encrypt(ctx, block, ctx->Iv);
+        memcpy(out + i, ctx->Iv, AES_BLOCKLEN);
     }
-    /* store Iv in ctx for next call */
-    memcpy(ctx->Iv, Iv, AES_BLOCKLEN);
 }
 
-void AES_CBC_decrypt_buffer(struct AES_ctx *ctx, uint8_t *buf,  uint32_t length) {
-    uintptr_t i;
-    uint8_t storeNextIv[AES_BLOCKLEN];
-    for (i = 0; i < length; i += AES_BLOCKLEN)
-    {
-        memcpy(storeNextIv, buf, AES_BLOCKLEN);
-        InvCipher((state_t *)buf, ctx);
-        XorWithIv(buf, ctx->Iv);
-        memcpy(ctx->Iv, storeNextIv, AES_BLOCKLEN);
-        buf += AES_BLOCKLEN;
+void AES_CBC_decrypt_buffer(struct AES_ctx *ctx, const uint8_t *in, uint8_t *out, size_t length) {
+    uint8_t next_iv[AES_BLOCKLEN];
+    uint8_t plain[2 * AES_BLOCKLEN];
+    for (size_t i = 0; i < length; i += 2 * AES_BLOCKLEN) {
+        const uint8_t *second = i + AES_BLOCKLEN < length ? in + i + AES_BLOCKLEN : NULL;
+        size_t n = second ? 2 * AES_BLOCKLEN : AES_BLOCKLEN;
+        uint32_t q[8];
+        load_blocks(q, in + i, second);
+        bitslice_decrypt(ctx, q);
+        store_blocks(q, plain, second ? plain + AES_BLOCKLEN : NULL);
+        // Keep the last cipher block before it may be overwritten, as the next IV
+        memcpy(next_iv, in + i + n - AES_BLOCKLEN, AES_BLOCKLEN);
+        xor_block(plain, plain, ctx->Iv, AES_BLOCKLEN);
+        if (second) {
+            xor_block(plain + AES_BLOCKLEN, plain + AES_BLOCKLEN, in + i, AES_BLOCKLEN);
+        }
+        memcpy(out + i, plain, n);
+        memcpy(ctx->Iv, next_iv, AES_BLOCKLEN);
     }
+}
 
+// Increment the 128-bit big-endian counter, in constant time
+static inline void increment_counter(uint8_t *counter) {
+    uint32_t carry = 1;
+    for (int i = AES_BLOCKLEN - 1; i >= 0; i--) {
+        carry += counter[i];
+        counter[i] = (uint8_t)carry;
+        carry >>= 8;
+    }
 }
 
-#endif // #if defined(CBC) && (CBC == 1)
-
-
-
-#if defined(CTR) && (CTR == 1)
-
-/* Symmetrical operation: same function for encrypting as for decrypting. Note
-any IV/nonce should never be reused with the same key */
-void AES_CTR_xcrypt_buffer(struct AES_ctx *ctx, uint8_t *buf, uint32_t length) {
-    uint8_t buffer[AES_BLOCKLEN];
-
-    unsigned i;
-    int bi;
-    for (i = 0, bi = AES_BLOCKLEN; i < length; ++i, ++bi)
-    {
-        if (bi == AES_BLOCKLEN) { /* we need to regen xor compliment in buffer */
-            memcpy(buffer, ctx->Iv, AES_BLOCKLEN);
-            Cipher((state_t *)buffer, ctx);
-
-            /* Increment Iv and handle overflow */
-            for (bi = (AES_BLOCKLEN - 1); bi >= 0; --bi)
-            {
-                /* inc will overflow */
-                if (ctx->Iv[bi] == 255) {
-                    ctx->Iv[bi] = 0;
-                    continue;
-                }
-                ctx->Iv[bi] += 1;
-                break;
-            }
-            bi = 0;
+void AES_CTR_xcrypt_buffer(struct AES_ctx *ctx, const uint8_t *in, uint8_t *out, size_t length) {
+    // Two counter blocks of key stream at a time
+    uint8_t counters[2 * AES_BLOCKLEN];
+    for (size_t i = 0; i < length; i += 2 * AES_BLOCKLEN) {
+        memcpy(counters, ctx->Iv, AES_BLOCKLEN);
+        increment_counter(ctx->Iv);
+        memcpy(counters + AES_BLOCKLEN, ctx->Iv, AES_BLOCKLEN);
+        size_t n = length - i < 2 * AES_BLOCKLEN ? length - i : 2 * AES_BLOCKLEN;
+        if (n > AES_BLOCKLEN) {
+            increment_counter(ctx->Iv);
         }
 
-        buf[i] = (buf[i] ^ buffer[bi]);
+        uint32_t q[8];
+        load_blocks(q, counters, counters + AES_BLOCKLEN);
+        bitslice_encrypt(ctx, q);
+        store_blocks(q, counters, counters + AES_BLOCKLEN);
+        xor_block(out + i, in + i, counters, n);
     }
 }
-
-#endif // #if defined(CTR) && (CTR == 1)
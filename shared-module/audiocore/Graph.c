@@ -0,0 +1,555 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-bindings/audiocore/Graph.h"
+#include "shared-bindings/audiocore/GraphNode.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "py/runtime.h"
+
+#if defined(__arm__) && __arm__
+#include "cmsis_compiler.h"
+#endif
+
+#define UNITY_LEVEL (1 << 15)
+
+// Mix nodes add their inputs into a 32-bit bus this many samples at a time
+#define GRAPH_MIX_SAMPLES (128)
+
+void common_hal_audiocore_graph_construct(audiocore_graph_obj_t *self,
+    uint32_t sample_rate, uint8_t channel_count, uint16_t block_size) {
+    self->sample_rate = sample_rate;
+    self->channel_count = channel_count;
+    self->block_size = block_size;
+    size_t block_bytes = block_size * channel_count * sizeof(int16_t);
+    self->output_buffers[0] = m_malloc(block_bytes);
+    self->output_buffers[1] = m_malloc(block_bytes);
+    self->output = NULL;
+    self->other_channel = -1;
+    audiocore_graph_schedule(self);
+}
+
+void common_hal_audiocore_graph_deinit(audiocore_graph_obj_t *self) {
+    self->output_buffers[0] = NULL;
+    self->output_buffers[1] = NULL;
+    self->buffers = NULL;
+    self->buffer_count = 0;
+    self->order = NULL;
+    self->order_count = 0;
+}
+
+bool common_hal_audiocore_graph_deinited(audiocore_graph_obj_t *self) {
+    return self->output_buffers[0] == NULL;
+}
+
+uint32_t common_hal_audiocore_graph_get_sample_rate(audiocore_graph_obj_t *self) {
+    return self->sample_rate;
+}
+
+uint8_t common_hal_audiocore_graph_get_bits_per_sample(audiocore_graph_obj_t *self) {
+    return 16;
+}
+
+uint8_t common_hal_audiocore_graph_get_channel_count(audiocore_graph_obj_t *self) {
+    return self->channel_count;
+}
+
+uint8_t common_hal_audiocore_graph_get_buffer_count(audiocore_graph_obj_t *self) {
+    return self->buffer_count;
+}
+
+mp_obj_t common_hal_audiocore_graph_get_output(audiocore_graph_obj_t *self) {
+    return self->output ? MP_OBJ_FROM_PTR(self->output) : mp_const_none;
+}
+
+static bool node_plays(audiocore_graph_node_obj_t *node, audiocore_graph_obj_t *graph);
+
+// Whether pulling from sample would pull from graph, which would never return.
+static bool sample_plays(mp_obj_t sample, audiocore_graph_obj_t *graph) {
+    if (!mp_obj_is_type(sample, &audiocore_graph_type)) {
+        return false;
+    }
+    audiocore_graph_obj_t *other = MP_OBJ_TO_PTR(sample);
+    return other == graph || (other->output != NULL && node_plays(other->output, graph));
+}
+
+static bool node_plays(audiocore_graph_node_obj_t *node, audiocore_graph_obj_t *graph) {
+    MP_STACK_CHECK();
+    if (node->kind == AUDIOCORE_GRAPH_NODE_SOURCE) {
+        return sample_plays(node->sample, graph);
+    }
+    for (size_t i = 0; i < node->input_count; i++) {
+        if (node_plays(node->inputs[i], graph)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void common_hal_audiocore_graph_set_output(audiocore_graph_obj_t *self, audiocore_graph_node_obj_t *output) {
+    if (output != NULL && node_plays(output, self)) {
+        mp_raise_ValueError(MP_ERROR_TEXT("A graph can't play itself"));
+    }
+    self->output = output;
+    audiocore_graph_schedule(self);
+}
+
+static audiocore_graph_node_obj_t *new_node(audiocore_graph_obj_t *self, audiocore_graph_node_kind_t kind,
+    size_t input_count, mp_float_t level) {
+    audiocore_graph_node_obj_t *node = mp_obj_malloc(audiocore_graph_node_obj_t, &audiocore_graph_node_type);
+    node->graph = self;
+    node->kind = kind;
+    node->input_count = input_count;
+    node->inputs = input_count ? m_new(audiocore_graph_node_obj_t *, input_count) : NULL;
+    node->mark = 0;
+    node->output = NULL;
+    common_hal_audiocore_graph_node_set_level(node, level);
+    self->node_count++;
+    return node;
+}
+
+static void source_start(audiocore_graph_node_obj_t *node) {
+    audiocore_graph_obj_t *graph = node->graph;
+    node->remaining_frames = 0;
+    node->finished = false;
+    if (node->convert) {
+        audiosample_resampler_start(&node->resampler, node->sample, node->loop, graph->sample_rate, graph->channel_count);
+    } else {
+        audiosample_reset_buffer(node->sample, false, 0);
+        node->more_data = true;
+    }
+}
+
+audiocore_graph_node_obj_t *common_hal_audiocore_graph_new_source(audiocore_graph_obj_t *self, mp_obj_t sample, bool loop, mp_float_t level) {
+    if (sample_plays(sample, self)) {
+        mp_raise_ValueError(MP_ERROR_TEXT("A graph can't play itself"));
+    }
+    uint8_t bits_per_sample = audiosample_bits_per_sample(sample);
+    if (bits_per_sample != 8 && bits_per_sample != 16) {
+        mp_raise_ValueError(MP_ERROR_TEXT("bits_per_sample must be 8 or 16"));
+    }
+    uint8_t channel_count = audiosample_channel_count(sample);
+    mp_arg_validate_int_range(channel_count, 1, 2, MP_QSTR_channel_count);
+    bool single_buffer;
+    bool samples_signed;
+    uint32_t max_buffer_length;
+    uint8_t spacing;
+    audiosample_get_buffer_structure(sample, false, &single_buffer, &samples_signed,
+        &max_buffer_length, &spacing);
+
+    audiocore_graph_node_obj_t *node = new_node(self, AUDIOCORE_GRAPH_NODE_SOURCE, 0, level);
+    node->sample = sample;
+    node->loop = loop;
+    node->convert = audiosample_sample_rate(sample) != self->sample_rate
+        || channel_count != self->channel_count
+        || bits_per_sample != 16
+        || !samples_signed;
+    source_start(node);
+    return node;
+}
+
+static audiocore_graph_node_obj_t *validate_input(audiocore_graph_obj_t *self, mp_obj_t input) {
+    audiocore_graph_node_obj_t *node = MP_OBJ_TO_PTR(mp_arg_validate_type(input, &audiocore_graph_node_type, MP_QSTR_input));
+    if (node->graph != self) {
+        mp_raise_ValueError(MP_ERROR_TEXT("Node belongs to a different graph"));
+    }
+    return node;
+}
+
+audiocore_graph_node_obj_t *common_hal_audiocore_graph_new_gain(audiocore_graph_obj_t *self, mp_obj_t input, mp_float_t level) {
+    audiocore_graph_node_obj_t *source = validate_input(self, input);
+    audiocore_graph_node_obj_t *node = new_node(self, AUDIOCORE_GRAPH_NODE_GAIN, 1, level);
+    node->inputs[0] = source;
+    return node;
+}
+
+audiocore_graph_node_obj_t *common_hal_audiocore_graph_new_mix(audiocore_graph_obj_t *self, size_t n_inputs, const mp_obj_t *inputs, mp_float_t level) {
+    mp_arg_validate_length_min(n_inputs, 1, MP_QSTR_inputs);
+    // validate everything before allocating, so a bad input doesn't leave a half-made node
+    for (size_t i = 0; i < n_inputs; i++) {
+        validate_input(self, inputs[i]);
+    }
+    audiocore_graph_node_obj_t *node = new_node(self, AUDIOCORE_GRAPH_NODE_MIX, n_inputs, level);
+    for (size_t i = 0; i < n_inputs; i++) {
+        node->inputs[i] = MP_OBJ_TO_PTR(inputs[i]);
+    }
+    return node;
+}
+
+// Depth first, so that every node comes after its inputs. Nodes are created from existing
+// nodes, so there can't be a cycle.
+static void visit(audiocore_graph_obj_t *self, audiocore_graph_node_obj_t *node) {
+    MP_STACK_CHECK();
+    if (node->mark == self->generation) {
+        node->consumers++;
+        return;
+    }
+    node->mark = self->generation;
+    node->consumers = 1;
+    for (size_t i = 0; i < node->input_count; i++) {
+        visit(self, node->inputs[i]);
+    }
+    self->order[self->order_count++] = node;
+}
+
+static uint8_t take_buffer(audiocore_graph_obj_t *self, uint8_t *free_buffers, size_t *free_count) {
+    if (*free_count) {
+        return free_buffers[--*free_count];
+    }
+    if (self->buffer_count == AUDIOCORE_GRAPH_OUTPUT_BUFFER) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Too many buffers"));
+    }
+    return self->buffer_count++;
+}
+
+// Called once for each input that has been read. A fused gain never held a buffer, so the
+// buffer to give back is its input's.
+static void release_input(audiocore_graph_node_obj_t *input, uint8_t *free_buffers, size_t *free_count) {
+    if (input->fused) {
+        input = input->inputs[0];
+    }
+    if (--input->uses_left == 0) {
+        free_buffers[(*free_count)++] = input->buffer;
+    }
+}
+
+void audiocore_graph_schedule(audiocore_graph_obj_t *self) {
+    self->generation++;
+    self->order = m_new(audiocore_graph_node_obj_t *, self->node_count);
+    self->order_count = 0;
+    if (self->output) {
+        visit(self, self->output);
+    }
+
+    // A gain that only a mix reads is folded into the mix, which scales that input as it adds
+    // it up.
+    for (size_t i = 0; i < self->order_count; i++) {
+        self->order[i]->fused = false;
+    }
+    for (size_t i = 0; i < self->order_count; i++) {
+        audiocore_graph_node_obj_t *node = self->order[i];
+        if (node->kind != AUDIOCORE_GRAPH_NODE_MIX) {
+            continue;
+        }
+        for (size_t j = 0; j < node->input_count; j++) {
+            audiocore_graph_node_obj_t *input = node->inputs[j];
+            if (input->kind == AUDIOCORE_GRAPH_NODE_GAIN && input->consumers == 1) {
+                input->fused = true;
+            }
+        }
+    }
+
+    // Give each node a buffer from the pool, in processing order, and return a buffer to the
+    // pool after the last node that reads it. A gain node that is the only reader of its input
+    // works in place in its input's buffer. The output node writes to the output buffers.
+    uint8_t *free_buffers = m_new(uint8_t, self->order_count + 1);
+    size_t free_count = 0;
+    uint8_t buffer_count = self->buffer_count;
+    self->buffer_count = 0;
+    for (size_t i = 0; i < self->order_count; i++) {
+        audiocore_graph_node_obj_t *node = self->order[i];
+        node->uses_left = node->consumers;
+        node->shares_input_buffer = false;
+        if (node->fused) {
+            continue;
+        } else if (node == self->output) {
+            node->buffer = AUDIOCORE_GRAPH_OUTPUT_BUFFER;
+        } else if (node->kind == AUDIOCORE_GRAPH_NODE_GAIN && node->inputs[0]->consumers == 1) {
+            node->buffer = node->inputs[0]->buffer;
+            node->shares_input_buffer = true;
+            continue;
+        } else {
+            node->buffer = take_buffer(self, free_buffers, &free_count);
+        }
+        for (size_t j = 0; j < node->input_count; j++) {
+            release_input(node->inputs[j], free_buffers, &free_count);
+        }
+    }
+    m_del(uint8_t, free_buffers, self->order_count + 1);
+
+    if (self->buffer_count > buffer_count || self->buffers == NULL) {
+        size_t block_bytes = self->block_size * self->channel_count * sizeof(int16_t);
+        int16_t **buffers = m_new(int16_t *, self->buffer_count);
+        for (size_t i = 0; i < self->buffer_count; i++) {
+            buffers[i] = i < buffer_count ? self->buffers[i] : m_malloc(block_bytes);
+        }
+        self->buffers = buffers;
+    } else {
+        self->buffer_count = buffer_count;
+    }
+    self->done = false;
+}
+
+static int16_t *node_buffer(audiocore_graph_obj_t *self, audiocore_graph_node_obj_t *node) {
+    if (node->buffer == AUDIOCORE_GRAPH_OUTPUT_BUFFER) {
+        return self->output_buffers[self->output_index];
+    }
+    return self->buffers[node->buffer];
+}
+
+static void scale(int16_t *out, const int16_t *in, size_t count, int32_t level) {
+    if (level == UNITY_LEVEL) {
+        if (out != in) {
+            memcpy(out, in, count * sizeof(int16_t));
+        }
+        return;
+    }
+    // level is at most 1.0, so this can't overflow
+    for (size_t i = 0; i < count; i++) {
+        out[i] = (in[i] * level) >> 15;
+    }
+}
+
+static inline int32_t saturate16(int32_t value) {
+    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
+    return __SSAT(value, 16);
+    #else
+    return MIN(MAX(value, SHRT_MIN), SHRT_MAX);
+    #endif
+}
+
+// Make the next data from a sample that has the graph's format available in remaining.
+// Returns false when the sample has ended.
+static bool source_refill(audiocore_graph_node_obj_t *node) {
+    size_t frame_size = node->graph->channel_count * sizeof(int16_t);
+    bool restarted = false;
+    while (node->remaining_frames == 0) {
+        if (!node->more_data) {
+            // A looping sample that has no data at all would otherwise spin here forever.
+            if (!node->loop || restarted) {
+                return false;
+            }
+            audiosample_reset_buffer(node->sample, false, 0);
+            restarted = true;
+        }
+        uint8_t *buffer;
+        uint32_t buffer_length;
+        audioio_get_buffer_result_t result = audiosample_get_buffer(node->sample, false, 0, &buffer, &buffer_length);
+        if (result == GET_BUFFER_ERROR) {
+            return false;
+        }
+        node->more_data = result == GET_BUFFER_MORE_DATA;
+        if ((uintptr_t)buffer & 1) {
+            // Only possible for a RawSample over an odd slice of memory. It can't be read as
+            // int16_t, so convert it instead, which starts it over.
+            node->convert = true;
+            audiosample_resampler_start(&node->resampler, node->sample, node->loop,
+                node->graph->sample_rate, node->graph->channel_count);
+            return true;
+        }
+        node->remaining = (const int16_t *)buffer;
+        node->remaining_frames = buffer_length / frame_size;
+    }
+    return true;
+}
+
+static void process_source(audiocore_graph_obj_t *self, audiocore_graph_node_obj_t *node) {
+    uint32_t frames = self->block_size;
+    uint8_t channel_count = self->channel_count;
+    int16_t *out = node_buffer(self, node);
+    node->output = out;
+
+    // Straight from the sample's own buffer when a whole block is there
+    if (!node->convert && node->level == UNITY_LEVEL && node->remaining_frames >= frames) {
+        node->output = node->remaining;
+        node->remaining += frames * channel_count;
+        node->remaining_frames -= frames;
+        return;
+    }
+
+    uint32_t done = 0;
+    while (done < frames && !node->finished) {
+        if (node->convert) {
+            uint32_t produced = audiosample_resampler_read(&node->resampler, out + done * channel_count, frames - done);
+            scale(out + done * channel_count, out + done * channel_count, produced * channel_count, node->level);
+            done += produced;
+            node->finished = done < frames;
+        } else if (!source_refill(node)) {
+            node->finished = true;
+        } else if (!node->convert) {
+            uint32_t n = MIN(node->remaining_frames, frames - done);
+            scale(out + done * channel_count, node->remaining, n * channel_count, node->level);
+            node->remaining += n * channel_count;
+            node->remaining_frames -= n;
+            done += n;
+        }
+    }
+    memset(out + done * channel_count, 0, (frames - done) * channel_count * sizeof(int16_t));
+}
+
+static void process_gain(audiocore_graph_obj_t *self, audiocore_graph_node_obj_t *node) {
+    const int16_t *in = node->inputs[0]->output;
+    if (node->shares_input_buffer && node->level == UNITY_LEVEL) {
+        node->output = in;
+        return;
+    }
+    int16_t *out = node_buffer(self, node);
+    scale(out, in, self->block_size * self->channel_count, node->level);
+    node->output = out;
+}
+
+// Add one input into the bus, scaled by the level of a gain folded into the mix
+static void mix_input(int32_t *bus, const int16_t *in, size_t n, int32_t level, bool first) {
+    if (level == UNITY_LEVEL) {
+        if (first) {
+            for (size_t i = 0; i < n; i++) {
+                bus[i] = in[i];
+            }
+        } else {
+            for (size_t i = 0; i < n; i++) {
+                bus[i] += in[i];
+            }
+        }
+    } else {
+        if (first) {
+            for (size_t i = 0; i < n; i++) {
+                bus[i] = (in[i] * level) >> 15;
+            }
+        } else {
+            for (size_t i = 0; i < n; i++) {
+                bus[i] += (in[i] * level) >> 15;
+            }
+        }
+    }
+}
+
+static void process_mix(audiocore_graph_obj_t *self, audiocore_graph_node_obj_t *node) {
+    int16_t *out = node_buffer(self, node);
+    size_t count = self->block_size * self->channel_count;
+    int32_t bus[GRAPH_MIX_SAMPLES];
+    for (size_t offset = 0; offset < count; offset += GRAPH_MIX_SAMPLES) {
+        size_t n = MIN(GRAPH_MIX_SAMPLES, count - offset);
+        for (size_t j = 0; j < node->input_count; j++) {
+            audiocore_graph_node_obj_t *input = node->inputs[j];
+            int32_t level = UNITY_LEVEL;
+            if (input->fused) {
+                level = input->level;
+                input = input->inputs[0];
+            }
+            mix_input(bus, input->output + offset, n, level, j == 0);
+        }
+        if (node->level == UNITY_LEVEL) {
+            for (size_t i = 0; i < n; i++) {
+                out[offset + i] = saturate16(bus[i]);
+            }
+        } else {
+            for (size_t i = 0; i < n; i++) {
+                out[offset + i] = saturate16(((int64_t)bus[i] * node->level) >> 15);
+            }
+        }
+    }
+    node->output = out;
+}
+
+static void process_block(audiocore_graph_obj_t *self) {
+    bool playing = false;
+    for (size_t i = 0; i < self->order_count; i++) {
+        audiocore_graph_node_obj_t *node = self->order[i];
+        switch (node->kind) {
+            case AUDIOCORE_GRAPH_NODE_SOURCE:
+                process_source(self, node);
+                playing |= !node->finished;
+                break;
+            case AUDIOCORE_GRAPH_NODE_GAIN:
+                if (!node->fused) {
+                    process_gain(self, node);
+                }
+                break;
+            case AUDIOCORE_GRAPH_NODE_MIX:
+                process_mix(self, node);
+                break;
+        }
+    }
+    // Only a graph whose sources have all ended is done; one with no sources plays silence.
+    self->done = playing == false && self->order_count != 0;
+}
+
+void audiocore_graph_reset_buffer(audiocore_graph_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel) {
+    if (single_channel_output && channel == 1) {
+        return;
+    }
+    for (size_t i = 0; i < self->order_count; i++) {
+        audiocore_graph_node_obj_t *node = self->order[i];
+        if (node->kind == AUDIOCORE_GRAPH_NODE_SOURCE) {
+            source_start(node);
+        }
+    }
+    self->other_channel = -1;
+    self->done = false;
+}
+
+audioio_get_buffer_result_t audiocore_graph_get_buffer(audiocore_graph_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel,
+    uint8_t **buffer,
+    uint32_t *buffer_length) {
+    if (common_hal_audiocore_graph_deinited(self)) {
+        *buffer_length = 0;
+        return GET_BUFFER_ERROR;
+    }
+    *buffer_length = self->block_size * self->channel_count * sizeof(int16_t);
+    if (!single_channel_output) {
+        channel = 0;
+    }
+
+    if (channel == self->other_channel) {
+        // the other channel of the block that was just made
+        *buffer = (uint8_t *)(self->last_output + channel);
+        self->other_channel = -1;
+        return self->done ? GET_BUFFER_DONE : GET_BUFFER_MORE_DATA;
+    }
+
+    self->output_index = !self->output_index;
+    if (self->output == NULL) {
+        memset(self->output_buffers[self->output_index], 0, *buffer_length);
+        self->last_output = self->output_buffers[self->output_index];
+    } else {
+        process_block(self);
+        self->last_output = self->output->output;
+    }
+    if (single_channel_output) {
+        self->other_channel = 1 - channel;
+    }
+    *buffer = (uint8_t *)(self->last_output + channel);
+    return self->done ? GET_BUFFER_DONE : GET_BUFFER_MORE_DATA;
+}
+
+void audiocore_graph_get_buffer_structure(audiocore_graph_obj_t *self, bool single_channel_output,
+    bool *single_buffer, bool *samples_signed,
+    uint32_t *max_buffer_length, uint8_t *spacing) {
+    *single_buffer = false;
+    *samples_signed = true;
+    *max_buffer_length = self->block_size * self->channel_count * sizeof(int16_t);
+    if (single_channel_output) {
+        *spacing = self->channel_count;
+    } else {
+        *spacing = 1;
+    }
+}
+
+mp_float_t common_hal_audiocore_graph_node_get_level(audiocore_graph_node_obj_t *self) {
+    return (mp_float_t)self->level / UNITY_LEVEL;
+}
+
+void common_hal_audiocore_graph_node_set_level(audiocore_graph_node_obj_t *self, mp_float_t level) {
+    self->level = (int32_t)(level * UNITY_LEVEL);
+}
+
+bool common_hal_audiocore_graph_node_get_playing(audiocore_graph_node_obj_t *self) {
+    if (self->kind == AUDIOCORE_GRAPH_NODE_SOURCE) {
+        return !self->finished;
+    }
+    for (size_t i = 0; i < self->input_count; i++) {
+        if (common_hal_audiocore_graph_node_get_playing(self->inputs[i])) {
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,57 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+
+#include "shared-module/audiocore/__init__.h"
+#include "shared-module/audiocore/GraphNode.h"
+
+// A pull-based audio graph. Every node produces one block of signed 16-bit frames in the
+// graph's format each time the graph is pulled. The nodes that feed the output are put in
+// topological order once, when the output is set, and given buffers from a pool shared by the
+// whole graph: a buffer is reused as soon as its last reader has run, and nodes pass pointers
+// to their output rather than copying it.
+typedef struct audiocore_graph_obj {
+    mp_obj_base_t base;
+    uint32_t sample_rate;
+    uint16_t block_size; // in frames
+    uint8_t channel_count;
+    audiocore_graph_node_obj_t *output;
+
+    // The schedule: the nodes that feed the output, in the order they are processed
+    audiocore_graph_node_obj_t **order;
+    size_t order_count;
+    size_t node_count; // every node made by this graph, an upper bound for order_count
+    uint32_t generation;
+
+    int16_t **buffers;
+    uint8_t buffer_count;
+    // The output node writes to these in turn, because the consumer may still be reading the
+    // previous block
+    int16_t *output_buffers[2];
+    uint8_t output_index;
+
+    const int16_t *last_output;
+    uint8_t other_channel;
+    bool done;
+} audiocore_graph_obj_t;
+
+void audiocore_graph_schedule(audiocore_graph_obj_t *self);
+
+// These are not available from Python because it may be called in an interrupt.
+void audiocore_graph_reset_buffer(audiocore_graph_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel);
+audioio_get_buffer_result_t audiocore_graph_get_buffer(audiocore_graph_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel,
+    uint8_t **buffer,
+    uint32_t *buffer_length); // length in bytes
+void audiocore_graph_get_buffer_structure(audiocore_graph_obj_t *self, bool single_channel_output,
+    bool *single_buffer, bool *samples_signed,
+    uint32_t *max_buffer_length, uint8_t *spacing);
@@ -0,0 +1,54 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+
+#include "shared-module/audiocore/__init__.h"
+
+typedef enum {
+    AUDIOCORE_GRAPH_NODE_SOURCE,
+    AUDIOCORE_GRAPH_NODE_GAIN,
+    AUDIOCORE_GRAPH_NODE_MIX,
+} audiocore_graph_node_kind_t;
+
+// Values of buffer that aren't an index into the graph's buffer pool
+#define AUDIOCORE_GRAPH_OUTPUT_BUFFER (0xff)
+
+struct audiocore_graph_obj;
+
+typedef struct audiocore_graph_node_obj {
+    mp_obj_base_t base;
+    struct audiocore_graph_obj *graph;
+    audiocore_graph_node_kind_t kind;
+    int32_t level; // 1.0 is 1 << 15
+    size_t input_count;
+    struct audiocore_graph_node_obj **inputs;
+
+    // Source nodes. A sample that already has the graph's format is read straight from its
+    // own buffers, otherwise it is converted through resampler.
+    mp_obj_t sample;
+    bool loop;
+    bool convert;
+    bool more_data;
+    bool finished;
+    const int16_t *remaining;
+    uint32_t remaining_frames;
+    audiosample_resampler_t resampler;
+
+    // Set when the graph is scheduled
+    uint32_t mark; // the schedule this node was last visited by
+    uint16_t consumers; // the number of inputs in the schedule that read this node
+    uint16_t uses_left; // scratch, while allocating buffers
+    uint8_t buffer; // the pool buffer this node writes, or AUDIOCORE_GRAPH_OUTPUT_BUFFER
+    bool shares_input_buffer; // a gain node that took over its input's buffer
+    bool fused; // a gain node that the mix reading it applies, so it doesn't run itself
+
+    // Where this block's output is. This may be in the node's own buffer, its input's, or
+    // (for a source) the sample's.
+    const int16_t *output;
+} audiocore_graph_node_obj_t;
@@ -13,6 +13,7 @@
 #include "shared-module/audiocore/RawSample.h"
 
 void common_hal_audioio_rawsample_construct(audioio_rawsample_obj_t *self,
+    mp_obj_t buffer_obj,
     uint8_t *buffer,
     uint32_t len,
     uint8_t bytes_per_sample,
@@ -21,6 +22,7 @@ void common_hal_audioio_rawsample_construct(audioio_rawsample_obj_t *self,
     uint32_t sample_rate,
     bool single_buffer) {
 
+    self->buffer_obj = buffer_obj;
     self->buffer = buffer;
     self->bits_per_sample = bytes_per_sample * 8;
     self->samples_signed = samples_signed;
@@ -32,6 +34,7 @@ void common_hal_audioio_rawsample_construct(audioio_rawsample_obj_t *self,
 }
 
 void common_hal_audioio_rawsample_deinit(audioio_rawsample_obj_t *self) {
+    self->buffer_obj = MP_OBJ_NULL;
     self->buffer = NULL;
 }
 bool common_hal_audioio_rawsample_deinited(audioio_rawsample_obj_t *self) {
@@ -12,6 +12,7 @@
 
 typedef struct {
     mp_obj_base_t base;
+    mp_obj_t buffer_obj; // keeps buffer alive when it points into the middle of an object
     uint8_t *buffer;
     uint32_t len;
     uint8_t bits_per_sample;
@@ -10,7 +10,9 @@
 #include <string.h>
 
 #include "py/mperrno.h"
+#include "py/objtype.h"
 #include "py/runtime.h"
+#include "py/stream.h"
 
 #include "shared-module/audiocore/WaveFile.h"
 
@@ -24,37 +26,46 @@ struct wave_format_chunk {
     uint16_t extra_params; // Assumed to be zero below.
 };
 
+#if defined(MICROPY_UNIX_COVERAGE)
+#define background_callback_prevent() ((void)0)
+#define background_callback_allow() ((void)0)
+#define background_callback_add(buf, fn, arg) ((fn)((arg)))
+#endif
+
+static void wavefile_read_header(audioio_wavefile_obj_t *self, void *buf, size_t len) {
+    int errcode;
+    mp_uint_t bytes_read = mp_stream_read_exactly(self->file, buf, len, &errcode);
+    if (errcode != 0) {
+        mp_raise_OSError(errcode);
+    }
+    if (bytes_read != len) {
+        mp_arg_error_invalid(MP_QSTR_file);
+    }
+}
+
 void common_hal_audioio_wavefile_construct(audioio_wavefile_obj_t *self,
-    pyb_file_obj_t *file,
+    mp_obj_t file,
     uint8_t *buffer,
-    size_t buffer_size) {
+    size_t buffer_size,
+    uint8_t prefetch) {
     // Load the wave
     self->file = file;
     uint8_t chunk_header[16];
-    f_rewind(&self->file->fp);
-    UINT bytes_read;
-    if (f_read(&self->file->fp, chunk_header, 16, &bytes_read) != FR_OK) {
-        mp_raise_OSError(MP_EIO);
-    }
-    if (bytes_read != 16 ||
-        memcmp(chunk_header, "RIFF", 4) != 0 ||
+    // Start from the beginning if the stream can seek; otherwise read from where it is.
+    int errcode;
+    mp_stream_seek(self->file, 0, MP_SEEK_SET, &errcode);
+    wavefile_read_header(self, chunk_header, 16);
+    if (memcmp(chunk_header, "RIFF", 4) != 0 ||
         memcmp(chunk_header + 8, "WAVEfmt ", 8) != 0) {
         mp_arg_error_invalid(MP_QSTR_file);
     }
     uint32_t format_size;
-    if (f_read(&self->file->fp, &format_size, 4, &bytes_read) != FR_OK) {
-        mp_raise_OSError(MP_EIO);
-    }
-    if (bytes_read != 4 ||
-        format_size > sizeof(struct wave_format_chunk)) {
+    wavefile_read_header(self, &format_size, 4);
+    if (format_size > sizeof(struct wave_format_chunk)) {
         mp_raise_ValueError(MP_ERROR_TEXT("Invalid format chunk size"));
     }
     struct wave_format_chunk format;
-    if (f_read(&self->file->fp, &format, format_size, &bytes_read) != FR_OK) {
-        mp_raise_OSError(MP_EIO);
-    }
-    if (bytes_read != format_size) {
-    }
+    wavefile_read_header(self, &format, format_size);
 
     if (format.audio_format != 1 ||
         format.num_channels > 2 ||
@@ -71,49 +82,47 @@ void common_hal_audioio_wavefile_construct(audioio_wavefile_obj_t *self,
     // TODO(tannewt): Skip any extra chunks that occur before the data section.
 
     uint8_t data_tag[4];
-    if (f_read(&self->file->fp, &data_tag, 4, &bytes_read) != FR_OK) {
-        mp_raise_OSError(MP_EIO);
-    }
-    if (bytes_read != 4 ||
-        memcmp((uint8_t *)data_tag, "data", 4) != 0) {
+    wavefile_read_header(self, &data_tag, 4);
+    if (memcmp((uint8_t *)data_tag, "data", 4) != 0) {
         mp_raise_ValueError(MP_ERROR_TEXT("Data chunk must follow fmt chunk"));
     }
 
     uint32_t data_length;
-    if (f_read(&self->file->fp, &data_length, 4, &bytes_read) != FR_OK) {
-        mp_raise_OSError(MP_EIO);
-    }
-    if (bytes_read != 4) {
-        mp_arg_error_invalid(MP_QSTR_file);
-    }
+    wavefile_read_header(self, &data_length, 4);
     self->file_length = data_length;
-    self->data_start = self->file->fp.fptr;
+    self->data_start = 16 + 4 + format_size + 4 + 4;
 
-    // Try to allocate two buffers, one will be loaded from file and the other
-    // DMAed to DAC.
+    // Two slots are for the buffer being played and the one queued behind it. The rest are
+    // read ahead so that a slow file system doesn't hold up playback. Streams written in
+    // Python can't be read from a background callback, so they are only read on demand.
+    if (!mp_obj_is_native_type(mp_obj_get_type(file))) {
+        prefetch = 0;
+    }
+    self->slot_count = prefetch + 2;
     if (buffer_size) {
-        self->len = buffer_size / 2;
+        // A small buffer gets fewer slots rather than slots too short to hold a word. Keep
+        // each slot word aligned so the final one can be padded.
+        self->slot_count = MIN(self->slot_count, buffer_size / sizeof(uint32_t));
+        self->len = (buffer_size / self->slot_count) & ~(sizeof(uint32_t) - 1);
         self->buffer = buffer;
-        self->second_buffer = buffer + self->len;
     } else {
         self->len = 256;
-        self->buffer = m_malloc(self->len);
+        self->buffer = m_malloc(self->len * self->slot_count);
         if (self->buffer == NULL) {
             common_hal_audioio_wavefile_deinit(self);
-            m_malloc_fail(self->len);
-        }
-
-        self->second_buffer = m_malloc(self->len);
-        if (self->second_buffer == NULL) {
-            common_hal_audioio_wavefile_deinit(self);
-            m_malloc_fail(self->len);
+            m_malloc_fail(self->len * self->slot_count);
         }
     }
+    self->prefetch = self->slot_count - 2;
+    memset(self->silence, self->bits_per_sample == 8 ? 0x80 : 0, sizeof(self->silence));
+    self->head = 0;
+    self->underruns = 0;
+    self->bytes_remaining = 0;
+    self->bytes_unread = 0;
 }
 
 void common_hal_audioio_wavefile_deinit(audioio_wavefile_obj_t *self) {
     self->buffer = NULL;
-    self->second_buffer = NULL;
 }
 
 bool common_hal_audioio_wavefile_deinited(audioio_wavefile_obj_t *self) {
@@ -137,19 +146,84 @@ uint8_t common_hal_audioio_wavefile_get_channel_count(audioio_wavefile_obj_t *se
     return self->channel_count;
 }
 
+uint32_t common_hal_audioio_wavefile_get_underruns(audioio_wavefile_obj_t *self) {
+    return self->underruns;
+}
+
+// Read into the ring until `limit` slots are ready or the data runs out. A stream that has
+// nothing available right now (EAGAIN) ends the fill and it resumes on the next call. Errors
+// and a file shorter than its header claims are reported by get_buffer once the data before
+// them has played.
+static void wavefile_fill(audioio_wavefile_obj_t *self, uint8_t limit) {
+    const mp_stream_p_t *stream_p = mp_get_stream(self->file);
+    while (self->ready < limit && self->bytes_unread > 0 && !self->read_error) {
+        uint8_t slot = (self->head + self->ready) % self->slot_count;
+        uint8_t *buffer = self->buffer + slot * self->len;
+        uint32_t length = MIN(self->len, self->fill + self->bytes_unread);
+
+        int errcode;
+        mp_uint_t length_read = stream_p->read(self->file, buffer + self->fill, length - self->fill, &errcode);
+        if (length_read == MP_STREAM_ERROR) {
+            if (!mp_is_nonblocking_error(errcode)) {
+                self->read_error = true;
+            }
+            return;
+        }
+        if (length_read == 0) {
+            self->read_error = true;
+            return;
+        }
+        self->fill += length_read;
+        self->bytes_unread -= length_read;
+        if (self->fill < length) {
+            continue;
+        }
+
+        // Pad the last buffer to word align it.
+        uint8_t silence = self->bits_per_sample == 8 ? 0x80 : 0;
+        while (length % sizeof(uint32_t) != 0) {
+            buffer[length++] = silence;
+        }
+        self->slot_length[slot] = length;
+        self->fill = 0;
+        self->ready += 1;
+    }
+}
+
+static void wavefile_fill_cb(void *self_in) {
+    audioio_wavefile_obj_t *self = self_in;
+    if (common_hal_audioio_wavefile_deinited(self)) {
+        return;
+    }
+    wavefile_fill(self, self->prefetch);
+}
+
 void audioio_wavefile_reset_buffer(audioio_wavefile_obj_t *self,
     bool single_channel_output,
     uint8_t channel) {
     if (single_channel_output && channel == 1) {
         return;
     }
-    // We don't reset the buffer index in case we're looping and we have an odd number of buffer
-    // loads
+    // We don't reset the head in case we're looping and the two slots behind it are still
+    // playing.
+    background_callback_prevent();
     self->bytes_remaining = self->file_length;
-    f_lseek(&self->file->fp, self->data_start);
+    self->bytes_unread = self->file_length;
+    self->ready = 0;
+    self->fill = 0;
+    self->read_error = false;
+    // A stream that can't seek can still be played once, straight after construction.
+    int errcode;
+    mp_stream_seek(self->file, self->data_start, MP_SEEK_SET, &errcode);
     self->read_count = 0;
     self->left_read_count = 0;
     self->right_read_count = 0;
+    background_callback_allow();
+    if (self->prefetch > 0) {
+        // Get the first buffer in now so that playback starts with data on hand.
+        wavefile_fill(self, 1);
+        background_callback_add(&self->fill_cb, wavefile_fill_cb, self);
+    }
 }
 
 audioio_get_buffer_result_t audioio_wavefile_get_buffer(audioio_wavefile_obj_t *self,
@@ -175,54 +249,41 @@ audioio_get_buffer_result_t audioio_wavefile_get_buffer(audioio_wavefile_obj_t *
     }
 
     if (need_more_data) {
-        uint32_t num_bytes_to_load = self->len;
-        if (num_bytes_to_load > self->bytes_remaining) {
-            num_bytes_to_load = self->bytes_remaining;
-        }
-        UINT length_read;
-        if (self->buffer_index % 2 == 1) {
-            *buffer = self->second_buffer;
-        } else {
-            *buffer = self->buffer;
-        }
-        if (f_read(&self->file->fp, *buffer, num_bytes_to_load, &length_read) != FR_OK || length_read != num_bytes_to_load) {
-            return GET_BUFFER_ERROR;
-        }
-        self->bytes_remaining -= length_read;
-        // Pad the last buffer to word align it.
-        if (self->bytes_remaining == 0 && length_read % sizeof(uint32_t) != 0) {
-            uint32_t pad = length_read % sizeof(uint32_t);
-            length_read += pad;
-            if (self->bits_per_sample == 8) {
-                for (uint32_t i = 0; i < pad; i++) {
-                    ((uint8_t *)(*buffer))[length_read / sizeof(uint8_t) - i - 1] = 0x80;
+        if (self->ready == 0) {
+            // The read ahead didn't keep up (or there is none), so read the data here.
+            if (self->prefetch > 0) {
+                self->underruns += 1;
+            }
+            wavefile_fill(self, 1);
+            if (self->ready == 0) {
+                if (self->read_error) {
+                    *buffer = NULL;
+                    *buffer_length = 0;
+                    return GET_BUFFER_ERROR;
                 }
-            } else if (self->bits_per_sample == 16) {
-                // We know the buffer is aligned because we allocated it onto the heap ourselves.
-                #pragma GCC diagnostic push
-                #pragma GCC diagnostic ignored "-Wcast-align"
-                ((int16_t *)(*buffer))[length_read / sizeof(int16_t) - 1] = 0;
-                #pragma GCC diagnostic pop
+                // The stream has nothing for us yet. Play a moment of silence rather than
+                // waiting for it, and try again next time.
+                if (self->prefetch == 0) {
+                    self->underruns += 1;
+                }
+                *buffer = (uint8_t *)self->silence;
+                *buffer_length = sizeof(self->silence);
+                return GET_BUFFER_MORE_DATA;
             }
         }
-        *buffer_length = length_read;
-        if (self->buffer_index % 2 == 1) {
-            self->second_buffer_length = length_read;
-        } else {
-            self->buffer_length = length_read;
-        }
-        self->buffer_index += 1;
+        self->head = (self->head + 1) % self->slot_count;
+        self->ready -= 1;
+        self->bytes_remaining -= MIN(self->len, self->bytes_remaining);
         self->read_count += 1;
+        if (self->prefetch > 0 && self->bytes_unread > 0) {
+            background_callback_add(&self->fill_cb, wavefile_fill_cb, self);
+        }
     }
 
     uint32_t buffers_back = self->read_count - 1 - channel_read_count;
-    if ((self->buffer_index - buffers_back) % 2 == 0) {
-        *buffer = self->second_buffer;
-        *buffer_length = self->second_buffer_length;
-    } else {
-        *buffer = self->buffer;
-        *buffer_length = self->buffer_length;
-    }
+    uint8_t slot = (self->head + self->slot_count - 1 - buffers_back) % self->slot_count;
+    *buffer = self->buffer + slot * self->len;
+    *buffer_length = self->slot_length[slot];
 
     if (channel == 0) {
         self->left_read_count += 1;
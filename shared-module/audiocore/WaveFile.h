@@ -6,28 +6,41 @@
 
 #pragma once
 
-#include "extmod/vfs_fat.h"
 #include "py/obj.h"
 
 #include "shared-module/audiocore/__init__.h"
+#include "supervisor/background_callback.h"
+
+#define AUDIOIO_WAVEFILE_MAX_PREFETCH (8)
 
 typedef struct {
     mp_obj_base_t base;
+    // A ring of slot_count buffers, len bytes each. The two most recently handed out slots may
+    // still be playing; the rest are filled ahead of playback from a background callback.
     uint8_t *buffer;
-    uint32_t buffer_length;
-    uint8_t *second_buffer;
-    uint32_t second_buffer_length;
+    uint32_t slot_length[AUDIOIO_WAVEFILE_MAX_PREFETCH + 2];
+    uint8_t slot_count;
+    uint8_t prefetch;
+    uint8_t head; // Next slot to hand out
+    uint8_t ready; // Number of filled slots starting at head
+    uint32_t fill; // Bytes already read into the slot after the ready ones
+    bool read_error;
+    uint32_t underruns;
+
     uint32_t file_length; // In bytes
     uint16_t data_start; // Where the data values start
     uint8_t bits_per_sample;
-    uint16_t buffer_index;
-    uint32_t bytes_remaining;
+    uint32_t bytes_remaining; // Not yet handed out
+    uint32_t bytes_unread; // Not yet read into the ring
 
     uint8_t channel_count;
     uint32_t sample_rate;
 
     uint32_t len;
-    pyb_file_obj_t *file;
+    // Handed out when a non-blocking stream has no data yet
+    uint32_t silence[8];
+    mp_obj_t file;
+    background_callback_t fill_cb;
 
     uint32_t read_count;
     uint32_t left_read_count;
@@ -110,3 +110,212 @@ void audiosample_convert_s16m_s16s(int16_t *buffer_out, const int16_t *buffer_in
         *buffer_out++ = sample;
     }
 }
+
+void audiosample_resampler_start(audiosample_resampler_t *self, mp_obj_t sample, bool loop,
+    uint32_t output_sample_rate, uint8_t output_channel_count) {
+    bool single_buffer;
+    uint32_t max_buffer_length;
+    uint8_t spacing;
+    audiosample_get_buffer_structure(sample, false, &single_buffer, &self->samples_signed,
+        &max_buffer_length, &spacing);
+    self->sample = sample;
+    self->bits_per_sample = audiosample_bits_per_sample(sample);
+    self->channel_count = audiosample_channel_count(sample);
+    self->output_channel_count = output_channel_count;
+    self->loop = loop;
+    self->step = ((uint64_t)audiosample_sample_rate(sample) << 16) / output_sample_rate;
+    self->direct = self->step == 1 << 16;
+    self->buffer_length = 0;
+    self->more_data = true;
+    self->finished = false;
+
+    audiosample_reset_buffer(sample, false, 0);
+    // Prime the interpolator so the first output frame is exactly the first source frame.
+    self->phase = 2 << 16;
+}
+
+// Make at least one whole source frame available in buffer. Returns false at the end of a
+// sample that doesn't loop.
+static bool resampler_refill(audiosample_resampler_t *self) {
+    uint32_t frame_size = self->channel_count * self->bits_per_sample / 8;
+    bool restarted = false;
+    while (self->buffer_length < frame_size) {
+        if (!self->more_data) {
+            // A looping sample that has no data at all would otherwise spin here forever.
+            if (!self->loop || restarted) {
+                return false;
+            }
+            audiosample_reset_buffer(self->sample, false, 0);
+            restarted = true;
+        }
+        uint8_t *buffer;
+        audioio_get_buffer_result_t result = audiosample_get_buffer(self->sample, false, 0, &buffer, &self->buffer_length);
+        if (result == GET_BUFFER_ERROR) {
+            self->buffer_length = 0;
+            return false;
+        }
+        self->buffer = buffer;
+        self->more_data = result == GET_BUFFER_MORE_DATA;
+    }
+    return true;
+}
+
+// Decode the next source frame into the output channel layout. Returns false at the end of a
+// sample that doesn't loop.
+static bool resampler_next_frame(audiosample_resampler_t *self, int16_t *frame) {
+    if (!resampler_refill(self)) {
+        return false;
+    }
+
+    uint32_t frame_size = self->channel_count * self->bits_per_sample / 8;
+    int32_t left, right;
+    if (self->bits_per_sample == 16) {
+        const uint16_t *src = (const uint16_t *)self->buffer;
+        uint16_t flip = self->samples_signed ? 0 : 0x8000;
+        left = (int16_t)(src[0] ^ flip);
+        right = self->channel_count == 2 ? (int16_t)(src[1] ^ flip) : left;
+    } else {
+        uint8_t flip = self->samples_signed ? 0 : 0x80;
+        left = (int8_t)(self->buffer[0] ^ flip) * 256;
+        right = self->channel_count == 2 ? (int8_t)(self->buffer[1] ^ flip) * 256 : left;
+    }
+    self->buffer += frame_size;
+    self->buffer_length -= frame_size;
+
+    if (self->output_channel_count == 2) {
+        frame[0] = left;
+        frame[1] = right;
+    } else {
+        frame[0] = (left + right) / 2;
+    }
+    return true;
+}
+
+// Convert frames straight from the source data, for a sample at the output rate. Each loop is
+// specialised for one source sample size and for writing or mixing, and handles the channel
+// layout with the sign flip, so that the conversion is done on the way into the output.
+#define LOAD16(i) ((int16_t)(src16[i] ^ flip))
+#define LOAD8(i) ((int8_t)(src8[i] ^ flip) * 256)
+#define STORE(i, value) (output[i] = (value))
+#define MIX(i, value) (bus[i] += ((value) * level) >> 15)
+#define DIRECT_LOOP(LOAD, PUT) \
+    if (in_channels == out_channels) { \
+        for (uint32_t i = 0; i < frames * out_channels; i++) { \
+            PUT(i, LOAD(i)); \
+        } \
+    } else if (out_channels == 2) { \
+        for (uint32_t i = 0; i < frames; i++) { \
+            int32_t value = LOAD(i); \
+            PUT(2 * i, value); \
+            PUT(2 * i + 1, value); \
+        } \
+    } else { \
+        for (uint32_t i = 0; i < frames; i++) { \
+            PUT(i, (LOAD(2 * i) + LOAD(2 * i + 1)) / 2); \
+        } \
+    }
+
+static void direct_convert(const audiosample_resampler_t *self, uint32_t frames,
+    int16_t *output, int32_t *bus, int32_t level) {
+    uint8_t in_channels = self->channel_count;
+    uint8_t out_channels = self->output_channel_count;
+    if (self->bits_per_sample == 16) {
+        const uint16_t *src16 = (const uint16_t *)self->buffer;
+        uint16_t flip = self->samples_signed ? 0 : 0x8000;
+        if (output) {
+            DIRECT_LOOP(LOAD16, STORE);
+        } else {
+            DIRECT_LOOP(LOAD16, MIX);
+        }
+    } else {
+        const uint8_t *src8 = self->buffer;
+        uint8_t flip = self->samples_signed ? 0 : 0x80;
+        if (output) {
+            DIRECT_LOOP(LOAD8, STORE);
+        } else {
+            DIRECT_LOOP(LOAD8, MIX);
+        }
+    }
+}
+
+#undef LOAD16
+#undef LOAD8
+#undef STORE
+#undef MIX
+#undef DIRECT_LOOP
+
+// Write frames to output, or mix them into bus when output is NULL
+static uint32_t direct_read(audiosample_resampler_t *self, int16_t *output, int32_t *bus,
+    uint32_t frames, int32_t level) {
+    uint32_t frame_size = self->channel_count * self->bits_per_sample / 8;
+    uint8_t out_channels = self->output_channel_count;
+    uint32_t done = 0;
+    while (done < frames) {
+        if (self->finished || !resampler_refill(self)) {
+            self->finished = true;
+            break;
+        }
+        uint32_t n = MIN(frames - done, self->buffer_length / frame_size);
+        direct_convert(self, n, output ? output + done * out_channels : NULL,
+            bus ? bus + done * out_channels : NULL, level);
+        self->buffer += n * frame_size;
+        self->buffer_length -= n * frame_size;
+        done += n;
+    }
+    return done;
+}
+
+uint32_t audiosample_resampler_read(audiosample_resampler_t *self, int16_t *output, uint32_t frames) {
+    if (self->direct) {
+        return direct_read(self, output, NULL, frames, 0);
+    }
+    uint8_t channels = self->output_channel_count;
+    int16_t *a = self->frame[0];
+    int16_t *b = self->frame[1];
+    for (uint32_t i = 0; i < frames; i++) {
+        while (self->phase >= 1 << 16) {
+            if (self->finished) {
+                return i;
+            }
+            self->phase -= 1 << 16;
+            a[0] = b[0];
+            a[1] = b[1];
+            if (!resampler_next_frame(self, b)) {
+                // Hold the last frame until it has been played out.
+                self->finished = true;
+            }
+        }
+        // phase is below 1 << 16, so halve it to keep the product within 32 bits.
+        int32_t t = self->phase >> 1;
+        for (uint8_t c = 0; c < channels; c++) {
+            *output++ = a[c] + (((b[c] - a[c]) * t) >> 15);
+        }
+        self->phase += self->step;
+    }
+    return frames;
+}
+
+// Interpolated frames are mixed from a small block on the stack
+#define RESAMPLER_MIX_FRAMES (64)
+
+uint32_t audiosample_resampler_mix(audiosample_resampler_t *self, int32_t *bus, uint32_t frames, int32_t level) {
+    if (self->direct) {
+        return direct_read(self, NULL, bus, frames, level);
+    }
+    uint8_t channels = self->output_channel_count;
+    int16_t block[RESAMPLER_MIX_FRAMES * 2];
+    uint32_t done = 0;
+    while (done < frames) {
+        uint32_t wanted = MIN(frames - done, RESAMPLER_MIX_FRAMES);
+        uint32_t produced = audiosample_resampler_read(self, block, wanted);
+        int32_t *out = bus + done * channels;
+        for (uint32_t i = 0; i < produced * channels; i++) {
+            out[i] += (block[i] * level) >> 15;
+        }
+        done += produced;
+        if (produced < wanted) {
+            break;
+        }
+    }
+    return done;
+}
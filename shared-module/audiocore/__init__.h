@@ -60,3 +60,32 @@ void audiosample_convert_s8s_s16s(int16_t *buffer_out, const int8_t *buffer_in,
 void audiosample_convert_u16m_s16s(int16_t *buffer_out, const uint16_t *buffer_in, size_t nframes);
 void audiosample_convert_u16s_s16s(int16_t *buffer_out, const uint16_t *buffer_in, size_t nframes);
 void audiosample_convert_s16m_s16s(int16_t *buffer_out, const int16_t *buffer_in, size_t nframes);
+
+// Streams any sample as signed 16-bit frames at another sample rate and channel count, so that
+// consumers with a fixed output format can play it. Rates are converted by linear
+// interpolation in 16.16 fixed point. A sample that is already at the output rate is converted
+// straight from its own buffers, a block at a time.
+typedef struct {
+    mp_obj_t sample;
+    const uint8_t *buffer; // source data not yet converted
+    uint32_t buffer_length; // in bytes
+    uint32_t step; // source frames per output frame, 16.16 fixed point
+    uint32_t phase; // position between frame[0] and frame[1], 16.16 fixed point
+    int16_t frame[2][2]; // the two source frames being interpolated, in the output channel layout
+    uint8_t bits_per_sample;
+    uint8_t channel_count;
+    uint8_t output_channel_count;
+    bool samples_signed;
+    bool loop;
+    bool more_data;
+    bool finished;
+    bool direct; // the rates match, so frames are converted without interpolating
+} audiosample_resampler_t;
+
+void audiosample_resampler_start(audiosample_resampler_t *self, mp_obj_t sample, bool loop,
+    uint32_t output_sample_rate, uint8_t output_channel_count);
+// Returns the number of frames written to output; fewer than requested means the sample ended.
+uint32_t audiosample_resampler_read(audiosample_resampler_t *self, int16_t *output, uint32_t frames);
+// Adds frames into a 32-bit bus instead, each sample scaled by level (1 << 15 is unity), without
+// an intermediate buffer when the rates match. Returns the number of frames added.
+uint32_t audiosample_resampler_mix(audiosample_resampler_t *self, int32_t *bus, uint32_t frames, int32_t level);
@@ -8,6 +8,7 @@
 #include "shared-bindings/audiomixer/MixerVoice.h"
 
 #include <stdint.h>
+#include <string.h>
 
 #include "py/runtime.h"
 #include "shared-module/audiocore/__init__.h"
@@ -82,93 +83,74 @@ void audiomixer_mixer_reset_buffer(audiomixer_mixer_obj_t *self,
     }
 }
 
-__attribute__((always_inline))
-static inline uint32_t add16signed(uint32_t a, uint32_t b) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
-    return __QADD16(a, b);
-    #else
-    uint32_t result = 0;
-    for (int8_t i = 0; i < 2; i++) {
-        int16_t ai = a >> (sizeof(int16_t) * 8 * i);
-        int16_t bi = b >> (sizeof(int16_t) * 8 * i);
-        int32_t intermediate = (int32_t)ai + bi;
-        if (intermediate > SHRT_MAX) {
-            intermediate = SHRT_MAX;
-        } else if (intermediate < SHRT_MIN) {
-            intermediate = SHRT_MIN;
+// Voices are summed into a 32-bit bus one block at a time and the bus is saturated once, as it
+// is written out, so the result doesn't depend on voice order and no headroom is lost between
+// voices. The block is small enough to stay on the stack and in cache while every voice is
+// added into it. All samples are accumulated at 16-bit scale; 8-bit samples are shifted up on
+// the way in and back down on the way out.
+#define MIXER_BLOCK_SAMPLES (128)
+
+static void accumulate16(int32_t *bus, const int16_t *src, uint32_t count, int32_t level, bool samples_signed) {
+    if (MP_LIKELY(samples_signed)) {
+        for (uint32_t i = 0; i < count; i++) {
+            bus[i] += (src[i] * level) >> 15;
+        }
+    } else {
+        for (uint32_t i = 0; i < count; i++) {
+            bus[i] += ((int16_t)(src[i] ^ 0x8000) * level) >> 15;
         }
-        result |= (((uint32_t)intermediate) & 0xffff) << (sizeof(int16_t) * 8 * i);
     }
-    return result;
-    #endif
 }
 
-__attribute__((always_inline))
-static inline uint32_t mult16signed(uint32_t val, int32_t mul) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
-    mul <<= 16;
-    int32_t hi, lo;
-    enum { bits = 16 }; // saturate to 16 bits
-    enum { shift = 15 }; // shift is done automatically
-    asm volatile ("smulwb %0, %1, %2" : "=r" (lo) : "r" (mul), "r" (val));
-    asm volatile ("smulwt %0, %1, %2" : "=r" (hi) : "r" (mul), "r" (val));
-    asm volatile ("ssat %0, %1, %2, asr %3" : "=r" (lo) : "I" (bits), "r" (lo), "I" (shift));
-    asm volatile ("ssat %0, %1, %2, asr %3" : "=r" (hi) : "I" (bits), "r" (hi), "I" (shift));
-    asm volatile ("pkhbt %0, %1, %2, lsl #16" : "=r" (val) : "r" (lo), "r" (hi)); // pack
-    return val;
-    #else
-    uint32_t result = 0;
-    float mod_mul = (float)mul / (float)((1 << 15) - 1);
-    for (int8_t i = 0; i < 2; i++) {
-        int16_t ai = (val >> (sizeof(uint16_t) * 8 * i));
-        int32_t intermediate = (int32_t)(ai * mod_mul);
-        if (intermediate > SHRT_MAX) {
-            intermediate = SHRT_MAX;
-        } else if (intermediate < SHRT_MIN) {
-            intermediate = SHRT_MIN;
+static void accumulate8(int32_t *bus, const int8_t *src, uint32_t count, int32_t level, bool samples_signed) {
+    if (samples_signed) {
+        for (uint32_t i = 0; i < count; i++) {
+            bus[i] += (src[i] * 256 * level) >> 15;
+        }
+    } else {
+        for (uint32_t i = 0; i < count; i++) {
+            bus[i] += ((int8_t)(src[i] ^ 0x80) * 256 * level) >> 15;
         }
-        intermediate &= 0x0000FFFF;
-        result |= (((uint32_t)intermediate)) << (sizeof(int16_t) * 8 * i);
     }
-    return result;
-    #endif
-}
-
-static inline uint32_t tounsigned8(uint32_t val) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
-    return __UADD8(val, 0x80808080);
-    #else
-    return val ^ 0x80808080;
-    #endif
 }
 
-static inline uint32_t tounsigned16(uint32_t val) {
+static inline int32_t saturate16(int32_t value) {
     #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
-    return __UADD16(val, 0x80008000);
+    return __SSAT(value, 16);
     #else
-    return val ^ 0x80008000;
+    return MIN(MAX(value, SHRT_MIN), SHRT_MAX);
     #endif
 }
 
-static inline uint32_t tosigned16(uint32_t val) {
+static void write_bus16(uint16_t *out, const int32_t *bus, uint32_t count, bool samples_signed) {
+    uint16_t flip = samples_signed ? 0 : 0x8000;
     #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
-    return __UADD16(val, 0x80008000);
+    // count is always even, so write pairs of saturated samples a word at a time.
+    uint32_t *word_out = (uint32_t *)out;
+    uint32_t word_flip = flip * 0x10001;
+    for (uint32_t i = 0; i < count; i += 2) {
+        word_out[i / 2] = __PKHBT(__SSAT(bus[i], 16), __SSAT(bus[i + 1], 16), 16) ^ word_flip;
+    }
     #else
-    return val ^ 0x80008000;
+    for (uint32_t i = 0; i < count; i++) {
+        out[i] = saturate16(bus[i]) ^ flip;
+    }
     #endif
 }
 
-static inline uint32_t unpack8(uint16_t val) {
-    return ((val & 0xff00) << 16) | ((val & 0x00ff) << 8);
-}
-
-static inline uint32_t pack8(uint32_t val) {
-    return ((val & 0xff000000) >> 16) | ((val & 0xff00) >> 8);
+static void write_bus8(uint8_t *out, const int32_t *bus, uint32_t count, bool samples_signed) {
+    uint8_t flip = samples_signed ? 0 : 0x80;
+    for (uint32_t i = 0; i < count; i++) {
+        out[i] = (saturate16(bus[i]) >> 8) ^ flip;
+    }
 }
 
-static void mix_down_one_voice(audiomixer_mixer_obj_t *self,
-    audiomixer_mixervoice_obj_t *voice, bool voices_active,
-    uint32_t *word_buffer, uint32_t length) {
+// Add up to `length` words of the voice into the bus, refilling and looping the voice's sample
+// as needed. A voice that runs out of data without looping is stopped.
+static void mix_one_voice(audiomixer_mixer_obj_t *self,
+    audiomixer_mixervoice_obj_t *voice, int32_t *bus, uint32_t length) {
+    uint32_t samples_per_word = sizeof(uint32_t) * 8 / self->bits_per_sample;
+    int32_t level = voice->level;
     while (length != 0) {
         if (voice->buffer_length == 0) {
             if (!voice->more_data) {
@@ -176,87 +158,37 @@ static void mix_down_one_voice(audiomixer_mixer_obj_t *self,
                     audiosample_reset_buffer(voice->sample, false, 0);
                 } else {
                     voice->sample = NULL;
-                    break;
+                    return;
                 }
             }
-            if (voice->sample) {
-                // Load another buffer
-                audioio_get_buffer_result_t result = audiosample_get_buffer(voice->sample, false, 0, (uint8_t **)&voice->remaining_buffer, &voice->buffer_length);
-                // Track length in terms of words.
-                voice->buffer_length /= sizeof(uint32_t);
-                voice->more_data = result == GET_BUFFER_MORE_DATA;
-            }
+            // Load another buffer
+            audioio_get_buffer_result_t result = audiosample_get_buffer(voice->sample, false, 0, (uint8_t **)&voice->remaining_buffer, &voice->buffer_length);
+            // Track length in terms of words.
+            voice->buffer_length /= sizeof(uint32_t);
+            voice->more_data = result == GET_BUFFER_MORE_DATA;
         }
 
         uint32_t n = MIN(voice->buffer_length, length);
-        uint32_t *src = voice->remaining_buffer;
-        uint16_t level = voice->level;
-
-        // First active voice gets copied over verbatim.
-        if (!voices_active) {
-            if (MP_LIKELY(self->bits_per_sample == 16)) {
-                if (MP_LIKELY(self->samples_signed)) {
-                    for (uint32_t i = 0; i < n; i++) {
-                        uint32_t v = src[i];
-                        word_buffer[i] = mult16signed(v, level);
-                    }
-                } else {
-                    for (uint32_t i = 0; i < n; i++) {
-                        uint32_t v = src[i];
-                        v = tosigned16(v);
-                        word_buffer[i] = mult16signed(v, level);
-                    }
-                }
-            } else {
-                uint16_t *hword_buffer = (uint16_t *)word_buffer;
-                uint16_t *hsrc = (uint16_t *)src;
-                for (uint32_t i = 0; i < n * 2; i++) {
-                    uint32_t word = unpack8(hsrc[i]);
-                    if (MP_LIKELY(!self->samples_signed)) {
-                        word = tosigned16(word);
-                    }
-                    word = mult16signed(word, level);
-                    hword_buffer[i] = pack8(word);
-                }
-            }
+        if (MP_LIKELY(self->bits_per_sample == 16)) {
+            accumulate16(bus, (const int16_t *)voice->remaining_buffer, n * samples_per_word, level, self->samples_signed);
         } else {
-            if (MP_LIKELY(self->bits_per_sample == 16)) {
-                if (MP_LIKELY(self->samples_signed)) {
-                    for (uint32_t i = 0; i < n; i++) {
-                        uint32_t word = src[i];
-                        word_buffer[i] = add16signed(mult16signed(word, level), word_buffer[i]);
-                    }
-                } else {
-                    for (uint32_t i = 0; i < n; i++) {
-                        uint32_t word = src[i];
-                        word = tosigned16(word);
-                        word_buffer[i] = add16signed(mult16signed(word, level), word_buffer[i]);
-                    }
-                }
-            } else {
-                uint16_t *hword_buffer = (uint16_t *)word_buffer;
-                uint16_t *hsrc = (uint16_t *)src;
-                for (uint32_t i = 0; i < n * 2; i++) {
-                    uint32_t word = unpack8(hsrc[i]);
-                    if (MP_LIKELY(!self->samples_signed)) {
-                        word = tosigned16(word);
-                    }
-                    word = mult16signed(word, level);
-                    word = add16signed(word, unpack8(hword_buffer[i]));
-                    hword_buffer[i] = pack8(word);
-                }
-            }
+            accumulate8(bus, (const int8_t *)voice->remaining_buffer, n * samples_per_word, level, self->samples_signed);
         }
         length -= n;
-        word_buffer += n;
+        bus += n * samples_per_word;
         voice->remaining_buffer += n;
         voice->buffer_length -= n;
     }
+}
 
-    if (length && !voices_active) {
-        for (uint32_t i = 0; i < length; i++) {
-            word_buffer[i] = 0;
-        }
+// Voices whose sample doesn't match the mixer's format are read through their resampler, which
+// adds them into the bus in the mixer's channel layout at the mixer's rate. A sample at the
+// mixer's rate is converted as it is added, straight from its own buffers.
+static void mix_one_converted_voice(audiomixer_mixer_obj_t *self,
+    audiomixer_mixervoice_obj_t *voice, int32_t *bus, uint32_t count) {
+    uint32_t frames = count / self->channel_count;
+    if (audiosample_resampler_mix(&voice->resampler, bus, frames, voice->level) < frames) {
+        voice->sample = NULL;
     }
 }
 
@@ -286,33 +218,30 @@ audioio_get_buffer_result_t audiomixer_mixer_get_buffer(audiomixer_mixer_obj_t *
             word_buffer = self->second_buffer;
         }
         self->use_first_buffer = !self->use_first_buffer;
-        bool voices_active = false;
         uint32_t length = self->len / sizeof(uint32_t);
-
-        for (int32_t v = 0; v < self->voice_count; v++) {
-            audiomixer_mixervoice_obj_t *voice = MP_OBJ_TO_PTR(self->voice[v]);
-            if (voice->sample) {
-                mix_down_one_voice(self, voice, voices_active, word_buffer, length);
-                voices_active = true;
-            }
-        }
-
-        if (!voices_active) {
-            for (uint32_t i = 0; i < length; i++) {
-                word_buffer[i] = 0;
-            }
-        }
-
-        if (!self->samples_signed) {
-            if (self->bits_per_sample == 16) {
-                for (uint32_t i = 0; i < length; i++) {
-                    word_buffer[i] = tounsigned16(word_buffer[i]);
+        uint32_t samples_per_word = sizeof(uint32_t) * 8 / self->bits_per_sample;
+        uint32_t block_words = MIXER_BLOCK_SAMPLES / samples_per_word;
+        int32_t bus[MIXER_BLOCK_SAMPLES];
+
+        for (uint32_t offset = 0; offset < length; offset += block_words) {
+            uint32_t n = MIN(block_words, length - offset);
+            memset(bus, 0, n * samples_per_word * sizeof(int32_t));
+            for (int32_t v = 0; v < self->voice_count; v++) {
+                audiomixer_mixervoice_obj_t *voice = MP_OBJ_TO_PTR(self->voice[v]);
+                if (voice->sample == NULL) {
+                    continue;
                 }
-            } else {
-                for (uint32_t i = 0; i < length; i++) {
-                    word_buffer[i] = tounsigned8(word_buffer[i]);
+                if (voice->convert) {
+                    mix_one_converted_voice(self, voice, bus, n * samples_per_word);
+                } else {
+                    mix_one_voice(self, voice, bus, n);
                 }
             }
+            if (MP_LIKELY(self->bits_per_sample == 16)) {
+                write_bus16((uint16_t *)(word_buffer + offset), bus, n * samples_per_word, self->samples_signed);
+            } else {
+                write_bus8((uint8_t *)(word_buffer + offset), bus, n * samples_per_word, self->samples_signed);
+            }
         }
 
         self->read_count += 1;
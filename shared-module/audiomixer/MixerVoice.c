@@ -31,32 +31,37 @@ void common_hal_audiomixer_mixervoice_set_level(audiomixer_mixervoice_obj_t *sel
 }
 
 void common_hal_audiomixer_mixervoice_play(audiomixer_mixervoice_obj_t *self, mp_obj_t sample, bool loop) {
-    if (audiosample_sample_rate(sample) != self->parent->sample_rate) {
-        mp_raise_ValueError(MP_ERROR_TEXT("The sample's sample rate does not match the mixer's"));
-    }
-    if (audiosample_channel_count(sample) != self->parent->channel_count) {
-        mp_raise_ValueError(MP_ERROR_TEXT("The sample's channel count does not match the mixer's"));
-    }
-    if (audiosample_bits_per_sample(sample) != self->parent->bits_per_sample) {
-        mp_raise_ValueError(MP_ERROR_TEXT("The sample's bits_per_sample does not match the mixer's"));
+    audiomixer_mixer_obj_t *parent = self->parent;
+    uint8_t bits_per_sample = audiosample_bits_per_sample(sample);
+    if (bits_per_sample != 8 && bits_per_sample != 16) {
+        mp_raise_ValueError(MP_ERROR_TEXT("bits_per_sample must be 8 or 16"));
     }
+    uint8_t channel_count = audiosample_channel_count(sample);
+    mp_arg_validate_int_range(channel_count, 1, 2, MP_QSTR_channel_count);
     bool single_buffer;
     bool samples_signed;
     uint32_t max_buffer_length;
     uint8_t spacing;
     audiosample_get_buffer_structure(sample, false, &single_buffer, &samples_signed,
         &max_buffer_length, &spacing);
-    if (samples_signed != self->parent->samples_signed) {
-        mp_raise_ValueError(MP_ERROR_TEXT("The sample's signedness does not match the mixer's"));
+
+    // Stop mixing this voice while it is being set up.
+    self->sample = NULL;
+    self->loop = loop;
+    self->convert = audiosample_sample_rate(sample) != parent->sample_rate
+        || channel_count != parent->channel_count
+        || bits_per_sample != parent->bits_per_sample
+        || samples_signed != parent->samples_signed;
+    if (self->convert) {
+        audiosample_resampler_start(&self->resampler, sample, loop, parent->sample_rate, parent->channel_count);
+    } else {
+        audiosample_reset_buffer(sample, false, 0);
+        audioio_get_buffer_result_t result = audiosample_get_buffer(sample, false, 0, (uint8_t **)&self->remaining_buffer, &self->buffer_length);
+        // Track length in terms of words.
+        self->buffer_length /= sizeof(uint32_t);
+        self->more_data = result == GET_BUFFER_MORE_DATA;
     }
     self->sample = sample;
-    self->loop = loop;
-
-    audiosample_reset_buffer(sample, false, 0);
-    audioio_get_buffer_result_t result = audiosample_get_buffer(sample, false, 0, (uint8_t **)&self->remaining_buffer, &self->buffer_length);
-    // Track length in terms of words.
-    self->buffer_length /= sizeof(uint32_t);
-    self->more_data = result == GET_BUFFER_MORE_DATA;
 }
 
 bool common_hal_audiomixer_mixervoice_get_playing(audiomixer_mixervoice_obj_t *self) {
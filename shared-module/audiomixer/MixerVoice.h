@@ -19,4 +19,8 @@ typedef struct {
     uint32_t *remaining_buffer;
     uint32_t buffer_length;
     uint16_t level;
+    // Set when the sample's format differs from the mixer's, so it is played through resampler
+    // instead of being mixed straight from its buffers.
+    bool convert;
+    audiosample_resampler_t resampler;
 } audiomixer_mixervoice_obj_t;
@@ -89,11 +89,51 @@ static off_t stream_lseek(void *stream, off_t offset, int whence) {
     return seek_s.offset;
 }
 
-#define INPUT_BUFFER_AVAILABLE(i) ((i).write_off - (i).read_off)
+// The longest layer 3 frame, 320kbit/s at 32kHz with padding. This much of the start of the
+// input ring is copied after its end when a frame wraps around.
+#define MAX_FRAME_LEN (1441)
+
+// Frames whose file offsets are kept for seeking and looping
+#define FRAME_INDEX_INTERVAL (32)
+#define FRAME_INDEX_INITIAL_SIZE (64)
+
+#define INPUT_BUFFER_AVAILABLE(i) ((i).available)
 #define INPUT_BUFFER_SPACE(i) ((i).size - INPUT_BUFFER_AVAILABLE(i))
 #define INPUT_BUFFER_READ_PTR(i) ((i).buf + (i).read_off)
-#define INPUT_BUFFER_CONSUME(i, n) ((i).read_off += (n))
-#define INPUT_BUFFER_CLEAR(i) ((i).read_off = (i).write_off = 0)
+#define INPUT_BUFFER_CLEAR(i) ((i).read_off = (i).write_off = (i).available = (i).mirrored = 0)
+
+static void input_buffer_produce(mp3_input_buffer_t *i, mp_int_t n) {
+    i->write_off += n;
+    if (i->write_off == i->size) {
+        i->write_off = 0;
+    }
+    i->available += n;
+}
+
+static void input_buffer_consume(mp3_input_buffer_t *i, mp_int_t n) {
+    i->read_off += n;
+    if (i->read_off >= i->size) {
+        i->read_off -= i->size;
+        i->mirrored = 0;
+    }
+    i->available -= n;
+}
+
+// The number of bytes that can be read in one piece from the read pointer. When the data
+// wraps around the end of the ring, up to a frame's worth of the start of the ring is copied
+// after its end, once.
+static mp_int_t input_buffer_contiguous(mp3_input_buffer_t *i) {
+    mp_int_t tail = i->size - i->read_off;
+    if (i->available <= tail) {
+        return i->available;
+    }
+    mp_int_t wrapped = MIN(i->available - tail, MAX_FRAME_LEN);
+    if (wrapped > i->mirrored) {
+        memcpy(i->buf + i->size + i->mirrored, i->buf + i->mirrored, wrapped - i->mirrored);
+        i->mirrored = wrapped;
+    }
+    return tail + wrapped;
+}
 
 static void stream_set_blocking(audiomp3_mp3file_obj_t *self, bool block_ok) {
     if (!self->settimeout_args[0]) {
@@ -110,8 +150,7 @@ static void stream_set_blocking(audiomp3_mp3file_obj_t *self, bool block_ok) {
 /** Fill the input buffer unconditionally.
  *
  * Returns true if the input buffer contains any useful data,
- * false otherwise.  (The input buffer will be padded to the end with
- * 0 bytes, which do not interfere with MP3 decoding)
+ * false otherwise.
  *
  * Raises OSError if stream_read fails.
  *
@@ -126,14 +165,9 @@ static bool mp3file_update_inbuf_always(audiomp3_mp3file_obj_t *self, bool block
 
     // We didn't previously reach EOF and we have input buffer space available
 
-    // Move the unconsumed portion of the buffer to the start
-    if (self->inbuf.read_off) {
-        memmove(self->inbuf.buf, INPUT_BUFFER_READ_PTR(self->inbuf), INPUT_BUFFER_AVAILABLE(self->inbuf));
-        self->inbuf.write_off -= self->inbuf.read_off;
-        self->inbuf.read_off = 0;
-    }
-
     for (size_t to_read; !self->eof && (to_read = INPUT_BUFFER_SPACE(self->inbuf)) > 0;) {
+        // Read at most up to the end of the ring; the next pass carries on from its start
+        to_read = MIN(to_read, (size_t)(self->inbuf.size - self->inbuf.write_off));
         uint8_t *write_ptr = self->inbuf.buf + self->inbuf.write_off;
         ssize_t n_read = stream_read(self->stream, write_ptr, to_read);
 
@@ -150,7 +184,7 @@ static bool mp3file_update_inbuf_always(audiomp3_mp3file_obj_t *self, bool block
             self->eof = true;
         }
 
-        self->inbuf.write_off += n_read;
+        input_buffer_produce(&self->inbuf, n_read);
     }
 
     if (DO_DEBUG) {
@@ -198,8 +232,14 @@ static bool mp3file_update_inbuf_half(audiomp3_mp3file_obj_t *self, bool block_o
 }
 
 #define READ_PTR(self) (INPUT_BUFFER_READ_PTR(self->inbuf))
-#define BYTES_LEFT(self) (INPUT_BUFFER_AVAILABLE(self->inbuf))
-#define CONSUME(self, n) (INPUT_BUFFER_CONSUME(self->inbuf, n))
+#define BYTES_LEFT(self) (input_buffer_contiguous(&self->inbuf))
+#define BYTES_AVAILABLE(self) (INPUT_BUFFER_AVAILABLE(self->inbuf))
+
+static void mp3file_consume(audiomp3_mp3file_obj_t *self, mp_int_t n) {
+    input_buffer_consume(&self->inbuf, n);
+    self->stream_offset += n;
+}
+#define CONSUME(self, n) (mp3file_consume(self, n))
 
 // http://id3.org/id3v2.3.0
 static void mp3file_skip_id3v2(audiomp3_mp3file_obj_t *self, bool block_ok) {
@@ -227,19 +267,24 @@ static void mp3file_skip_id3v2(audiomp3_mp3file_obj_t *self, bool block_ok) {
     if (DO_DEBUG) {
         mp_printf(&mp_plat_print, "%s:%d id3 size %d\n", __FILE__, __LINE__, size);
     }
-    uint32_t to_consume = MIN(size, BYTES_LEFT(self));
+    uint32_t to_consume = MIN(size, BYTES_AVAILABLE(self));
     CONSUME(self, to_consume);
     size -= to_consume;
+    if (size == 0) {
+        return;
+    }
 
     // Next, seek in the file after the header
-    if (stream_lseek(self->stream, SEEK_CUR, size) == 0) {
+    off_t offset = stream_lseek(self->stream, size, SEEK_CUR);
+    if (offset >= 0) {
+        self->stream_offset = offset;
         return;
     }
 
     // Couldn't seek (might be a socket), so need to actually read and discard all that data
     while (size > 0 && !self->eof) {
         mp3file_update_inbuf_always(self, true);
-        to_consume = MIN(size, BYTES_LEFT(self));
+        to_consume = MIN(size, BYTES_AVAILABLE(self));
         CONSUME(self, to_consume);
         size -= to_consume;
     }
@@ -275,8 +320,93 @@ static bool mp3file_get_next_frame_info(audiomp3_mp3file_obj_t *self, MP3FrameIn
     return err == ERR_MP3_NONE;
 }
 
+// Record the offset of the frame at the read pointer, if it is the next one the index needs.
+// The index only grows when it is safe to allocate.
+static void mp3file_index_frame(audiomp3_mp3file_obj_t *self, bool may_grow) {
+    mp3_frame_index_t *index = &self->frame_index;
+    if (!self->indexing || self->frame != index->count * FRAME_INDEX_INTERVAL) {
+        return;
+    }
+    if (index->count == index->alloc) {
+        if (!may_grow) {
+            return;
+        }
+        index->offsets = m_renew(uint32_t, index->offsets, index->alloc, index->alloc * 2);
+        index->alloc *= 2;
+    }
+    index->offsets[index->count++] = self->stream_offset;
+}
+
+/* Move the input to the start of frame, or the closest indexed frame before it when the
+ * frame hasn't been reached since the file was opened. The first frame is found and indexed
+ * the first time.
+ *
+ * Returns 0, or a negative error code if the stream can't seek.
+ */
+static int mp3file_seek_frame(audiomp3_mp3file_obj_t *self, uint32_t frame, bool block_ok) {
+    mp3_frame_index_t *index = &self->frame_index;
+    size_t entry = MIN(frame / FRAME_INDEX_INTERVAL, index->count ? index->count - 1 : 0);
+    off_t offset = index->count ? index->offsets[entry] : 0;
+    off_t result = stream_lseek(self->stream, offset, SEEK_SET);
+    if (result < 0) {
+        return result;
+    }
+    INPUT_BUFFER_CLEAR(self->inbuf);
+    self->eof = false;
+    self->stream_offset = offset;
+    self->indexing = true;
+    self->frame = entry * FRAME_INDEX_INTERVAL;
+    if (index->count == 0) {
+        mp3file_skip_id3v2(self, block_ok);
+        if (mp3file_find_sync_word(self, block_ok)) {
+            mp3file_index_frame(self, false);
+        }
+    }
+    return 0;
+}
+
+// The length of the layer 3 frame at the read pointer, or 0 if it has no fixed length
+static mp_int_t mp3file_frame_length(audiomp3_mp3file_obj_t *self, const MP3FrameInfo *fi) {
+    if (fi->layer != 3 || fi->bitrate == 0 || fi->samprate == 0) {
+        return 0;
+    }
+    int padding = (READ_PTR(self)[2] >> 1) & 1;
+    return (fi->version == MPEG1 ? 144 : 72) * fi->bitrate / fi->samprate + padding;
+}
+
+// Move past one frame without decoding it if its length is known. Returns false at the end.
+static bool mp3file_skip_frame(audiomp3_mp3file_obj_t *self) {
+    if (BYTES_AVAILABLE(self) < MAX_FRAME_LEN) {
+        mp3file_update_inbuf_always(self, true);
+    }
+    if (!mp3file_find_sync_word(self, true)) {
+        return false;
+    }
+    MP3FrameInfo fi;
+    if (!mp3file_get_next_frame_info(self, &fi, true)) {
+        return false;
+    }
+    mp3file_index_frame(self, true);
+    mp_int_t length = mp3file_frame_length(self, &fi);
+    if (length) {
+        CONSUME(self, MIN(length, BYTES_AVAILABLE(self)));
+    } else {
+        // The buffer last handed out may still be playing. The other one is next to be
+        // overwritten anyway.
+        int bytes_left = BYTES_LEFT(self);
+        uint8_t *inbuf = READ_PTR(self);
+        int err = MP3Decode(self->decoder, &inbuf, &bytes_left, self->pcm_buffer[!self->buffer_index], 0);
+        if (err == ERR_MP3_INDATA_UNDERFLOW) {
+            return false;
+        }
+        CONSUME(self, BYTES_LEFT(self) - bytes_left);
+    }
+    self->frame++;
+    return true;
+}
+
 #define DEFAULT_INPUT_BUFFER_SIZE (2048)
-#define MIN_USER_BUFFER_SIZE (DEFAULT_INPUT_BUFFER_SIZE + 2 * MAX_BUFFER_LEN)
+#define MIN_USER_BUFFER_SIZE (DEFAULT_INPUT_BUFFER_SIZE + MAX_FRAME_LEN + 2 * MAX_BUFFER_LEN)
 
 void common_hal_audiomp3_mp3file_construct(audiomp3_mp3file_obj_t *self,
     mp_obj_t stream,
@@ -300,13 +430,13 @@ void common_hal_audiomp3_mp3file_construct(audiomp3_mp3file_obj_t *self,
         self->pcm_buffer[0] = (int16_t *)(void *)buffer;
         self->pcm_buffer[1] = (int16_t *)(void *)(buffer + MAX_BUFFER_LEN);
         self->inbuf.buf = buffer + 2 * MAX_BUFFER_LEN;
-        self->inbuf.size = buffer_size - 2 * MAX_BUFFER_LEN;
+        self->inbuf.size = buffer_size - 2 * MAX_BUFFER_LEN - MAX_FRAME_LEN;
     } else {
         self->inbuf.size = DEFAULT_INPUT_BUFFER_SIZE;
-        self->inbuf.buf = m_malloc(DEFAULT_INPUT_BUFFER_SIZE);
+        self->inbuf.buf = m_malloc(DEFAULT_INPUT_BUFFER_SIZE + MAX_FRAME_LEN);
         if (self->inbuf.buf == NULL) {
             common_hal_audiomp3_mp3file_deinit(self);
-            m_malloc_fail(DEFAULT_INPUT_BUFFER_SIZE);
+            m_malloc_fail(DEFAULT_INPUT_BUFFER_SIZE + MAX_FRAME_LEN);
         }
 
         if (buffer_size >= 2 * MAX_BUFFER_LEN) {
@@ -326,7 +456,10 @@ void common_hal_audiomp3_mp3file_construct(audiomp3_mp3file_obj_t *self,
             }
         }
     }
-    self->inbuf.read_off = self->inbuf.write_off = 0;
+    INPUT_BUFFER_CLEAR(self->inbuf);
+
+    self->frame_index.alloc = FRAME_INDEX_INITIAL_SIZE;
+    self->frame_index.offsets = m_malloc(FRAME_INDEX_INITIAL_SIZE * sizeof(uint32_t));
 
     self->decoder = MP3InitDecoder();
     if (self->decoder == NULL) {
@@ -347,11 +480,19 @@ void common_hal_audiomp3_mp3file_set_file(audiomp3_mp3file_obj_t *self, mp_obj_t
     INPUT_BUFFER_CLEAR(self->inbuf);
     self->eof = 0;
 
+    // Frames can only be indexed when they are counted from the start of the file
+    off_t offset = stream_lseek(stream, 0, SEEK_CUR);
+    self->stream_offset = offset;
+    self->indexing = offset == 0;
+    self->frame = 0;
+    self->frame_index.count = 0;
+
     self->block_ok = false;
     stream_set_blocking(self, true);
 
     self->other_channel = -1;
     mp3file_update_inbuf_half(self, true);
+    mp3file_skip_id3v2(self, true);
     mp3file_find_sync_word(self, true);
     // It **SHOULD** not be necessary to do this; the buffer should be filled
     // with fresh content before it is returned by get_buffer().  The fact that
@@ -362,6 +503,9 @@ void common_hal_audiomp3_mp3file_set_file(audiomp3_mp3file_obj_t *self, mp_obj_t
     memset(self->pcm_buffer[1], 0, MAX_BUFFER_LEN);
     MP3FrameInfo fi;
     bool result = mp3file_get_next_frame_info(self, &fi, true);
+    if (result) {
+        mp3file_index_frame(self, false);
+    }
     background_callback_allow();
     if (!result) {
         mp_raise_msg(&mp_type_RuntimeError,
@@ -381,6 +525,8 @@ void common_hal_audiomp3_mp3file_deinit(audiomp3_mp3file_obj_t *self) {
     }
     self->decoder = NULL;
     self->inbuf.buf = NULL;
+    self->frame_index.offsets = NULL;
+    self->frame_index.alloc = self->frame_index.count = 0;
     self->pcm_buffer[0] = NULL;
     self->pcm_buffer[1] = NULL;
     self->stream = mp_const_none;
@@ -417,14 +563,11 @@ void audiomp3_mp3file_reset_buffer(audiomp3_mp3file_obj_t *self,
     }
     // We don't reset the buffer index in case we're looping and we have an odd number of buffer
     // loads
+    // Straight back to the first frame if it's indexed, without looking for it again.
     background_callback_prevent();
-    if (self->eof && stream_lseek(self->stream, SEEK_SET, 0) == 0) {
-        INPUT_BUFFER_CLEAR(self->inbuf);
-        self->eof = 0;
+    if (self->eof && mp3file_seek_frame(self, 0, false) == 0) {
         self->samples_decoded = 0;
         self->other_channel = -1;
-        mp3file_skip_id3v2(self, false);
-        mp3file_find_sync_word(self, false);
     }
     background_callback_allow();
 }
@@ -471,11 +614,13 @@ audioio_get_buffer_result_t audiomp3_mp3file_get_buffer(audiomp3_mp3file_obj_t *
         *buffer_length = 0;
         return self->eof ? GET_BUFFER_DONE : GET_BUFFER_ERROR;
     }
+    mp3file_index_frame(self, false);
     int bytes_left = BYTES_LEFT(self);
     uint8_t *inbuf = READ_PTR(self);
     int err = MP3Decode(self->decoder, &inbuf, &bytes_left, buffer, 0);
     if (err != ERR_MP3_INDATA_UNDERFLOW) {
         CONSUME(self, BYTES_LEFT(self) - bytes_left);
+        self->frame++;
     }
     if (err) {
         memset(buffer, 0, frame_buffer_size_bytes);
@@ -537,3 +682,30 @@ float common_hal_audiomp3_mp3file_get_rms_level(audiomp3_mp3file_obj_t *self) {
 uint32_t common_hal_audiomp3_mp3file_get_samples_decoded(audiomp3_mp3file_obj_t *self) {
     return self->samples_decoded;
 }
+
+void common_hal_audiomp3_mp3file_seek(audiomp3_mp3file_obj_t *self, uint32_t sample) {
+    uint32_t frame_samples = self->frame_buffer_size / sizeof(int16_t) / self->channel_count;
+    uint32_t frame = sample / frame_samples;
+
+    background_callback_prevent();
+    mp3_frame_index_t *index = &self->frame_index;
+    int err = 0;
+    // Carry on from here when no indexed frame is closer
+    size_t entry = MIN(frame / FRAME_INDEX_INTERVAL, index->count ? index->count - 1 : 0);
+    if (!self->indexing || index->count == 0 || self->frame > frame || entry * FRAME_INDEX_INTERVAL > self->frame) {
+        err = mp3file_seek_frame(self, frame, true);
+    }
+    if (err == 0) {
+        while (self->frame < frame && mp3file_skip_frame(self)) {
+        }
+        self->samples_decoded = self->frame * frame_samples * self->channel_count;
+        self->other_channel = -1;
+        // The bit reservoir holds data from before the seek, which doesn't belong to the
+        // next frame. Decoding that frame fails instead, and it plays as silence.
+        self->decoder->mainDataBytes = 0;
+    }
+    background_callback_allow();
+    if (err) {
+        mp_raise_OSError(-err);
+    }
+}
@@ -13,13 +13,24 @@
 
 #include "shared-module/audiocore/__init__.h"
 
+// A ring of size bytes, followed by room to copy the start of the ring to, so that a frame
+// that wraps around the end can still be read in one piece.
 typedef struct {
     uint8_t *buf;
     mp_int_t size;
     mp_int_t read_off;
     mp_int_t write_off;
+    mp_int_t available;
+    mp_int_t mirrored; // bytes from the start of the ring already copied after its end
 } mp3_input_buffer_t;
 
+// The file offset of every MP3_FRAME_INDEX_INTERVAL-th frame, filled in as frames are found
+typedef struct {
+    uint32_t *offsets;
+    size_t count;
+    size_t alloc;
+} mp3_frame_index_t;
+
 typedef struct {
     mp_obj_base_t base;
     struct _MP3DecInfo *decoder;
@@ -42,6 +53,14 @@ typedef struct {
     int8_t other_buffer_index;
 
     uint32_t samples_decoded;
+
+    // The file offset of the next byte to be read from inbuf
+    uint32_t stream_offset;
+    // Whether frame counts frames from the start of the file
+    bool indexing;
+    // The number of the frame at the read position
+    uint32_t frame;
+    mp3_frame_index_t frame_index;
 } audiomp3_mp3file_obj_t;
 
 // These are not available from Python because it may be called in an interrupt.
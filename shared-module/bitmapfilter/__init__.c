@@ -7,6 +7,8 @@
 // SPDX-License-Identifier: MIT
 
 #include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
 #include <math.h>
 
 #include "py/runtime.h"
@@ -88,6 +90,149 @@ uint16_t imlib_yuv_to_rgb(uint8_t y, int8_t u, int8_t v) {
     return COLOR_R8_G8_B8_TO_RGB565(r, g, b);
 }
 
+// A kernel is separable when every weight is the product of its column's weight in the centre
+// row and its row's weight in the centre column, divided by the centre weight, as for box and
+// gaussian blurs. The convolution is then a horizontal pass followed by a vertical one, 2n
+// multiplies per channel instead of n*n, and dividing the result by the centre weight gives
+// exactly the same sum as the full kernel. The horizontal sums are kept in int16_t.
+static bool morph_separable_weights(const int ksize, const int *krn, int *row, int *col) {
+    int n = 2 * ksize + 1;
+    int centre = krn[ksize * n + ksize];
+    if (centre == 0) {
+        return false;
+    }
+    int64_t row_sum = 0, col_sum = 0;
+    for (int j = 0; j < n; j++) {
+        row[j] = krn[ksize * n + j];
+        col[j] = krn[j * n + ksize];
+        row_sum += abs(row[j]);
+        col_sum += abs(col[j]);
+    }
+    if (row_sum * COLOR_G6_MAX > INT16_MAX || row_sum * col_sum * COLOR_G6_MAX > INT32_MAX) {
+        return false;
+    }
+    for (int j = 0; j < n; j++) {
+        for (int k = 0; k < n; k++) {
+            if ((int64_t)krn[j * n + k] * centre != (int64_t)col[j] * row[k]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static void morph_separable_hpass(displayio_bitmap_t *bitmap, int y, const int ksize, const int *row, int16_t *h) {
+    int width = bitmap->width;
+    int16_t *hr = h, *hg = h + width, *hb = h + 2 * width;
+    uint16_t *row_ptr = IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(bitmap, y);
+    for (int x = 0; x < width; x++) {
+        int r_acc = 0, g_acc = 0, b_acc = 0;
+        if (x >= ksize && x < width - ksize) {
+            for (int k = -ksize; k <= ksize; k++) {
+                int pixel = IMAGE_GET_RGB565_PIXEL_FAST(row_ptr, x + k);
+                r_acc += row[k + ksize] * COLOR_RGB565_TO_R5(pixel);
+                g_acc += row[k + ksize] * COLOR_RGB565_TO_G6(pixel);
+                b_acc += row[k + ksize] * COLOR_RGB565_TO_B5(pixel);
+            }
+        } else {
+            for (int k = -ksize; k <= ksize; k++) {
+                int pixel = IMAGE_GET_RGB565_PIXEL_FAST(row_ptr, IM_MIN(IM_MAX(x + k, 0), (width - 1)));
+                r_acc += row[k + ksize] * COLOR_RGB565_TO_R5(pixel);
+                g_acc += row[k + ksize] * COLOR_RGB565_TO_G6(pixel);
+                b_acc += row[k + ksize] * COLOR_RGB565_TO_B5(pixel);
+            }
+        }
+        hr[x] = r_acc;
+        hg[x] = g_acc;
+        hb[x] = b_acc;
+    }
+}
+
+static void morph_separable(
+    displayio_bitmap_t *bitmap,
+    displayio_bitmap_t *mask,
+    const int ksize,
+    const int *row,
+    const int *col,
+    const int centre,
+    const int32_t m_int,
+    const int32_t b_int,
+    bool threshold,
+    int offset,
+    bool invert) {
+
+    int n = 2 * ksize + 1;
+    int width = bitmap->width, height = bitmap->height;
+    // n rows of horizontal sums, one row for each of the rows the kernel covers, then the
+    // vertical sums of the row being output
+    size_t hsize = 3 * width * sizeof(int16_t);
+    uint8_t *scratch = scratchpad_alloc(n * hsize + 3 * width * sizeof(int32_t));
+    int32_t *acc = (int32_t *)(scratch + n * hsize);
+    #define HROW(y) ((int16_t *)(scratch + ((y) % n) * hsize))
+
+    for (int y = 0; y < ksize && y < height; y++) {
+        morph_separable_hpass(bitmap, y, ksize, row, HROW(y));
+    }
+
+    for (int y = 0; y < height; y++) {
+        // The sums of the row at the bottom of the kernel are made before any row it covers is
+        // replaced by the output; the output row itself is only overwritten below.
+        if (y + ksize < height) {
+            morph_separable_hpass(bitmap, y + ksize, ksize, row, HROW(y + ksize));
+        }
+        memset(acc, 0, 3 * width * sizeof(int32_t));
+        for (int j = -ksize; j <= ksize; j++) {
+            int16_t *h = HROW(IM_MIN(IM_MAX(y + j, 0), (height - 1)));
+            int c = col[j + ksize];
+            for (int x = 0; x < 3 * width; x++) {
+                acc[x] += c * h[x];
+            }
+        }
+
+        uint16_t *row_ptr = IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(bitmap, y);
+        for (int x = 0; x < width; x++) {
+            if (mask && common_hal_displayio_bitmap_get_pixel(mask, x, y)) {
+                continue; // Short circuit.
+            }
+            int32_t r_acc = acc[x] / centre;
+            int32_t g_acc = acc[x + width] / centre;
+            int32_t b_acc = acc[x + 2 * width] / centre;
+
+            r_acc = (r_acc * m_int + b_int) >> 16;
+            if (r_acc > COLOR_R5_MAX) {
+                r_acc = COLOR_R5_MAX;
+            } else if (r_acc < 0) {
+                r_acc = 0;
+            }
+            g_acc = (g_acc * m_int + b_int * 2) >> 16;
+            if (g_acc > COLOR_G6_MAX) {
+                g_acc = COLOR_G6_MAX;
+            } else if (g_acc < 0) {
+                g_acc = 0;
+            }
+            b_acc = (b_acc * m_int + b_int) >> 16;
+            if (b_acc > COLOR_B5_MAX) {
+                b_acc = COLOR_B5_MAX;
+            } else if (b_acc < 0) {
+                b_acc = 0;
+            }
+
+            int pixel = COLOR_R5_G6_B5_TO_RGB565(r_acc, g_acc, b_acc);
+
+            if (threshold) {
+                if (((COLOR_RGB565_TO_Y(pixel) - offset) < COLOR_RGB565_TO_Y(IMAGE_GET_RGB565_PIXEL_FAST(row_ptr, x))) ^ invert) {
+                    pixel = COLOR_RGB565_BINARY_MAX;
+                } else {
+                    pixel = COLOR_RGB565_BINARY_MIN;
+                }
+            }
+
+            IMAGE_PUT_RGB565_PIXEL_FAST(row_ptr, x, pixel);
+        }
+    }
+    #undef HROW
+}
+
 void shared_module_bitmapfilter_morph(
     displayio_bitmap_t *bitmap,
     displayio_bitmap_t *mask,
@@ -104,6 +249,13 @@ void shared_module_bitmapfilter_morph(
     const int32_t m_int = (int32_t)MICROPY_FLOAT_C_FUN(round)(65536 * m);
     const int32_t b_int = (int32_t)MICROPY_FLOAT_C_FUN(round)(65536 * COLOR_G6_MAX * b);
 
+    int row[2 * ksize + 1], col[2 * ksize + 1];
+    if (bitmap->bits_per_value == 16 && morph_separable_weights(ksize, krn, row, col)) {
+        morph_separable(bitmap, mask, ksize, row, col, krn[ksize * (2 * ksize + 1) + ksize],
+            m_int, b_int, threshold, offset, invert);
+        return;
+    }
+
     switch (bitmap->bits_per_value) {
         default:
             mp_raise_ValueError(MP_ERROR_TEXT("unsupported bitmap depth"));
@@ -197,12 +349,15 @@ void shared_module_bitmapfilter_morph(
     }
 }
 
-void shared_module_bitmapfilter_mix(
-    displayio_bitmap_t *bitmap,
-    displayio_bitmap_t *mask,
-    const mp_float_t weights[12]) {
+// The point filters (mix, solarize, lookup and false_color) change each pixel independently of
+// its neighbours, so a chain of them is run as one pass: every step is applied to a tile of
+// pixels from a row while it is still in cache, before moving on to the next tile, rather than
+// each step streaming the whole bitmap through memory. With a mask, the masked pixels of the
+// tile are saved first and put back afterwards. Each filter on its own is a chain of one step.
+#define BITMAPFILTER_TILE_PIXELS (64)
 
-    int wt[12];
+void shared_module_bitmapfilter_mix_step(bitmapfilter_step_t *step, const mp_float_t weights[12]) {
+    step->kind = BITMAPFILTER_STEP_MIX;
     for (int i = 0; i < 12; i++) {
         // The different scale factors correct for G having 6 bits while R, G have 5
         // by doubling the scale for R/B->G and halving the scale for G->R/B.
@@ -214,81 +369,138 @@ void shared_module_bitmapfilter_mix(
             (i == 3 || i == 11) ? 65535 * COLOR_B5_MAX : // Offset for R/B
             (i == 7) ? 65535 * COLOR_G6_MAX : // Offset for G
             65536;
-        wt[i] = (int32_t)MICROPY_FLOAT_C_FUN(round)(scale * weights[i]);
+        step->mix[i] = (int32_t)MICROPY_FLOAT_C_FUN(round)(scale * weights[i]);
     }
+}
 
-    switch (bitmap->bits_per_value) {
-        default:
-            mp_raise_ValueError(MP_ERROR_TEXT("unsupported bitmap depth"));
-        case 16: {
-            for (int y = 0, yy = bitmap->height; y < yy; y++) {
-                uint16_t *row_ptr = IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(bitmap, y);
-                for (int x = 0, xx = bitmap->width; x < xx; x++) {
-                    if (mask && common_hal_displayio_bitmap_get_pixel(mask, x, y)) {
-                        continue; // Short circuit.
-                    }
-                    int pixel = IMAGE_GET_RGB565_PIXEL_FAST(row_ptr, x);
-                    int32_t r_acc = 0, g_acc = 0, b_acc = 0;
-                    int r = COLOR_RGB565_TO_R5(pixel);
-                    int g = COLOR_RGB565_TO_G6(pixel);
-                    int b = COLOR_RGB565_TO_B5(pixel);
-                    r_acc = r * wt[0] + g * wt[1] + b * wt[2] + wt[3];
-                    r_acc >>= 16;
-                    if (r_acc < 0) {
-                        r_acc = 0;
-                    } else if (r_acc > COLOR_R5_MAX) {
-                        r_acc = COLOR_R5_MAX;
-                    }
+void shared_module_bitmapfilter_solarize_step(bitmapfilter_step_t *step, const mp_float_t threshold) {
+    step->kind = BITMAPFILTER_STEP_SOLARIZE;
+    step->threshold = (int32_t)MICROPY_FLOAT_C_FUN(round)(256 * threshold);
+}
 
-                    g_acc = r * wt[4] + g * wt[5] + b * wt[6] + wt[7];
-                    g_acc >>= 16;
-                    if (g_acc < 0) {
-                        g_acc = 0;
-                    } else if (g_acc > COLOR_G6_MAX) {
-                        g_acc = COLOR_G6_MAX;
-                    }
+void shared_module_bitmapfilter_lookup_step(bitmapfilter_step_t *step, const bitmapfilter_lookup_table_t *table) {
+    step->kind = BITMAPFILTER_STEP_LOOKUP;
+    step->lookup = *table;
+}
 
-                    b_acc = r * wt[8] + g * wt[9] + b * wt[10] + wt[11];
-                    b_acc >>= 16;
-                    if (b_acc < 0) {
-                        b_acc = 0;
-                    } else if (b_acc > COLOR_B5_MAX) {
-                        b_acc = COLOR_B5_MAX;
-                    }
+void shared_module_bitmapfilter_false_color_step(bitmapfilter_step_t *step, _displayio_color_t palette[256]) {
+    step->kind = BITMAPFILTER_STEP_FALSE_COLOR;
+    for (int i = 0; i < 256; i++) {
+        uint32_t rgb888 = palette[i].rgb888;
+        int r = rgb888 >> 16;
+        int g = (rgb888 >> 8) & 0xff;
+        int b = rgb888 & 0xff;
+        step->false_color[i] = COLOR_R8_G8_B8_TO_RGB565(r, g, b);
+    }
+}
 
-                    pixel = COLOR_R5_G6_B5_TO_RGB565(r_acc, g_acc, b_acc);
-                    IMAGE_PUT_RGB565_PIXEL_FAST(row_ptr, x, pixel);
-                }
-            }
-            break;
+static void mix_tile(const int32_t wt[12], uint16_t *tile, int n) {
+    for (int x = 0; x < n; x++) {
+        int pixel = IMAGE_GET_RGB565_PIXEL_FAST(tile, x);
+        int32_t r_acc = 0, g_acc = 0, b_acc = 0;
+        int r = COLOR_RGB565_TO_R5(pixel);
+        int g = COLOR_RGB565_TO_G6(pixel);
+        int b = COLOR_RGB565_TO_B5(pixel);
+        r_acc = r * wt[0] + g * wt[1] + b * wt[2] + wt[3];
+        r_acc >>= 16;
+        if (r_acc < 0) {
+            r_acc = 0;
+        } else if (r_acc > COLOR_R5_MAX) {
+            r_acc = COLOR_R5_MAX;
+        }
+
+        g_acc = r * wt[4] + g * wt[5] + b * wt[6] + wt[7];
+        g_acc >>= 16;
+        if (g_acc < 0) {
+            g_acc = 0;
+        } else if (g_acc > COLOR_G6_MAX) {
+            g_acc = COLOR_G6_MAX;
+        }
+
+        b_acc = r * wt[8] + g * wt[9] + b * wt[10] + wt[11];
+        b_acc >>= 16;
+        if (b_acc < 0) {
+            b_acc = 0;
+        } else if (b_acc > COLOR_B5_MAX) {
+            b_acc = COLOR_B5_MAX;
         }
+
+        IMAGE_PUT_RGB565_PIXEL_FAST(tile, x, COLOR_R5_G6_B5_TO_RGB565(r_acc, g_acc, b_acc));
     }
 }
 
-void shared_module_bitmapfilter_solarize(
+static void solarize_tile(int threshold_i, uint16_t *tile, int n) {
+    for (int x = 0; x < n; x++) {
+        int pixel = IMAGE_GET_RGB565_PIXEL_FAST(tile, x);
+        int y = COLOR_RGB565_TO_Y(pixel);
+        if (y > threshold_i) {
+            y = MIN(255, MAX(0, 2 * threshold_i - y));
+            int u = COLOR_RGB565_TO_U(pixel);
+            int v = COLOR_RGB565_TO_V(pixel);
+            IMAGE_PUT_RGB565_PIXEL_FAST(tile, x, COLOR_YUV_TO_RGB565(y, u, v));
+        }
+    }
+}
+
+static void lookup_tile(const bitmapfilter_lookup_table_t *table, uint16_t *tile, int n) {
+    for (int x = 0; x < n; x++) {
+        int pixel = IMAGE_GET_RGB565_PIXEL_FAST(tile, x);
+        int r = table->r[COLOR_RGB565_TO_R5(pixel)];
+        int g = table->g[COLOR_RGB565_TO_G6(pixel)];
+        int b = table->b[COLOR_RGB565_TO_B5(pixel)];
+        IMAGE_PUT_RGB565_PIXEL_FAST(tile, x, COLOR_R5_G6_B5_TO_RGB565(r, g, b));
+    }
+}
+
+static void false_color_tile(const uint16_t table[256], uint16_t *tile, int n) {
+    for (int x = 0; x < n; x++) {
+        int pixel = IMAGE_GET_RGB565_PIXEL_FAST(tile, x);
+        IMAGE_PUT_RGB565_PIXEL_FAST(tile, x, table[COLOR_RGB565_TO_Y(pixel)]);
+    }
+}
+
+void shared_module_bitmapfilter_chain(
     displayio_bitmap_t *bitmap,
     displayio_bitmap_t *mask,
-    const mp_float_t threshold) {
+    const bitmapfilter_step_t *steps,
+    size_t n_steps) {
 
-    int threshold_i = (int32_t)MICROPY_FLOAT_C_FUN(round)(256 * threshold);
     switch (bitmap->bits_per_value) {
         default:
             mp_raise_ValueError(MP_ERROR_TEXT("unsupported bitmap depth"));
         case 16: {
+            uint16_t saved[BITMAPFILTER_TILE_PIXELS];
             for (int y = 0, yy = bitmap->height; y < yy; y++) {
                 uint16_t *row_ptr = IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(bitmap, y);
-                for (int x = 0, xx = bitmap->width; x < xx; x++) {
-                    if (mask && common_hal_displayio_bitmap_get_pixel(mask, x, y)) {
-                        continue; // Short circuit.
+                for (int x0 = 0, xx = bitmap->width; x0 < xx; x0 += BITMAPFILTER_TILE_PIXELS) {
+                    uint16_t *tile = row_ptr + x0;
+                    int n = MIN(BITMAPFILTER_TILE_PIXELS, xx - x0);
+                    if (mask) {
+                        memcpy(saved, tile, n * sizeof(uint16_t));
                     }
-                    int pixel = IMAGE_GET_RGB565_PIXEL_FAST(row_ptr, x);
-                    int y = COLOR_RGB565_TO_Y(pixel);
-                    if (y > threshold_i) {
-                        y = MIN(255, MAX(0, 2 * threshold_i - y));
-                        int u = COLOR_RGB565_TO_U(pixel);
-                        int v = COLOR_RGB565_TO_V(pixel);
-                        pixel = COLOR_YUV_TO_RGB565(y, u, v);
-                        IMAGE_PUT_RGB565_PIXEL_FAST(row_ptr, x, pixel);
+                    for (size_t i = 0; i < n_steps; i++) {
+                        const bitmapfilter_step_t *step = &steps[i];
+                        switch (step->kind) {
+                            case BITMAPFILTER_STEP_MIX:
+                                mix_tile(step->mix, tile, n);
+                                break;
+                            case BITMAPFILTER_STEP_SOLARIZE:
+                                solarize_tile(step->threshold, tile, n);
+                                break;
+                            case BITMAPFILTER_STEP_LOOKUP:
+                                lookup_tile(&step->lookup, tile, n);
+                                break;
+                            case BITMAPFILTER_STEP_FALSE_COLOR:
+                                false_color_tile(step->false_color, tile, n);
+                                break;
+                        }
+                    }
+                    if (mask) {
+                        for (int x = 0; x < n; x++) {
+                            if (common_hal_displayio_bitmap_get_pixel(mask, x0 + x, y)) {
+                                tile[x] = saved[x];
+                            }
+                        }
                     }
                 }
             }
@@ -297,71 +509,40 @@ void shared_module_bitmapfilter_solarize(
     }
 }
 
-void shared_module_bitmapfilter_lookup(
+void shared_module_bitmapfilter_mix(
     displayio_bitmap_t *bitmap,
     displayio_bitmap_t *mask,
-    const bitmapfilter_lookup_table_t *table) {
-
-    switch (bitmap->bits_per_value) {
-        default:
-            mp_raise_ValueError(MP_ERROR_TEXT("unsupported bitmap depth"));
-        case 16: {
-            for (int y = 0, yy = bitmap->height; y < yy; y++) {
-                uint16_t *row_ptr = IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(bitmap, y);
-                for (int x = 0, xx = bitmap->width; x < xx; x++) {
-                    if (mask && common_hal_displayio_bitmap_get_pixel(mask, x, y)) {
-                        continue; // Short circuit.
-                    }
-                    int pixel = IMAGE_GET_RGB565_PIXEL_FAST(row_ptr, x);
-                    int r = COLOR_RGB565_TO_R5(pixel);
-                    int g = COLOR_RGB565_TO_G6(pixel);
-                    int b = COLOR_RGB565_TO_B5(pixel);
+    const mp_float_t weights[12]) {
+    bitmapfilter_step_t step;
+    shared_module_bitmapfilter_mix_step(&step, weights);
+    shared_module_bitmapfilter_chain(bitmap, mask, &step, 1);
+}
 
-                    r = table->r[r];
-                    g = table->g[g];
-                    b = table->b[b];
+void shared_module_bitmapfilter_solarize(
+    displayio_bitmap_t *bitmap,
+    displayio_bitmap_t *mask,
+    const mp_float_t threshold) {
+    bitmapfilter_step_t step;
+    shared_module_bitmapfilter_solarize_step(&step, threshold);
+    shared_module_bitmapfilter_chain(bitmap, mask, &step, 1);
+}
 
-                    pixel = COLOR_R5_G6_B5_TO_RGB565(r, g, b);
-                    IMAGE_PUT_RGB565_PIXEL_FAST(row_ptr, x, pixel);
-                }
-            }
-            break;
-        }
-    }
+void shared_module_bitmapfilter_lookup(
+    displayio_bitmap_t *bitmap,
+    displayio_bitmap_t *mask,
+    const bitmapfilter_lookup_table_t *table) {
+    bitmapfilter_step_t step;
+    shared_module_bitmapfilter_lookup_step(&step, table);
+    shared_module_bitmapfilter_chain(bitmap, mask, &step, 1);
 }
 
 void shared_module_bitmapfilter_false_color(
     displayio_bitmap_t *bitmap,
     displayio_bitmap_t *mask,
     _displayio_color_t palette[256]) {
-
-    uint16_t table[256];
-    for (int i = 0; i < 256; i++) {
-        uint32_t rgb888 = palette[i].rgb888;
-        int r = rgb888 >> 16;
-        int g = (rgb888 >> 8) & 0xff;
-        int b = rgb888 & 0xff;
-        table[i] = COLOR_R8_G8_B8_TO_RGB565(r, g, b);
-    }
-
-    switch (bitmap->bits_per_value) {
-        default:
-            mp_raise_ValueError(MP_ERROR_TEXT("unsupported bitmap depth"));
-        case 16: {
-            for (int y = 0, yy = bitmap->height; y < yy; y++) {
-                uint16_t *row_ptr = IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(bitmap, y);
-                for (int x = 0, xx = bitmap->width; x < xx; x++) {
-                    if (mask && common_hal_displayio_bitmap_get_pixel(mask, x, y)) {
-                        continue; // Short circuit.
-                    }
-                    int pixel = IMAGE_GET_RGB565_PIXEL_FAST(row_ptr, x);
-                    int y = COLOR_RGB565_TO_Y(pixel);
-                    pixel = table[y];
-                    IMAGE_PUT_RGB565_PIXEL_FAST(row_ptr, x, pixel);
-                }
-            }
-        }
-    }
+    bitmapfilter_step_t step;
+    shared_module_bitmapfilter_false_color_step(&step, palette);
+    shared_module_bitmapfilter_chain(bitmap, mask, &step, 1);
 }
 
 void shared_module_bitmapfilter_blend_precompute(mp_obj_t fun, uint8_t lookup[4096]) {
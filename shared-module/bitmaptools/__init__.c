@@ -23,6 +23,64 @@
 #define BITMAP_DEBUG(...) (void)0
 // #define BITMAP_DEBUG(...) mp_printf(&mp_plat_print, __VA_ARGS__)
 
+// Narrow [*lo, *hi], offsets along a row, to a range of i that includes every i where
+// c0 <= p + i * dp < c1. The window is widened by a pixel, which covers the error that builds
+// up stepping along the row, and the range by a pixel at each end.
+static void rotozoom_clip_span(mp_float_t p, mp_float_t dp, int c0, int c1, mp_float_t *lo, mp_float_t *hi) {
+    if (dp == 0) {
+        if (p < c0 - 1 || p > c1 + 1) {
+            *lo = 1;
+            *hi = 0;
+        }
+        return;
+    }
+    mp_float_t t0 = (c0 - 1 - p) / dp, t1 = (c1 + 1 - p) / dp;
+    if (t0 > t1) {
+        mp_float_t tmp = t0;
+        t0 = t1;
+        t1 = tmp;
+    }
+    t0 = MICROPY_FLOAT_C_FUN(floor)(t0) - 1;
+    t1 = MICROPY_FLOAT_C_FUN(ceil)(t1) + 1;
+    if (t0 > *lo) {
+        *lo = t0;
+    }
+    if (t1 < *hi) {
+        *hi = t1;
+    }
+}
+
+typedef struct {
+    mp_float_t u, v, du, dv;
+    // The source clip window
+    mp_float_t u0, u1, v0, v1;
+} rotozoom_span_t;
+
+// Copy one row span between bitmaps of the same whole-byte depth. Like the general path, this
+// steps (u, v) in floating point and tests it against the clip window at every pixel, so both
+// draw exactly the same pixels.
+#define ROTOZOOM_ROW(type) \
+    static void _rotozoom_row_##type(displayio_bitmap_t *self, displayio_bitmap_t *source, int y, int x0, int count, \
+    const rotozoom_span_t *span, uint32_t skip_index, bool skip_index_none) { \
+        type *dst = (type *)(self->data + y * self->stride) + x0; \
+        const uint8_t *src = (const uint8_t *)source->data; \
+        const size_t stride = source->stride * sizeof(uint32_t); \
+        mp_float_t u = span->u, v = span->v; \
+        for (int i = 0; i < count; i++) { \
+            if (u >= span->u0 && u < span->u1 && v >= span->v0 && v < span->v1) { \
+                type c = ((const type *)(src + (int)v * stride))[(int)u]; \
+                if (skip_index_none || c != skip_index) { \
+                    dst[i] = c; \
+                } \
+            } \
+            u += span->du; \
+            v += span->dv; \
+        } \
+    }
+ROTOZOOM_ROW(uint8_t)
+ROTOZOOM_ROW(uint16_t)
+ROTOZOOM_ROW(uint32_t)
+
 void common_hal_bitmaptools_rotozoom(displayio_bitmap_t *self, int16_t ox, int16_t oy,
     int16_t dest_clip0_x, int16_t dest_clip0_y,
     int16_t dest_clip1_x, int16_t dest_clip1_y,
@@ -186,21 +244,58 @@ void common_hal_bitmaptools_rotozoom(displayio_bitmap_t *self, int16_t ox, int16
     displayio_area_t dirty_area = {minx, miny, maxx + 1, maxy + 1, NULL};
     displayio_bitmap_set_dirty_area(self, &dirty_area);
 
+    if (!isfinite(duRow) || !isfinite(dvRow) || !isfinite(startu) || !isfinite(startv)) {
+        return;
+    }
+
+    // The source point (u, v) steps by (duRow, dvRow) along each destination row. Each row is
+    // first narrowed to the span of x where (u, v) can be inside the source clip window, and
+    // then walked in a loop specialized for the bitmaps' depths. (u, v) is still stepped from
+    // minx one pixel at a time, so it takes the same values as it always has, rounding included.
+    rotozoom_span_t span = {
+        .du = duRow, .dv = dvRow,
+        .u0 = source_clip0_x, .u1 = source_clip1_x, .v0 = source_clip0_y, .v1 = source_clip1_y,
+    };
+
     for (y = miny; y <= maxy; y++) {
         mp_float_t u = rowu + minx * duRow;
         mp_float_t v = rowv + minx * dvRow;
-        for (x = minx; x <= maxx; x++) {
-            if (u >= source_clip0_x && u < source_clip1_x && v >= source_clip0_y && v < source_clip1_y) {
-                uint32_t c = common_hal_displayio_bitmap_get_pixel(source, (int)u, (int)v);
-                if ((skip_index_none) || (c != skip_index)) {
-                    displayio_bitmap_write_pixel(self, x, y, c);
-                }
-            }
+        rowu += duCol;
+        rowv += dvCol;
+
+        mp_float_t lo = 0, hi = maxx - minx;
+        rotozoom_clip_span(u, duRow, source_clip0_x, source_clip1_x, &lo, &hi);
+        rotozoom_clip_span(v, dvRow, source_clip0_y, source_clip1_y, &lo, &hi);
+        if (lo > hi) {
+            continue;
+        }
+        for (int i = 0; i < (int)lo; i++) {
             u += duRow;
             v += dvRow;
         }
-        rowu += duCol;
-        rowv += dvCol;
+        int x0 = minx + (int)lo;
+        int count = (int)hi - (int)lo + 1;
+        span.u = u;
+        span.v = v;
+
+        if (self->bits_per_value == source->bits_per_value && self->bits_per_value == 8) {
+            _rotozoom_row_uint8_t(self, source, y, x0, count, &span, skip_index, skip_index_none);
+        } else if (self->bits_per_value == source->bits_per_value && self->bits_per_value == 16) {
+            _rotozoom_row_uint16_t(self, source, y, x0, count, &span, skip_index, skip_index_none);
+        } else if (self->bits_per_value == source->bits_per_value && self->bits_per_value == 32) {
+            _rotozoom_row_uint32_t(self, source, y, x0, count, &span, skip_index, skip_index_none);
+        } else {
+            for (x = x0; x < x0 + count; x++) {
+                if (u >= source_clip0_x && u < source_clip1_x && v >= source_clip0_y && v < source_clip1_y) {
+                    uint32_t c = common_hal_displayio_bitmap_get_pixel(source, (int)u, (int)v);
+                    if ((skip_index_none) || (c != skip_index)) {
+                        displayio_bitmap_write_pixel(self, x, y, c);
+                    }
+                }
+                u += duRow;
+                v += dvRow;
+            }
+        }
     }
 }
 
@@ -657,7 +752,7 @@ typedef struct {
     } terms[];
 } bitmaptools_dither_algorithm_info_t;
 
-static bitmaptools_dither_algorithm_info_t atkinson = {
+static const bitmaptools_dither_algorithm_info_t atkinson = {
     4, 2, 256 / 8, {
         {2, 0, 256 / 8},
         {-1, 1, 256 / 8},
@@ -666,7 +761,7 @@ static bitmaptools_dither_algorithm_info_t atkinson = {
     }
 };
 
-static bitmaptools_dither_algorithm_info_t floyd_stenberg = {
+static const bitmaptools_dither_algorithm_info_t floyd_stenberg = {
     3, 1, 7 * 256 / 16,
     {
         {-1, 1, 3 * 256 / 16},
@@ -675,9 +770,17 @@ static bitmaptools_dither_algorithm_info_t floyd_stenberg = {
     }
 };
 
-bitmaptools_dither_algorithm_info_t *algorithms[] = {
-    [DITHER_ALGORITHM_ATKINSON] = &atkinson,
-    [DITHER_ALGORITHM_FLOYD_STENBERG] = &floyd_stenberg,
+// The classic 8x8 ordered dither matrix. A pixel is set when its luminance is at least
+// 4 * bayer[y % 8][x % 8] + 2, so 0 is always clear and 255 always set.
+static const uint8_t bayer[8][8] = {
+    { 0, 32, 8, 40, 2, 34, 10, 42},
+    {48, 16, 56, 24, 50, 18, 58, 26},
+    {12, 44, 4, 36, 14, 46, 6, 38},
+    {60, 28, 52, 20, 62, 30, 54, 22},
+    { 3, 35, 11, 43, 1, 33, 9, 41},
+    {51, 19, 59, 27, 49, 17, 57, 25},
+    {15, 47, 7, 39, 13, 45, 5, 37},
+    {63, 31, 55, 23, 61, 29, 53, 21},
 };
 
 enum {
@@ -685,7 +788,39 @@ enum {
     SWAP_RB = 1 << 1,
 };
 
-static void fill_row(displayio_bitmap_t *bitmap, int swap, int16_t *luminance_data, int y, int mx) {
+// The luminance of a 16-bit pixel, scaled by 256, is the sum of one entry for each of its
+// bytes, because it is a weighted sum of the channels and each byte holds whole channels or
+// the top or bottom bits of green. Byte and red/blue swaps are folded into the tables.
+typedef struct {
+    uint16_t low[256], high[256]; // indexed by (pixel & 0xff) and (pixel >> 8)
+} dither_luma_table_t;
+
+static void fill_luma_table(dither_luma_table_t *table, int swap) {
+    // ideal coefficients are around .299, .587, .114 (according to
+    // ppmtopnm), this differs from the 'other' luma-converting
+    // function in circuitpython (why?)
+
+    // we correct for the fact that the input ranges are 0..0xf8 (or
+    // 0xfc) rather than 0x00..0xff
+    // Check: (0xf8 *  78 + 0xfc * 154 + 0xf8 * 29) // 256 == 255
+    int rw = 78, bw = 29;
+    if (swap & SWAP_RB) {
+        rw = 29;
+        bw = 78;
+    }
+    uint16_t *first = table->high, *second = table->low;
+    if (swap & SWAP_BYTES) {
+        first = table->low;
+        second = table->high;
+    }
+    for (int i = 0; i < 256; i++) {
+        // red and the top 3 bits of green, then the bottom 3 bits of green and blue
+        first[i] = (i & 0xf8) * rw + ((i & 7) << 5) * 154;
+        second[i] = ((i >> 5) << 2) * 154 + ((i << 3) & 0xf8) * bw;
+    }
+}
+
+static void fill_row(displayio_bitmap_t *bitmap, const dither_luma_table_t *table, int16_t *luminance_data, int y, int mx) {
     if (y >= bitmap->height) {
         return;
     }
@@ -705,50 +840,106 @@ static void fill_row(displayio_bitmap_t *bitmap, int swap, int16_t *luminance_da
         uint16_t *pixel_data = (uint16_t *)(bitmap->data + bitmap->stride * y);
         for (int x = 0; x < bitmap->width; x++) {
             uint16_t pixel = *pixel_data++;
-            if (swap & SWAP_BYTES) {
-                pixel = __builtin_bswap16(pixel);
-            }
-            int r = (pixel >> 8) & 0xf8;
-            int g = (pixel >> 3) & 0xfc;
-            int b = (pixel << 3) & 0xf8;
-
-            if (swap & SWAP_RB) {
-                uint8_t tmp = r;
-                r = b;
-                b = tmp;
-            }
-
-            // ideal coefficients are around .299, .587, .114 (according to
-            // ppmtopnm), this differs from the 'other' luma-converting
-            // function in circuitpython (why?)
-
-            // we correct for the fact that the input ranges are 0..0xf8 (or
-            // 0xfc) rather than 0x00..0xff
-            // Check: (0xf8 *  78 + 0xfc * 154 + 0xf8 * 29) // 256 == 255
-            *luminance_data++ = (r * 78 + g * 154 + b * 29) / 256;
+            *luminance_data++ = (table->low[pixel & 0xff] + table->high[pixel >> 8]) >> 8;
         }
     }
 }
 
-static void write_pixels(displayio_bitmap_t *bitmap, int y, bool *data) {
+// Output rows are packed 32 pixels to a word, with the leftmost pixel in the top bit
+static void write_pixels(displayio_bitmap_t *bitmap, int y, const uint32_t *data) {
     if (bitmap->bits_per_value == 1) {
+        // A 1-bit bitmap holds the leftmost pixel in the top bit of each byte
         uint32_t *pixel_data = (uint32_t *)(bitmap->data + bitmap->stride * y);
-        for (int i = 0; i < bitmap->width; i++) {
-            uint32_t p = 0;
-            for (int j = 0; j < 32; j++) {
-                p = (p << 1);
-                if (*data++) {
-                    p |= 1;
-                }
-            }
-            *pixel_data++ = p;
+        for (int i = 0; i < (bitmap->width + 31) / 32; i++) {
+            #if MP_ENDIANNESS_LITTLE
+            *pixel_data++ = __builtin_bswap32(*data++);
+            #else
+            *pixel_data++ = *data++;
+            #endif
         }
     } else {
         uint16_t *pixel_data = (uint16_t *)(bitmap->data + bitmap->stride * y);
-        for (int i = 0; i < bitmap->width; i++) {
-            *pixel_data++ = *data++ ? 65535 : 0;
+        for (int x = 0; x < bitmap->width; x++) {
+            *pixel_data++ = -((data[x >> 5] >> (31 - (x & 31))) & 1);
+        }
+    }
+}
+
+// Dither one row, left-to-right or right-to-left, returning the error carried to the next
+// row. This is inlined into one function per algorithm and direction, so that the terms
+// are unrolled.
+static inline MP_ALWAYSINLINE int16_t diffuse_row(const bitmaptools_dither_algorithm_info_t *info, int16_t *const *rows, uint32_t *out, int width, int16_t err, int dir) {
+    // The row pointers are held in locals, since stores to the rows could otherwise alias them
+    int16_t *const row[3] = { rows[0], rows[1], rows[2] };
+    int x = dir > 0 ? 0 : width - 1;
+    uint32_t acc = 0;
+    for (int n = width; n--; x += dir) {
+        int32_t pixel_in = row[0][x] + err;
+        uint32_t pixel_out = pixel_in >= 128;
+        err = pixel_in - (pixel_out ? 255 : 0);
+
+        for (int i = 0; i < info->count; i++) {
+            int x1 = x + dir * info->terms[i].dx;
+            int dy = info->terms[i].dy;
+
+            row[dy][x1] = ((info->terms[i].dl * err) / 256) + row[dy][x1];
+        }
+        err = (err * info->dl) / 256;
+
+        if (dir > 0) {
+            acc = (acc << 1) | pixel_out;
+            if ((x & 31) == 31) {
+                out[x >> 5] = acc;
+            }
+        } else {
+            acc = (acc >> 1) | (pixel_out << 31);
+            if ((x & 31) == 0) {
+                out[x >> 5] = acc;
+            }
+        }
+    }
+    if (dir > 0 && (width & 31)) {
+        out[width >> 5] = acc << (32 - (width & 31));
+    }
+    return err;
+}
+
+typedef int16_t (*dither_row_fun_t)(int16_t *const *rows, uint32_t *out, int width, int16_t err, bool reverse);
+
+#define DITHER_ROW_FUN(algorithm) \
+    static int16_t algorithm##_row(int16_t *const *rows, uint32_t *out, int width, int16_t err, bool reverse) { \
+        if (reverse) { \
+            return diffuse_row(&algorithm, rows, out, width, err, -1); \
+        } \
+        return diffuse_row(&algorithm, rows, out, width, err, 1); \
+    }
+DITHER_ROW_FUN(atkinson)
+DITHER_ROW_FUN(floyd_stenberg)
+
+static const struct {
+    const bitmaptools_dither_algorithm_info_t *info;
+    dither_row_fun_t row;
+} algorithms[] = {
+    [DITHER_ALGORITHM_ATKINSON] = { &atkinson, atkinson_row },
+    [DITHER_ALGORITHM_FLOYD_STENBERG] = { &floyd_stenberg, floyd_stenberg_row },
+    [DITHER_ALGORITHM_BAYER] = { NULL, NULL },
+};
+
+static void ordered_row(const int16_t *luminance_data, uint32_t *out, int width, int y) {
+    uint8_t threshold[8];
+    for (int i = 0; i < 8; i++) {
+        threshold[i] = 4 * bayer[y & 7][i] + 2;
+    }
+    uint32_t acc = 0;
+    for (int x = 0; x < width; x++) {
+        acc = (acc << 1) | (luminance_data[x] >= threshold[x & 7]);
+        if ((x & 31) == 31) {
+            out[x >> 5] = acc;
         }
     }
+    if (width & 31) {
+        out[width >> 5] = acc << (32 - (width & 31));
+    }
 }
 
 void common_hal_bitmaptools_dither(displayio_bitmap_t *dest_bitmap, displayio_bitmap_t *source_bitmap, displayio_colorspace_t colorspace, bitmaptools_dither_algorithm_t algorithm) {
@@ -761,80 +952,52 @@ void common_hal_bitmaptools_dither(displayio_bitmap_t *dest_bitmap, displayio_bi
     if (colorspace == DISPLAYIO_COLORSPACE_BGR565 || colorspace == DISPLAYIO_COLORSPACE_BGR565_SWAPPED) {
         swap |= SWAP_RB;
     }
+    dither_luma_table_t table;
+    if (source_bitmap->bits_per_value == 16) {
+        fill_luma_table(&table, swap);
+    }
 
-    bitmaptools_dither_algorithm_info_t *info = algorithms[algorithm];
-    // rowdata holds 3 rows of data.  Each one is larger than the input
-    // bitmap's width, because `mx` extra pixels are allocated at the start and
-    // end of the row so that no conditionals are needed when storing the error data.
-    int16_t rowdata[(width + 2 * info->mx) * 3];
-    int16_t *rows[3] = {
-        rowdata + info->mx, rowdata + width + info->mx * 3, rowdata + 2 * width + info->mx * 5
-    };
-    // out holds one output row of pixels, and is padded to be a multiple of 32 so that the 1bpp storage loop can be simplified
-    bool out[(width + 31) / 32 * 32];
-
-    fill_row(source_bitmap, swap, rows[0], 0, info->mx);
-    fill_row(source_bitmap, swap, rows[1], 1, info->mx);
-    fill_row(source_bitmap, swap, rows[2], 2, info->mx);
-
-    int16_t err = 0;
-
-    for (int y = 0; y < height; y++) {
-
-        // Serpentine dither.  Going left-to-right...
-        for (int x = 0; x < width; x++) {
-            int32_t pixel_in = rows[0][x] + err;
-            bool pixel_out = pixel_in >= 128;
-            out[x] = pixel_out;
-
-            err = pixel_in - (pixel_out ? 255 : 0);
-
-            for (int i = 0; i < info->count; i++) {
-                int x1 = x + info->terms[i].dx;
-                int dy = info->terms[i].dy;
-
-                rows[dy][x1] = ((info->terms[i].dl * err) / 256) + rows[dy][x1];
-            }
-            err = (err * info->dl) / 256;
-        }
-        write_pixels(dest_bitmap, y, out);
-
-        // Cycle the rows by shuffling pointers, this is faster than copying the data.
-        int16_t *tmp = rows[0];
-        rows[0] = rows[1];
-        rows[1] = rows[2];
-        rows[2] = tmp;
-
-        y++;
-        if (y == height) {
-            break;
+    // out holds one output row of pixels, packed by write_pixels
+    uint32_t out[(width + 31) / 32];
+
+    const bitmaptools_dither_algorithm_info_t *info = algorithms[algorithm].info;
+    if (!info) {
+        // An ordered dither looks at each pixel on its own
+        int16_t luminance_data[width];
+        for (int y = 0; y < height; y++) {
+            fill_row(source_bitmap, &table, luminance_data, y, 0);
+            ordered_row(luminance_data, out, width, y);
+            write_pixels(dest_bitmap, y, out);
         }
-
-        fill_row(source_bitmap, swap, rows[2], y + 2, info->mx);
-
-        // Serpentine dither.   Going right-to-left...
-        for (int x = width; x--;) {
-            int16_t pixel_in = rows[0][x] + err;
-            bool pixel_out = pixel_in >= 128;
-            out[x] = pixel_out;
-            err = pixel_in - (pixel_out ? 255 : 0);
-
-            for (int i = 0; i < info->count; i++) {
-                int x1 = x - info->terms[i].dx;
-                int dy = info->terms[i].dy;
-
-                rows[dy][x1] = ((info->terms[i].dl * err) / 256) + rows[dy][x1];
-            }
-            err = (err * info->dl) / 256;
+    } else {
+        dither_row_fun_t dither_row = algorithms[algorithm].row;
+        // rowdata holds 3 rows of data.  Each one is larger than the input
+        // bitmap's width, because `mx` extra pixels are allocated at the start and
+        // end of the row so that no conditionals are needed when storing the error data.
+        int16_t rowdata[(width + 2 * info->mx) * 3];
+        int16_t *rows[3] = {
+            rowdata + info->mx, rowdata + width + info->mx * 3, rowdata + 2 * width + info->mx * 5
+        };
+
+        fill_row(source_bitmap, &table, rows[0], 0, info->mx);
+        fill_row(source_bitmap, &table, rows[1], 1, info->mx);
+        fill_row(source_bitmap, &table, rows[2], 2, info->mx);
+
+        int16_t err = 0;
+
+        for (int y = 0; y < height; y++) {
+            // Serpentine dither.  Going left-to-right on even rows, and right-to-left on odd ones
+            err = dither_row(rows, out, width, err, y & 1);
+            write_pixels(dest_bitmap, y, out);
+
+            // Cycle the rows by shuffling pointers, this is faster than copying the data.
+            int16_t *tmp = rows[0];
+            rows[0] = rows[1];
+            rows[1] = rows[2];
+            rows[2] = tmp;
+
+            fill_row(source_bitmap, &table, rows[2], y + 3, info->mx);
         }
-        write_pixels(dest_bitmap, y, out);
-
-        tmp = rows[0];
-        rows[0] = rows[1];
-        rows[1] = rows[2];
-        rows[2] = tmp;
-
-        fill_row(source_bitmap, swap, rows[2], y + 3, info->mx);
     }
 
     displayio_area_t a = { 0, 0, width, height, NULL };
@@ -1034,6 +1197,81 @@ void common_hal_bitmaptools_draw_circle(displayio_bitmap_t *destination,
     draw_circle(destination, x, y, radius, value);
 }
 
+// Reads the 8 bits of a packed row that start at bit. Bytes outside first_byte..last_byte read
+// as zero so that partial bytes at either end never touch memory outside the row.
+static uint8_t _blit_read_bits(const uint8_t *row, int32_t bit, int32_t first_byte, int32_t last_byte) {
+    int32_t index = bit < 0 ? -1 : bit / 8;
+    uint8_t offset = bit & 7;
+    uint16_t window = 0;
+    if (index >= first_byte && index <= last_byte) {
+        window = row[index] << 8;
+    }
+    if (offset != 0 && index + 1 >= first_byte && index + 1 <= last_byte) {
+        window |= row[index + 1];
+    }
+    return (uint16_t)(window << offset) >> 8;
+}
+
+// Copies nbits of a packed sub-byte row a byte at a time. Bitmaps store the first pixel in the
+// most significant bits of each byte. Copies in whichever direction is safe when src and dst
+// are the same row.
+static void _blit_bits(uint8_t *dst, int32_t dst_bit, const uint8_t *src, int32_t src_bit, int32_t nbits) {
+    int32_t first = dst_bit / 8;
+    int32_t last = (dst_bit + nbits - 1) / 8;
+    int32_t src_first = src_bit / 8;
+    int32_t src_last = (src_bit + nbits - 1) / 8;
+    int32_t delta = src_bit - dst_bit;
+    uint8_t first_mask = 0xff >> (dst_bit & 7);
+    uint8_t last_mask = 0xff << (7 - ((dst_bit + nbits - 1) & 7));
+
+    if (delta % 8 == 0 && last - first > 1) {
+        // Same alignment so everything but the end bytes is a plain memmove.
+        uint8_t head = _blit_read_bits(src, first * 8 + delta, src_first, src_last);
+        uint8_t tail = _blit_read_bits(src, last * 8 + delta, src_first, src_last);
+        memmove(dst + first + 1, src + first + 1 + delta / 8, last - first - 1);
+        dst[first] = (dst[first] & ~first_mask) | (head & first_mask);
+        dst[last] = (dst[last] & ~last_mask) | (tail & last_mask);
+        return;
+    }
+
+    int32_t step = delta < 0 ? -1 : 1;
+    int32_t start = delta < 0 ? last : first;
+    for (int32_t index = start; index >= first && index <= last; index += step) {
+        uint8_t mask = 0xff;
+        if (index == first) {
+            mask &= first_mask;
+        }
+        if (index == last) {
+            mask &= last_mask;
+        }
+        uint8_t value = _blit_read_bits(src, index * 8 + delta, src_first, src_last);
+        dst[index] = (dst[index] & ~mask) | (value & mask);
+    }
+}
+
+// Copies a row of 8, 16 or 32-bit pixels leaving skipped pixels alone. The loop bodies are
+// branch free selects so the compiler can vectorize them.
+#define BLIT_SKIP_ROW(type) \
+    static void _blit_skip_row_##type(type *dst, const type *src, int16_t count, bool reverse, \
+    bool skip_source, uint32_t skip_source_index, bool skip_dest, uint32_t skip_dest_index) { \
+        if (!reverse) { \
+            for (int16_t i = 0; i < count; i++) { \
+                type value = src[i]; \
+                bool keep = (skip_source && value == skip_source_index) || (skip_dest && dst[i] == skip_dest_index); \
+                dst[i] = keep ? dst[i] : value; \
+            } \
+        } else { \
+            for (int16_t i = count - 1; i >= 0; i--) { \
+                type value = src[i]; \
+                bool keep = (skip_source && value == skip_source_index) || (skip_dest && dst[i] == skip_dest_index); \
+                dst[i] = keep ? dst[i] : value; \
+            } \
+        } \
+    }
+BLIT_SKIP_ROW(uint8_t)
+BLIT_SKIP_ROW(uint16_t)
+BLIT_SKIP_ROW(uint32_t)
+
 void common_hal_bitmaptools_blit(displayio_bitmap_t *destination, displayio_bitmap_t *source, int16_t x, int16_t y,
     int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint32_t skip_source_index, bool skip_source_index_none, uint32_t skip_dest_index,
     bool skip_dest_index_none) {
@@ -1059,44 +1297,61 @@ void common_hal_bitmaptools_blit(displayio_bitmap_t *destination, displayio_bitm
     displayio_area_t a = { x, y, dirty_x_max, dirty_y_max, NULL};
     displayio_bitmap_set_dirty_area(destination, &a);
 
-    bool x_reverse = false;
-    bool y_reverse = false;
-
-    // Add reverse direction option to protect blitting of destination bitmap back into destination bitmap
-    if (x > x1) {
-        x_reverse = true;
-    }
-    if (y > y1) {
-        y_reverse = true;
+    // Clip to the destination. x and y are never negative.
+    int16_t width = MIN(x2 - x1, destination->width - x);
+    int16_t height = MIN(y2 - y1, destination->height - y);
+    if (width <= 0 || height <= 0) {
+        return;
     }
 
-    // simplest version - use internal functions for get/set pixels
-    for (int16_t i = 0; i < (x2 - x1); i++) {
-
-        const int xs_index = x_reverse ? ((x2) - i - 1) : x1 + i; // x-index into the source bitmap
-        const int xd_index = x_reverse ? ((x + (x2 - x1)) - i - 1) : x + i; // x-index into the destination bitmap
-
-        if ((xd_index >= 0) && (xd_index < destination->width)) {
-            for (int16_t j = 0; j < (y2 - y1); j++) {
-
-                const int ys_index = y_reverse ? ((y2) - j - 1) : y1 + j;  // y-index into the source bitmap
-                const int yd_index = y_reverse ? ((y + (y2 - y1)) - j - 1) : y + j; // y-index into the destination bitmap
-
-                if ((yd_index >= 0) && (yd_index < destination->height)) {
-                    uint32_t value = common_hal_displayio_bitmap_get_pixel(source, xs_index, ys_index);
-                    if (skip_dest_index_none) { // if skip_dest_index is none, then only check source skip
-                        if ((skip_source_index_none) || (value != skip_source_index)) {   // write if skip_value_none is True
-                            displayio_bitmap_write_pixel(destination, xd_index, yd_index, value);
-                        }
-                    } else { // check dest_value index against skip_dest_index and skip if they match
-                        uint32_t dest_value = common_hal_displayio_bitmap_get_pixel(destination, xd_index, yd_index);
-                        if (dest_value != skip_dest_index) {
-                            if ((skip_source_index_none) || (value != skip_source_index)) {   // write if skip_value_none is True
-                                displayio_bitmap_write_pixel(destination, xd_index, yd_index, value);
-                            }
-                        }
-                    }
+    // Walk rows and columns away from the overlap so that blitting a bitmap into itself reads
+    // every source pixel before it is overwritten.
+    bool x_reverse = x > x1;
+    bool y_reverse = y > y1;
+    bool skip = !skip_source_index_none || !skip_dest_index_none;
+    bool same_depth = source->bits_per_value == destination->bits_per_value;
+    uint8_t bits_per_value = source->bits_per_value;
+
+    for (int16_t j = 0; j < height; j++) {
+        const int16_t row = y_reverse ? height - j - 1 : j;
+        const int16_t ys_index = y1 + row;
+        const int16_t yd_index = y + row;
+        uint8_t *dst = (uint8_t *)(destination->data + yd_index * destination->stride);
+        const uint8_t *src = (const uint8_t *)(source->data + ys_index * source->stride);
+
+        if (same_depth && bits_per_value >= 8 && !skip) {
+            uint8_t bytes_per_value = bits_per_value / 8;
+            memmove(dst + x * bytes_per_value, src + x1 * bytes_per_value, width * bytes_per_value);
+        } else if (same_depth && bits_per_value >= 8) {
+            bool skip_source = !skip_source_index_none;
+            bool skip_dest = !skip_dest_index_none;
+            if (bits_per_value == 8) {
+                _blit_skip_row_uint8_t(dst + x, src + x1, width, x_reverse,
+                    skip_source, skip_source_index, skip_dest, skip_dest_index);
+            } else if (bits_per_value == 16) {
+                _blit_skip_row_uint16_t((uint16_t *)dst + x, (const uint16_t *)src + x1, width, x_reverse,
+                    skip_source, skip_source_index, skip_dest, skip_dest_index);
+            } else {
+                _blit_skip_row_uint32_t((uint32_t *)dst + x, (const uint32_t *)src + x1, width, x_reverse,
+                    skip_source, skip_source_index, skip_dest, skip_dest_index);
+            }
+        } else if (same_depth && !skip) {
+            _blit_bits(dst, x * bits_per_value, src, x1 * bits_per_value, width * bits_per_value);
+        } else {
+            // Mixed depths and sub-byte skips go pixel by pixel.
+            for (int16_t i = 0; i < width; i++) {
+                const int16_t column = x_reverse ? width - i - 1 : i;
+                const int16_t xs_index = x1 + column;
+                const int16_t xd_index = x + column;
+                uint32_t value = common_hal_displayio_bitmap_get_pixel(source, xs_index, ys_index);
+                if (!skip_source_index_none && value == skip_source_index) {
+                    continue;
+                }
+                if (!skip_dest_index_none &&
+                    common_hal_displayio_bitmap_get_pixel(destination, xd_index, yd_index) == skip_dest_index) {
+                    continue;
                 }
+                displayio_bitmap_write_pixel(destination, xd_index, yd_index, value);
             }
         }
     }
@@ -6,6 +6,8 @@
 
 #include "shared-bindings/displayio/ColorConverter.h"
 
+#include <string.h>
+
 #include "py/misc.h"
 #include "py/runtime.h"
 
@@ -26,6 +28,9 @@ void common_hal_displayio_colorconverter_construct(displayio_colorconverter_t *s
     self->transparent_color = NO_TRANSPARENT_COLOR;
     self->input_colorspace = input_colorspace;
     self->output_colorspace.depth = 16;
+    if (input_colorspace == DISPLAYIO_COLORSPACE_L8) {
+        self->lut = m_malloc(256 * sizeof(uint32_t));
+    }
 }
 
 uint16_t displayio_colorconverter_compute_rgb565(uint32_t color_rgb888) {
@@ -159,6 +164,8 @@ void common_hal_displayio_colorconverter_convert(displayio_colorconverter_t *sel
 
 void common_hal_displayio_colorconverter_set_dither(displayio_colorconverter_t *self, bool dither) {
     self->dither = dither;
+    // Pick the kernel again on the next conversion.
+    self->kernel_colorspace = NULL;
 }
 
 bool common_hal_displayio_colorconverter_get_dither(displayio_colorconverter_t *self) {
@@ -315,6 +322,61 @@ void displayio_convert_color(const _displayio_colorspace_t *colorspace, bool dit
     output_color->opaque = false;
 }
 
+void displayio_colorconverter_prepare(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace) {
+    // Check the grayscale settings because EPaperDisplay will change them on the same object.
+    if (self->kernel_colorspace == colorspace &&
+        self->kernel_colorspace_grayscale_bit == colorspace->grayscale_bit &&
+        self->kernel_colorspace_grayscale == colorspace->grayscale) {
+        return;
+    }
+    self->kernel_colorspace = colorspace;
+    self->kernel_colorspace_grayscale_bit = colorspace->grayscale_bit;
+    self->kernel_colorspace_grayscale = colorspace->grayscale;
+    self->kernel = DISPLAYIO_COLORCONVERTER_KERNEL_GENERIC;
+
+    // Dithering depends on the pixel location so every pixel needs the full conversion.
+    if (self->dither) {
+        return;
+    }
+    if (colorspace->depth == 16) {
+        bool swap = colorspace->reverse_bytes_in_word;
+        switch (self->input_colorspace) {
+            case DISPLAYIO_COLORSPACE_RGB565:
+                self->kernel = swap ? DISPLAYIO_COLORCONVERTER_KERNEL_SWAP : DISPLAYIO_COLORCONVERTER_KERNEL_COPY;
+                return;
+            case DISPLAYIO_COLORSPACE_RGB565_SWAPPED:
+                self->kernel = swap ? DISPLAYIO_COLORCONVERTER_KERNEL_COPY : DISPLAYIO_COLORCONVERTER_KERNEL_SWAP;
+                return;
+            case DISPLAYIO_COLORSPACE_RGB888:
+                self->kernel = swap ? DISPLAYIO_COLORCONVERTER_KERNEL_RGB888_TO_RGB565_SWAPPED : DISPLAYIO_COLORCONVERTER_KERNEL_RGB888_TO_RGB565;
+                return;
+            default:
+                break;
+        }
+    } else if (colorspace->depth == 32 && self->input_colorspace == DISPLAYIO_COLORSPACE_RGB888) {
+        self->kernel = DISPLAYIO_COLORCONVERTER_KERNEL_COPY;
+        return;
+    }
+
+    if (self->lut == NULL) {
+        return;
+    }
+    displayio_input_pixel_t input_pixel = { 0 };
+    displayio_output_pixel_t output_pixel;
+    for (uint32_t i = 0; i < 256; i++) {
+        input_pixel.pixel = displayio_colorconverter_convert_pixel(self->input_colorspace, i);
+        output_pixel.pixel = 0;
+        output_pixel.opaque = true;
+        displayio_convert_color(colorspace, false, &input_pixel, &output_pixel);
+        if (!output_pixel.opaque) {
+            // The colorspace isn't supported so leave it to the generic path.
+            return;
+        }
+        self->lut[i] = output_pixel.pixel;
+    }
+    self->kernel = DISPLAYIO_COLORCONVERTER_KERNEL_LUT;
+}
+
 void displayio_colorconverter_convert(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color) {
     uint32_t pixel = input_pixel->pixel;
 
@@ -323,6 +385,39 @@ void displayio_colorconverter_convert(displayio_colorconverter_t *self, const _d
         return;
     }
 
+    displayio_colorconverter_prepare(self, colorspace);
+    switch (self->kernel) {
+        case DISPLAYIO_COLORCONVERTER_KERNEL_COPY:
+            // 16-bit kernels only match the full conversion for 16-bit values.
+            if (colorspace->depth == 32 || pixel <= 0xffff) {
+                output_color->pixel = pixel;
+                output_color->opaque = true;
+                return;
+            }
+            break;
+        case DISPLAYIO_COLORCONVERTER_KERNEL_SWAP:
+            if (pixel <= 0xffff) {
+                output_color->pixel = __builtin_bswap16(pixel);
+                output_color->opaque = true;
+                return;
+            }
+            break;
+        case DISPLAYIO_COLORCONVERTER_KERNEL_RGB888_TO_RGB565:
+            output_color->pixel = displayio_colorconverter_compute_rgb565(pixel);
+            output_color->opaque = true;
+            return;
+        case DISPLAYIO_COLORCONVERTER_KERNEL_RGB888_TO_RGB565_SWAPPED:
+            output_color->pixel = __builtin_bswap16(displayio_colorconverter_compute_rgb565(pixel));
+            output_color->opaque = true;
+            return;
+        case DISPLAYIO_COLORCONVERTER_KERNEL_LUT:
+            output_color->pixel = self->lut[pixel & 0xff];
+            output_color->opaque = true;
+            return;
+        default:
+            break;
+    }
+
     if (!self->dither && self->cached_colorspace == colorspace && self->cached_input_pixel == input_pixel->pixel) {
         output_color->pixel = self->cached_output_color;
         return;
@@ -339,7 +434,69 @@ void displayio_colorconverter_convert(displayio_colorconverter_t *self, const _d
     }
 }
 
+bool displayio_colorconverter_convert_row16(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace, const void *row, uint8_t bits_per_value, uint16_t *output, size_t count) {
+    if (colorspace->depth != 16 || self->transparent_color != NO_TRANSPARENT_COLOR) {
+        return false;
+    }
+    displayio_colorconverter_prepare(self, colorspace);
 
+    // Keep these loops free of branches so the compiler can unroll or vectorize them.
+    switch (self->kernel) {
+        case DISPLAYIO_COLORCONVERTER_KERNEL_COPY:
+            if (bits_per_value != 16) {
+                return false;
+            }
+            memcpy(output, row, count * sizeof(uint16_t));
+            return true;
+        case DISPLAYIO_COLORCONVERTER_KERNEL_SWAP: {
+            if (bits_per_value != 16) {
+                return false;
+            }
+            const uint16_t *input = row;
+            for (size_t i = 0; i < count; i++) {
+                output[i] = __builtin_bswap16(input[i]);
+            }
+            return true;
+        }
+        case DISPLAYIO_COLORCONVERTER_KERNEL_RGB888_TO_RGB565:
+        case DISPLAYIO_COLORCONVERTER_KERNEL_RGB888_TO_RGB565_SWAPPED: {
+            if (bits_per_value == 32) {
+                const uint32_t *input = row;
+                for (size_t i = 0; i < count; i++) {
+                    uint32_t rgb888 = input[i];
+                    output[i] = (rgb888 >> 19) << 11 | ((rgb888 >> 10) & 0x3f) << 5 | ((rgb888 >> 3) & 0x1f);
+                }
+            } else if (bits_per_value == 16) {
+                // Only green and blue fit in 16-bit values.
+                const uint16_t *input = row;
+                for (size_t i = 0; i < count; i++) {
+                    uint32_t rgb888 = input[i];
+                    output[i] = ((rgb888 >> 10) & 0x3f) << 5 | ((rgb888 >> 3) & 0x1f);
+                }
+            } else {
+                return false;
+            }
+            if (self->kernel == DISPLAYIO_COLORCONVERTER_KERNEL_RGB888_TO_RGB565_SWAPPED) {
+                for (size_t i = 0; i < count; i++) {
+                    output[i] = __builtin_bswap16(output[i]);
+                }
+            }
+            return true;
+        }
+        case DISPLAYIO_COLORCONVERTER_KERNEL_LUT: {
+            if (bits_per_value != 8) {
+                return false;
+            }
+            const uint8_t *input = row;
+            for (size_t i = 0; i < count; i++) {
+                output[i] = self->lut[input[i]];
+            }
+            return true;
+        }
+        default:
+            return false;
+    }
+}
 
 // Currently no refresh logic is needed for a ColorConverter.
 bool displayio_colorconverter_needs_refresh(displayio_colorconverter_t *self) {
@@ -12,6 +12,17 @@
 #include "py/obj.h"
 #include "shared-module/displayio/Palette.h"
 
+// How a ColorConverter turns its input into a given output colorspace. Everything but GENERIC
+// skips the trip through RGB888 and gives the same result.
+typedef enum {
+    DISPLAYIO_COLORCONVERTER_KERNEL_GENERIC,
+    DISPLAYIO_COLORCONVERTER_KERNEL_COPY, // The input is already in the output format.
+    DISPLAYIO_COLORCONVERTER_KERNEL_SWAP, // 16-bit input only needs its bytes swapped.
+    DISPLAYIO_COLORCONVERTER_KERNEL_RGB888_TO_RGB565,
+    DISPLAYIO_COLORCONVERTER_KERNEL_RGB888_TO_RGB565_SWAPPED,
+    DISPLAYIO_COLORCONVERTER_KERNEL_LUT, // 8-bit input is looked up in lut.
+} displayio_colorconverter_kernel_t;
+
 typedef struct displayio_colorconverter {
     mp_obj_base_t base;
     bool dither;
@@ -23,11 +34,24 @@ typedef struct displayio_colorconverter {
     const _displayio_colorspace_t *cached_colorspace;
     uint32_t cached_input_pixel;
     uint32_t cached_output_color;
+
+    // The kernel picked for kernel_colorspace by displayio_colorconverter_prepare().
+    const _displayio_colorspace_t *kernel_colorspace;
+    uint8_t kernel_colorspace_grayscale_bit;
+    bool kernel_colorspace_grayscale;
+    displayio_colorconverter_kernel_t kernel;
+    uint32_t *lut; // 256 converted colors for L8 input.
 } displayio_colorconverter_t;
 
 bool displayio_colorconverter_needs_refresh(displayio_colorconverter_t *self);
 void displayio_colorconverter_finish_refresh(displayio_colorconverter_t *self);
 void displayio_colorconverter_convert(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color);
+// Picks the conversion kernel for colorspace once instead of branching per pixel.
+void displayio_colorconverter_prepare(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace);
+// Converts count values from a Bitmap row into 16-bit output pixels in one pass. Returns false
+// when the pixels must go through displayio_colorconverter_convert() one at a time instead,
+// such as when dithering or when a color is transparent.
+bool displayio_colorconverter_convert_row16(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace, const void *row, uint8_t bits_per_value, uint16_t *output, size_t count);
 
 uint32_t displayio_colorconverter_dither_noise_1(uint32_t n);
 uint32_t displayio_colorconverter_dither_noise_2(uint32_t x, uint32_t y);
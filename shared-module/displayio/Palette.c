@@ -11,6 +11,7 @@
 void common_hal_displayio_palette_construct(displayio_palette_t *self, uint16_t color_count, bool dither) {
     self->color_count = color_count;
     self->colors = (_displayio_color_t *)m_malloc(color_count * sizeof(_displayio_color_t));
+    self->cached_colorspace = NULL;
     self->dither = dither;
 }
 
@@ -24,11 +25,15 @@ bool common_hal_displayio_palette_get_dither(displayio_palette_t *self) {
 
 void common_hal_displayio_palette_make_opaque(displayio_palette_t *self, uint32_t palette_index) {
     self->colors[palette_index].transparent = false;
+    self->colors[palette_index].cached = false;
+    self->cache_dirty = true;
     self->needs_refresh = true;
 }
 
 void common_hal_displayio_palette_make_transparent(displayio_palette_t *self, uint32_t palette_index) {
     self->colors[palette_index].transparent = true;
+    self->colors[palette_index].cached = false;
+    self->cache_dirty = true;
     self->needs_refresh = true;
 }
 
@@ -45,7 +50,8 @@ void common_hal_displayio_palette_set_color(displayio_palette_t *self, uint32_t
         return;
     }
     self->colors[palette_index].rgb888 = color;
-    self->colors[palette_index].cached_colorspace = NULL;
+    self->colors[palette_index].cached = false;
+    self->cache_dirty = true;
     self->needs_refresh = true;
 }
 
@@ -53,34 +59,62 @@ uint32_t common_hal_displayio_palette_get_color(displayio_palette_t *self, uint3
     return self->colors[palette_index].rgb888;
 }
 
+bool displayio_palette_prepare(displayio_palette_t *self, const _displayio_colorspace_t *colorspace) {
+    if (self->dither) {
+        return false;
+    }
+    bool colorspace_changed = self->cached_colorspace != colorspace ||
+        self->cached_colorspace_grayscale_bit != colorspace->grayscale_bit ||
+        self->cached_colorspace_grayscale != colorspace->grayscale;
+    if (!colorspace_changed && !self->cache_dirty) {
+        return true;
+    }
+
+    // Without dithering the conversion only depends on the color so it is done once per entry
+    // instead of once per pixel.
+    displayio_input_pixel_t input_pixel = { 0 };
+    displayio_output_pixel_t output_pixel;
+    for (uint32_t i = 0; i < self->color_count; i++) {
+        _displayio_color_t *color = &self->colors[i];
+        if (color->cached && !colorspace_changed) {
+            continue;
+        }
+        input_pixel.pixel = color->rgb888;
+        output_pixel.pixel = 0;
+        output_pixel.opaque = true;
+        displayio_convert_color(colorspace, false, &input_pixel, &output_pixel);
+        color->cached_color = output_pixel.pixel;
+        color->cached_opaque = output_pixel.opaque && !color->transparent;
+        color->cached = true;
+    }
+    self->cached_colorspace = colorspace;
+    self->cached_colorspace_grayscale_bit = colorspace->grayscale_bit;
+    self->cached_colorspace_grayscale = colorspace->grayscale;
+    self->cache_dirty = false;
+    return true;
+}
+
 void displayio_palette_get_color(displayio_palette_t *self, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color) {
     uint32_t palette_index = input_pixel->pixel;
-    if (palette_index > self->color_count || self->colors[palette_index].transparent) {
+    if (palette_index >= self->color_count) {
         output_color->opaque = false;
         return;
     }
 
-    // Cache results when not dithering.
     _displayio_color_t *color = &self->colors[palette_index];
-    // Check the grayscale settings because EPaperDisplay will change them on
-    // the same object.
-    if (!self->dither &&
-        color->cached_colorspace == colorspace &&
-        color->cached_colorspace_grayscale_bit == colorspace->grayscale_bit &&
-        color->cached_colorspace_grayscale == colorspace->grayscale) {
-        output_color->pixel = self->colors[palette_index].cached_color;
+    if (displayio_palette_prepare(self, colorspace)) {
+        output_color->pixel = color->cached_color;
+        output_color->opaque = color->cached_opaque;
         return;
     }
 
+    if (color->transparent) {
+        output_color->opaque = false;
+        return;
+    }
     displayio_input_pixel_t rgb888_pixel = *input_pixel;
-    rgb888_pixel.pixel = self->colors[palette_index].rgb888;
+    rgb888_pixel.pixel = color->rgb888;
     displayio_convert_color(colorspace, self->dither, &rgb888_pixel, output_color);
-    if (!self->dither) {
-        color->cached_colorspace = colorspace;
-        color->cached_color = output_color->pixel;
-        color->cached_colorspace_grayscale = colorspace->grayscale;
-        color->cached_colorspace_grayscale_bit = colorspace->grayscale_bit;
-    }
 }
 
 bool displayio_palette_needs_refresh(displayio_palette_t *self) {
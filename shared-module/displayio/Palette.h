@@ -28,10 +28,9 @@ typedef struct {
 
 typedef struct {
     uint32_t rgb888;
-    const _displayio_colorspace_t *cached_colorspace;
-    uint32_t cached_color;
-    uint8_t cached_colorspace_grayscale_bit;
-    bool cached_colorspace_grayscale;
+    uint32_t cached_color; // rgb888 converted to the palette's cached colorspace.
+    bool cached; // cached_color and cached_opaque are up to date.
+    bool cached_opaque;
     bool transparent; // This may have additional bits added later for blending.
 } _displayio_color_t;
 
@@ -53,12 +52,21 @@ typedef struct displayio_palette {
     mp_obj_base_t base;
     _displayio_color_t *colors;
     uint32_t color_count;
+    // The colorspace that every cached color was converted for. Check the grayscale settings
+    // too because EPaperDisplay will change them on the same object.
+    const _displayio_colorspace_t *cached_colorspace;
+    uint8_t cached_colorspace_grayscale_bit;
+    bool cached_colorspace_grayscale;
+    bool cache_dirty; // At least one color needs to be converted again.
     bool needs_refresh;
     bool dither;
 } displayio_palette_t;
 
 
 void displayio_palette_get_color(displayio_palette_t *palette, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color);
-;
+// Converts every color for colorspace ahead of a fill so that it can read cached_color and
+// cached_opaque directly. Returns false when the palette dithers and each pixel must go through
+// displayio_palette_get_color() instead.
+bool displayio_palette_prepare(displayio_palette_t *self, const _displayio_colorspace_t *colorspace);
 bool displayio_palette_needs_refresh(displayio_palette_t *self);
 void displayio_palette_finish_refresh(displayio_palette_t *self);
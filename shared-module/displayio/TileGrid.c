@@ -6,6 +6,8 @@
 
 #include "shared-bindings/displayio/TileGrid.h"
 
+#include <string.h>
+
 #include "py/runtime.h"
 #include "shared-bindings/displayio/Bitmap.h"
 #include "shared-bindings/displayio/ColorConverter.h"
@@ -242,37 +244,48 @@ uint8_t common_hal_displayio_tilegrid_get_tile(displayio_tilegrid_t *self, uint1
     return tiles[y * self->width_in_tiles + x];
 }
 
-void common_hal_displayio_tilegrid_set_tile(displayio_tilegrid_t *self, uint16_t x, uint16_t y, uint8_t tile_index) {
-    if (tile_index >= self->tiles_in_bitmap) {
-        mp_raise_ValueError(MP_ERROR_TEXT("Tile index out of bounds"));
-    }
-    uint8_t *tiles = self->tiles;
+uint8_t *displayio_tilegrid_get_tiles(displayio_tilegrid_t *self) {
     if (self->inline_tiles) {
-        tiles = (uint8_t *)&self->tiles;
+        return (uint8_t *)&self->tiles;
     }
-    if (tiles == NULL) {
+    return self->tiles;
+}
+
+void displayio_tilegrid_mark_tiles_dirty(displayio_tilegrid_t *self, const displayio_area_t *tile_area) {
+    if (displayio_area_empty(tile_area)) {
         return;
     }
-    tiles[y * self->width_in_tiles + x] = tile_index;
     displayio_area_t temp_area;
-    displayio_area_t *tile_area;
+    displayio_area_t *dirty_area;
     if (!self->partial_change) {
-        tile_area = &self->dirty_area;
+        dirty_area = &self->dirty_area;
     } else {
-        tile_area = &temp_area;
+        dirty_area = &temp_area;
     }
-    int16_t tx = (x - self->top_left_x) % self->width_in_tiles;
+    // Tiles are stored unscrolled so a span that crosses the top left tile wraps around on
+    // screen. Widen it to the full width or height in that case.
+    int16_t tx = (tile_area->x1 - self->top_left_x) % self->width_in_tiles;
     if (tx < 0) {
         tx += self->width_in_tiles;
     }
-    tile_area->x1 = tx * self->tile_width;
-    tile_area->x2 = tile_area->x1 + self->tile_width;
-    int16_t ty = (y - self->top_left_y) % self->height_in_tiles;
+    int16_t tw = tile_area->x2 - tile_area->x1;
+    if (tx + tw > self->width_in_tiles) {
+        tx = 0;
+        tw = self->width_in_tiles;
+    }
+    dirty_area->x1 = tx * self->tile_width;
+    dirty_area->x2 = dirty_area->x1 + tw * self->tile_width;
+    int16_t ty = (tile_area->y1 - self->top_left_y) % self->height_in_tiles;
     if (ty < 0) {
         ty += self->height_in_tiles;
     }
-    tile_area->y1 = ty * self->tile_height;
-    tile_area->y2 = tile_area->y1 + self->tile_height;
+    int16_t th = tile_area->y2 - tile_area->y1;
+    if (ty + th > self->height_in_tiles) {
+        ty = 0;
+        th = self->height_in_tiles;
+    }
+    dirty_area->y1 = ty * self->tile_height;
+    dirty_area->y2 = dirty_area->y1 + th * self->tile_height;
 
     if (self->partial_change) {
         displayio_area_union(&self->dirty_area, &temp_area, &self->dirty_area);
@@ -281,24 +294,38 @@ void common_hal_displayio_tilegrid_set_tile(displayio_tilegrid_t *self, uint16_t
     self->partial_change = true;
 }
 
-void common_hal_displayio_tilegrid_set_all_tiles(displayio_tilegrid_t *self, uint8_t tile_index) {
+void displayio_tilegrid_fill_tile_row(displayio_tilegrid_t *self, uint16_t x1, uint16_t x2, uint16_t y, uint8_t tile_index) {
+    uint8_t *tiles = displayio_tilegrid_get_tiles(self);
+    if (tiles == NULL || x1 >= x2) {
+        return;
+    }
+    memset(tiles + y * self->width_in_tiles + x1, tile_index, x2 - x1);
+}
+
+void common_hal_displayio_tilegrid_set_tile(displayio_tilegrid_t *self, uint16_t x, uint16_t y, uint8_t tile_index) {
     if (tile_index >= self->tiles_in_bitmap) {
         mp_raise_ValueError(MP_ERROR_TEXT("Tile index out of bounds"));
     }
-    uint8_t *tiles = self->tiles;
-    if (self->inline_tiles) {
-        tiles = (uint8_t *)&self->tiles;
-    }
+    uint8_t *tiles = displayio_tilegrid_get_tiles(self);
     if (tiles == NULL) {
         return;
     }
+    tiles[y * self->width_in_tiles + x] = tile_index;
+    displayio_area_t tile_area = { .x1 = x, .y1 = y, .x2 = x + 1, .y2 = y + 1 };
+    displayio_tilegrid_mark_tiles_dirty(self, &tile_area);
+}
 
-    for (uint16_t x = 0; x < self->width_in_tiles; x++) {
-        for (uint16_t y = 0; y < self->height_in_tiles; y++) {
-            tiles[y * self->width_in_tiles + x] = tile_index;
-        }
+void common_hal_displayio_tilegrid_set_all_tiles(displayio_tilegrid_t *self, uint8_t tile_index) {
+    if (tile_index >= self->tiles_in_bitmap) {
+        mp_raise_ValueError(MP_ERROR_TEXT("Tile index out of bounds"));
+    }
+    uint8_t *tiles = displayio_tilegrid_get_tiles(self);
+    if (tiles == NULL) {
+        return;
     }
 
+    memset(tiles, tile_index, self->width_in_tiles * self->height_in_tiles);
+
     self->full_change = true;
 }
 
@@ -361,6 +388,50 @@ void common_hal_displayio_tilegrid_set_top_left(displayio_tilegrid_t *self, uint
     self->full_change = true;
 }
 
+// Fills the area a run of bitmap pixels at a time when a ColorConverter can convert whole rows
+// to the 16-bit colorspace. This only handles unscaled and untransposed tile grids. Returns false
+// before writing anything if the rows must be converted per pixel instead.
+static bool _fill_area_rows16(displayio_tilegrid_t *self, const uint8_t *tiles,
+    const _displayio_colorspace_t *colorspace, int16_t start_x, int16_t end_x, int16_t start_y, int16_t end_y,
+    int16_t start, int16_t x_shift, int16_t y_shift, int16_t x_stride, int16_t y_stride,
+    uint32_t *mask, uint32_t *buffer) {
+    displayio_colorconverter_t *colorconverter = self->pixel_shader;
+    displayio_bitmap_t *bitmap = self->bitmap;
+    uint8_t bytes_per_value = bitmap->bits_per_value / 8;
+    uint16_t converted[32];
+
+    for (int16_t y = start_y; y < end_y; ++y) {
+        int16_t row_start = start + (y - start_y + y_shift) * y_stride; // in pixels
+        uint16_t tile_row = ((y / self->tile_height + self->top_left_y) % self->height_in_tiles) * self->width_in_tiles;
+        int16_t x = start_x;
+        while (x < end_x) {
+            // Runs stop at tile edges because the next tile may come from elsewhere in the bitmap.
+            uint16_t tile = tiles[tile_row + (x / self->tile_width + self->top_left_x) % self->width_in_tiles];
+            uint16_t tile_x = (tile % self->bitmap_width_in_tiles) * self->tile_width + x % self->tile_width;
+            uint16_t tile_y = (tile / self->bitmap_width_in_tiles) * self->tile_height + y % self->tile_height;
+            int16_t count = MIN(end_x - x, self->tile_width - x % self->tile_width);
+            count = MIN(count, (int16_t)MP_ARRAY_SIZE(converted));
+
+            const uint8_t *row = (const uint8_t *)(bitmap->data + tile_y * bitmap->stride) + tile_x * bytes_per_value;
+            if (!displayio_colorconverter_convert_row16(colorconverter, colorspace, row, bitmap->bits_per_value, converted, count)) {
+                // Every run converts the same way so this only happens on the first one.
+                return false;
+            }
+
+            int16_t offset = row_start + (x - start_x + x_shift) * x_stride; // in pixels
+            for (int16_t i = 0; i < count; i++) {
+                if ((mask[offset / 32] & (1u << (offset % 32))) == 0) {
+                    mask[offset / 32] |= 1u << (offset % 32);
+                    ((uint16_t *)buffer)[offset] = converted[i];
+                }
+                offset += x_stride;
+            }
+            x += count;
+        }
+    }
+    return true;
+}
+
 bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
     const _displayio_colorspace_t *colorspace, const displayio_area_t *area,
     uint32_t *mask, uint32_t *buffer) {
@@ -448,6 +519,24 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
         y_shift = temp_shift;
     }
 
+    if (colorspace->depth == 16 &&
+        self->absolute_transform->scale == 1 &&
+        self->transpose_xy == self->absolute_transform->transpose_xy &&
+        mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type) &&
+        mp_obj_is_type(self->bitmap, &displayio_bitmap_type) &&
+        _fill_area_rows16(self, tiles, colorspace, start_x, end_x, start_y, end_y,
+            start, x_shift, y_shift, x_stride, y_stride, mask, buffer)) {
+        // Every converted pixel is opaque.
+        return full_coverage;
+    }
+
+    // Convert the palette once up front so each pixel is a table lookup.
+    displayio_palette_t *prepared_palette = NULL;
+    if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type) &&
+        displayio_palette_prepare(self->pixel_shader, colorspace)) {
+        prepared_palette = self->pixel_shader;
+    }
+
     uint8_t pixels_per_byte = 8 / colorspace->depth;
 
     displayio_input_pixel_t input_pixel;
@@ -466,7 +555,7 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
             // }
 
             // Check the mask first to see if the pixel has already been set.
-            if ((mask[offset / 32] & (1 << (offset % 32))) != 0) {
+            if ((mask[offset / 32] & (1u << (offset % 32))) != 0) {
                 continue;
             }
             int16_t local_x = input_pixel.x / self->absolute_transform->scale;
@@ -489,6 +578,14 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
             output_pixel.opaque = true;
             if (self->pixel_shader == mp_const_none) {
                 output_pixel.pixel = input_pixel.pixel;
+            } else if (prepared_palette != NULL) {
+                if (input_pixel.pixel < prepared_palette->color_count) {
+                    const _displayio_color_t *color = &prepared_palette->colors[input_pixel.pixel];
+                    output_pixel.pixel = color->cached_color;
+                    output_pixel.opaque = color->cached_opaque;
+                } else {
+                    output_pixel.opaque = false;
+                }
             } else if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
                 displayio_palette_get_color(self->pixel_shader, colorspace, &input_pixel, &output_pixel);
             } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
@@ -498,7 +595,7 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
                 // A pixel is transparent so we haven't fully covered the area ourselves.
                 full_coverage = false;
             } else {
-                mask[offset / 32] |= 1 << (offset % 32);
+                mask[offset / 32] |= 1u << (offset % 32);
                 if (colorspace->depth == 16) {
                     *(((uint16_t *)buffer) + offset) = output_pixel.pixel;
                 } else if (colorspace->depth == 32) {
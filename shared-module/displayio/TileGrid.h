@@ -51,6 +51,15 @@ typedef struct {
 
 void displayio_tilegrid_set_hidden_by_parent(displayio_tilegrid_t *self, bool hidden);
 
+// Bulk tile access for writers like terminalio that change many tiles at once. Tile indices
+// written directly aren't validated or tracked so callers must check them against
+// tiles_in_bitmap and report the changed tiles with displayio_tilegrid_mark_tiles_dirty.
+uint8_t *displayio_tilegrid_get_tiles(displayio_tilegrid_t *self);
+// Area is in tile coordinates. Unions it into the dirty area in one step.
+void displayio_tilegrid_mark_tiles_dirty(displayio_tilegrid_t *self, const displayio_area_t *tile_area);
+// Sets tiles x1 up to (but not including) x2 of row y. Doesn't mark them dirty.
+void displayio_tilegrid_fill_tile_row(displayio_tilegrid_t *self, uint16_t x1, uint16_t x2, uint16_t y, uint8_t tile_index);
+
 // Updating the screen is a three stage process.
 
 // The first stage is used to determine i
@@ -116,7 +116,8 @@ static const displayio_area_t *_get_refresh_areas(framebufferio_framebufferdispl
 }
 
 #define MARK_ROW_DIRTY(r) (dirty_row_bitmask[r / 8] |= (1 << (r & 7)))
-static bool _refresh_area(framebufferio_framebufferdisplay_obj_t *self, const displayio_area_t *area, uint8_t *dirty_row_bitmask) {
+#define ROW_IS_DIRTY(r) (dirty_row_bitmask[r / 8] & (1 << (r & 7)))
+static bool _refresh_area(framebufferio_framebufferdisplay_obj_t *self, const displayio_area_t *area, uint8_t *dirty_row_bitmask, framebuffer_dirty_span_t *dirty_spans) {
     uint16_t buffer_size = CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE / sizeof(uint32_t); // In uint32_ts
 
     displayio_area_t clipped;
@@ -195,6 +196,16 @@ static bool _refresh_area(framebufferio_framebufferdisplay_obj_t *self, const di
 
         for (uint16_t i = subrectangle.y1; i < subrectangle.y2; i++) {
             assert(dest >= buf && dest < endbuf && dest + rowsize <= endbuf);
+            if (dirty_spans != NULL) {
+                framebuffer_dirty_span_t *span = &dirty_spans[i];
+                if (!ROW_IS_DIRTY(i)) {
+                    span->x1 = subrectangle.x1;
+                    span->x2 = subrectangle.x2;
+                } else {
+                    span->x1 = MIN(span->x1, subrectangle.x1);
+                    span->x2 = MAX(span->x2, subrectangle.x2);
+                }
+            }
             MARK_ROW_DIRTY(i);
             memcpy(dest, src, rowsize);
             dest += rowstride;
@@ -222,12 +233,20 @@ static void _refresh_display(framebufferio_framebufferdisplay_obj_t *self) {
         int row_count = transposed ? self->core.width : self->core.height;
         uint8_t dirty_row_bitmask[(row_count + 7) / 8];
         memset(dirty_row_bitmask, 0, sizeof(dirty_row_bitmask));
+        // Only track spans when the framebuffer can use them.
+        bool use_spans = self->framebuffer_protocol->swapbuffers_spans != NULL;
+        framebuffer_dirty_span_t dirty_span_storage[use_spans ? row_count : 1];
+        framebuffer_dirty_span_t *dirty_spans = use_spans ? dirty_span_storage : NULL;
         self->framebuffer_protocol->get_bufinfo(self->framebuffer, &self->bufinfo);
         while (current_area != NULL) {
-            _refresh_area(self, current_area, dirty_row_bitmask);
+            _refresh_area(self, current_area, dirty_row_bitmask, dirty_spans);
             current_area = current_area->next;
         }
-        self->framebuffer_protocol->swapbuffers(self->framebuffer, dirty_row_bitmask);
+        if (use_spans) {
+            self->framebuffer_protocol->swapbuffers_spans(self->framebuffer, dirty_row_bitmask, dirty_spans);
+        } else {
+            self->framebuffer_protocol->swapbuffers(self->framebuffer, dirty_row_bitmask);
+        }
     }
     displayio_display_core_finish_refresh(&self->core);
 }
@@ -55,6 +55,14 @@ typedef void (*framebuffer_deinit_fun)(mp_obj_t);
 typedef void (*framebuffer_get_bufinfo_fun)(mp_obj_t, mp_buffer_info_t *bufinfo);
 typedef void (*framebuffer_swapbuffers_fun)(mp_obj_t, uint8_t *dirty_row_bitmask);
 
+// The changed pixels of one framebuffer row, from x1 up to but not including x2. Only valid for
+// rows that are set in the dirty row bitmask.
+typedef struct {
+    uint16_t x1;
+    uint16_t x2;
+} framebuffer_dirty_span_t;
+typedef void (*framebuffer_swapbuffers_spans_fun)(mp_obj_t, uint8_t *dirty_row_bitmask, const framebuffer_dirty_span_t *dirty_spans);
+
 typedef struct _framebuffer_p_t {
     MP_PROTOCOL_HEAD // MP_QSTR_protocol_framebuffer
 
@@ -80,4 +88,8 @@ typedef struct _framebuffer_p_t {
     framebuffer_get_brightness_fun get_brightness;
     framebuffer_set_brightness_fun set_brightness;
 
+    // Optional -- used instead of swapbuffers by backends that can push part of a row.
+    // dirty_spans has one entry per row.
+    framebuffer_swapbuffers_spans_fun swapbuffers_spans;
+
 } framebuffer_p_t;
@@ -16,7 +16,23 @@
 #include "shared-bindings/displayio/ColorConverter.h"
 #include "shared-bindings/util.h"
 
-#define BLOCK_SIZE (126) // (2^7) - 2 // (DO NOT CHANGE!)
+// Frames are compressed as they are written, so the output is buffered in small pieces
+#define BUFFER_SIZE (512)
+
+// Every frame uses the same 128 color palette, so pixels are 7 bit LZW symbols
+#define MIN_CODE_SIZE (7)
+#define CLEAR_CODE (1 << MIN_CODE_SIZE)
+#define END_CODE (CLEAR_CODE + 1)
+#define FIRST_CODE (CLEAR_CODE + 2)
+#define MAX_CODE_SIZE (12)
+#define MAX_CODES (1 << MAX_CODE_SIZE)
+
+// The dictionary is a hash table with room for every code, as in the classic compress
+// program: a prime size about 20% larger than needed keeps the probe sequences short, and
+// each entry packs the (pixel, prefix) key above the code. Unlike compress, the key is hashed
+// by its remainder, which spreads keys over the whole table.
+#define HASH_SIZE (5003)
+#define HASH_EMPTY (0xffffffff)
 
 static void handle_error(gifio_gifwriter_t *self) {
     if (self->error != 0) {
@@ -36,10 +52,12 @@ static void flush_data(gifio_gifwriter_t *self) {
     }
 }
 
-// These "write" calls _MUST_ have enough buffer space available!  This is
-// ensured by allocating the proper buffer size in construct.
+// Writes are buffered, and the buffer is written to the file whenever it fills up
 static void write_data(gifio_gifwriter_t *self, const void *data, size_t size) {
-    assert(self->cur + size <= self->size);
+    if (self->cur + size > self->size) {
+        flush_data(self);
+    }
+    assert(size <= self->size);
     memcpy(self->data + self->cur, data, size);
     self->cur += size;
 }
@@ -68,10 +86,10 @@ void shared_module_gifio_gifwriter_construct(gifio_gifwriter_t *self, mp_obj_t *
     self->dither = dither;
     self->own_file = own_file;
 
-    size_t nblocks = (width * height + 125) / 126;
-    self->size = nblocks * 128 + 4;
+    self->size = BUFFER_SIZE;
     self->data = m_malloc(self->size);
     self->cur = 0;
+    self->hash_table = m_new(uint32_t, HASH_SIZE);
     self->error = 0;
 
     write_data(self, "GIF89a", 6);
@@ -154,7 +172,138 @@ static const uint8_t g_bayer[4][4] = {
     {31, 14, 26, 10}
 };
 
+typedef enum {
+    QUANTIZE_L8,
+    QUANTIZE_RGB565,
+    QUANTIZE_RGB565_DITHER,
+} quantize_mode_t;
+
+typedef struct {
+    gifio_gifwriter_t *writer;
+    uint32_t *hash_table;
+    uint32_t bits;
+    int bit_count;
+    int code_size, max_code, next_code;
+    // The code for the pixels seen so far that are in the dictionary, or -1 at the start
+    int prefix;
+    bool clear;
+    // A data sub-block: a length byte, then up to 255 bytes of codes
+    uint8_t block[256];
+} lzw_encoder_t;
+
+static void lzw_put_byte(lzw_encoder_t *lzw, uint8_t value) {
+    lzw->block[++lzw->block[0]] = value;
+    if (lzw->block[0] == 255) {
+        write_data(lzw->writer, lzw->block, 256);
+        lzw->block[0] = 0;
+    }
+}
+
+static void lzw_output(lzw_encoder_t *lzw, int code) {
+    lzw->bits |= (uint32_t)code << lzw->bit_count;
+    lzw->bit_count += lzw->code_size;
+    while (lzw->bit_count >= 8) {
+        lzw_put_byte(lzw, lzw->bits);
+        lzw->bits >>= 8;
+        lzw->bit_count -= 8;
+    }
+
+    // The decoder adds a code to its dictionary only when it reads the one after, so the codes
+    // widen one code later than the dictionary outgrows them
+    if (lzw->clear) {
+        lzw->code_size = MIN_CODE_SIZE + 1;
+        lzw->max_code = (1 << lzw->code_size) - 1;
+        lzw->clear = false;
+    } else if (lzw->next_code > lzw->max_code && lzw->code_size < MAX_CODE_SIZE) {
+        lzw->code_size++;
+        lzw->max_code = (1 << lzw->code_size) - 1;
+    }
+}
+
+static void lzw_clear(lzw_encoder_t *lzw) {
+    memset(lzw->hash_table, 0xff, HASH_SIZE * sizeof(uint32_t));
+    lzw->next_code = FIRST_CODE;
+    lzw->clear = true;
+    lzw_output(lzw, CLEAR_CODE);
+}
+
+static inline void lzw_add(lzw_encoder_t *lzw, int pixel) {
+    int prefix = lzw->prefix;
+    if (prefix < 0) {
+        lzw->prefix = pixel;
+        return;
+    }
+
+    uint32_t key = ((uint32_t)pixel << MAX_CODE_SIZE) | prefix;
+    int i = key % HASH_SIZE;
+    int disp = i == 0 ? 1 : HASH_SIZE - i;
+    uint32_t entry;
+    while ((entry = lzw->hash_table[i]) != HASH_EMPTY) {
+        if ((entry >> MAX_CODE_SIZE) == key) {
+            lzw->prefix = entry & (MAX_CODES - 1);
+            return;
+        }
+        i -= disp;
+        if (i < 0) {
+            i += HASH_SIZE;
+        }
+    }
+
+    lzw_output(lzw, prefix);
+    lzw->prefix = pixel;
+    if (lzw->next_code < MAX_CODES) {
+        lzw->hash_table[i] = (key << MAX_CODE_SIZE) | lzw->next_code++;
+    } else {
+        lzw_clear(lzw);
+    }
+}
+
+// Quantize each pixel to the palette as it is fed to the encoder. mode is a constant at each
+// call site, so each gets its own loop.
+static inline void lzw_add_pixels(lzw_encoder_t *lzw, const void *buf, int width, int height, bool byteswap, quantize_mode_t mode) {
+    const uint8_t *pixels8 = buf;
+    const uint16_t *pixels16 = buf;
+    for (int y = 0; y < height; y++) {
+        // This row's dither thresholds, by x % 4
+        uint8_t red_threshold[4], green_threshold[4], blue_threshold[4];
+        if (mode == QUANTIZE_RGB565_DITHER) {
+            for (int i = 0; i < 4; i++) {
+                red_threshold[i] = rb_bayer[i][y % 4];
+                green_threshold[i] = g_bayer[i][(y + 2) % 4];
+                blue_threshold[i] = rb_bayer[(i + 2) % 4][y % 4];
+            }
+        }
+        for (int x = 0; x < width; x++) {
+            int index;
+            if (mode == QUANTIZE_L8) {
+                index = *pixels8++ >> 1;
+            } else {
+                int pixel = *pixels16++;
+                if (byteswap) {
+                    pixel = __builtin_bswap16(pixel);
+                }
+                if (mode == QUANTIZE_RGB565) {
+                    int red = (pixel >> (11 + (5 - 2))) & 0x3;
+                    int green = (pixel >> (5 + (6 - 3))) & 0x7;
+                    int blue = (pixel >> (0 + (5 - 2))) & 0x3;
+                    index = (red << 5) | (green << 2) | blue;
+                } else {
+                    int red = MAX(0, ((pixel >> 8) & 0xf8) - red_threshold[x & 3]);
+                    int green = MAX(0, ((pixel >> 3) & 0xfc) - green_threshold[x & 3]);
+                    int blue = MAX(0, ((pixel << 3) & 0xf8) - blue_threshold[x & 3]);
+                    index = ((red >> 1) & 0x60) | ((green >> 3) & 0x1c) | (blue >> 6);
+                }
+            }
+            lzw_add(lzw, index);
+        }
+    }
+}
+
 void shared_module_gifio_gifwriter_add_frame(gifio_gifwriter_t *self, const mp_buffer_info_t *bufinfo, int16_t delay) {
+    int pixel_count = self->width * self->height;
+    int bytes_per_pixel = self->colorspace == DISPLAYIO_COLORSPACE_L8 ? 1 : 2;
+    mp_get_index(&mp_type_memoryview, bufinfo->len, MP_OBJ_NEW_SMALL_INT(bytes_per_pixel * pixel_count - 1), false);
+
     if (delay) {
         write_data(self, (uint8_t []) {'!', 0xF9, 0x04, 0x04}, 4);
         write_word(self, delay);
@@ -165,85 +314,34 @@ void shared_module_gifio_gifwriter_add_frame(gifio_gifwriter_t *self, const mp_b
     write_long(self, 0);
     write_word(self, self->width);
     write_word(self, self->height);
-    write_data(self, (uint8_t []) {0x00, 0x07}, 2); // 7-bits
-
-    int pixel_count = self->width * self->height;
-    int blocks = (pixel_count + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    write_data(self, (uint8_t []) {0x00, MIN_CODE_SIZE}, 2);
 
-    uint8_t *data = self->data + self->cur;
+    lzw_encoder_t lzw = {
+        .writer = self,
+        .hash_table = self->hash_table,
+        .code_size = MIN_CODE_SIZE + 1,
+        .prefix = -1,
+    };
+    lzw_clear(&lzw);
 
     if (self->colorspace == DISPLAYIO_COLORSPACE_L8) {
-        mp_get_index(&mp_type_memoryview, bufinfo->len, MP_OBJ_NEW_SMALL_INT(pixel_count - 1), false);
-
-        uint8_t *pixels = bufinfo->buf;
-        for (int i = 0; i < blocks; i++) {
-            assert(pixel_count >= 0);
-            int block_size = MIN(BLOCK_SIZE, pixel_count);
-            pixel_count -= block_size;
-            *data++ = 1 + block_size;
-            *data++ = 0x80;
-            for (int j = 0; j < block_size; j++) {
-                *data++ = (*pixels++) >> 1;
-            }
-        }
+        lzw_add_pixels(&lzw, bufinfo->buf, self->width, self->height, false, QUANTIZE_L8);
     } else if (!self->dither) {
-        mp_get_index(&mp_type_memoryview, bufinfo->len, MP_OBJ_NEW_SMALL_INT(2 * pixel_count - 1), false);
-
-        uint16_t *pixels = bufinfo->buf;
-        for (int i = 0; i < blocks; i++) {
-            int block_size = MIN(BLOCK_SIZE, pixel_count);
-            pixel_count -= block_size;
-
-            *data++ = 1 + block_size;
-            *data++ = 0x80;
-            for (int j = 0; j < block_size; j++) {
-                int pixel = *pixels++;
-                if (self->byteswap) {
-                    pixel = __builtin_bswap16(pixel);
-                }
-                int red = (pixel >> (11 + (5 - 2))) & 0x3;
-                int green = (pixel >> (5 + (6 - 3))) & 0x7;
-                int blue = (pixel >> (0 + (5 - 2))) & 0x3;
-                *data++ = (red << 5) | (green << 2) | blue;
-            }
-        }
+        lzw_add_pixels(&lzw, bufinfo->buf, self->width, self->height, self->byteswap, QUANTIZE_RGB565);
     } else {
-        mp_get_index(&mp_type_memoryview, bufinfo->len, MP_OBJ_NEW_SMALL_INT(2 * pixel_count - 1), false);
-
-        uint16_t *pixels = bufinfo->buf;
-        int x = 0, y = 0;
-        for (int i = 0; i < blocks; i++) {
-            int block_size = MIN(BLOCK_SIZE, pixel_count);
-            pixel_count -= block_size;
-
-            *data++ = 1 + block_size;
-            *data++ = 0x80;
-            for (int j = 0; j < block_size; j++) {
-                int pixel = *pixels++;
-                if (self->byteswap) {
-                    pixel = __builtin_bswap16(pixel);
-                }
-                int red = (pixel >> 8) & 0xf8;
-                int green = (pixel >> 3) & 0xfc;
-                int blue = (pixel << 3) & 0xf8;
-
-                red = MAX(0, red - rb_bayer[x % 4][y % 4]);
-                green = MAX(0, green - g_bayer[x % 4][(y + 2) % 4]);
-                blue = MAX(0, blue - rb_bayer[(x + 2) % 4][y % 4]);
-                x++;
-                if (x == self->width) {
-                    x = 0;
-                    y++;
-                }
-
-                *data++ = ((red >> 1) & 0x60) | ((green >> 3) & 0x1c) | (blue >> 6);
-            }
-        }
+        lzw_add_pixels(&lzw, bufinfo->buf, self->width, self->height, self->byteswap, QUANTIZE_RGB565_DITHER);
     }
 
-    self->cur = data - self->data;
+    lzw_output(&lzw, lzw.prefix);
+    lzw_output(&lzw, END_CODE);
+    if (lzw.bit_count > 0) {
+        lzw_put_byte(&lzw, lzw.bits);
+    }
+    if (lzw.block[0] > 0) {
+        write_data(self, lzw.block, lzw.block[0] + 1);
+    }
+    write_byte(self, 0); // end of image data
 
-    write_data(self, (uint8_t []) {0x01, 0x81, 0x00}, 3); // end code
     flush_data(self);
     handle_error(self);
 }
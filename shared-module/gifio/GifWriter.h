@@ -19,6 +19,8 @@ typedef struct gifio_gifwriter {
     int error;
     uint8_t *data;
     size_t cur, size;
+    // The LZW dictionary: open addressing, each entry a (prefix, pixel) key and its code
+    uint32_t *hash_table;
     bool own_file;
     bool byteswap;
     bool dither;
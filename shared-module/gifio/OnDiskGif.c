@@ -14,31 +14,61 @@
 #include "py/runtime.h"
 
 
+// The decoder makes many small reads, and seeks back over data it has read ahead, so reads
+// are served from read_buf, which is refilled a block at a time.
 static int32_t GIFReadFile(GIFFILE *pFile, uint8_t *pBuf, int32_t iLen) {
-    uint32_t iBytesRead;
-    iBytesRead = iLen;
-    pyb_file_obj_t *f = pFile->fHandle;
+    gifio_ondiskgif_t *self = pFile->fHandle;
+    pyb_file_obj_t *f = self->file;
     // Note: If you read a file all the way to the last byte, seek() stops working
     if ((pFile->iSize - pFile->iPos) < iLen) {
-        iBytesRead = pFile->iSize - pFile->iPos - 1; // <-- ugly work-around
+        iLen = pFile->iSize - pFile->iPos - 1; // <-- ugly work-around
     }
-    if (iBytesRead <= 0) {
-        return 0;
-    }
-    UINT bytes_read;
-    if (f_read(&f->fp, pBuf, iBytesRead, &bytes_read) != FR_OK) {
-        mp_raise_OSError(MP_EIO);
+    int32_t done = 0;
+    while (done < iLen) {
+        int32_t offset = pFile->iPos - self->read_buf_pos;
+        if (offset >= 0 && offset < self->read_buf_len) {
+            int32_t n = MIN(iLen - done, self->read_buf_len - offset);
+            memcpy(pBuf + done, self->read_buf + offset, n);
+            done += n;
+            pFile->iPos += n;
+            continue;
+        }
+
+        if ((int32_t)f->fp.fptr != pFile->iPos && f_lseek(&f->fp, pFile->iPos) != FR_OK) {
+            mp_raise_OSError(MP_EIO);
+        }
+        UINT bytes_read;
+        if (iLen - done >= ONDISKGIF_READ_BUF_SIZE) {
+            // Large reads go straight to the caller's buffer
+            if (f_read(&f->fp, pBuf + done, iLen - done, &bytes_read) != FR_OK) {
+                mp_raise_OSError(MP_EIO);
+            }
+            done += bytes_read;
+            pFile->iPos += bytes_read;
+            break;
+        }
+        // The fill stops short of the last byte too, for the same reason as above
+        int32_t fill = MIN(ONDISKGIF_READ_BUF_SIZE, pFile->iSize - pFile->iPos - 1);
+        self->read_buf_pos = pFile->iPos;
+        self->read_buf_len = 0;
+        if (fill <= 0) {
+            break;
+        }
+        if (f_read(&f->fp, self->read_buf, fill, &bytes_read) != FR_OK) {
+            mp_raise_OSError(MP_EIO);
+        }
+        if (bytes_read == 0) {
+            break;
+        }
+        self->read_buf_len = bytes_read;
     }
-    pFile->iPos = f->fp.fptr;
 
-    return bytes_read;
+    return done;
 } /* GIFReadFile() */
 
 static int32_t GIFSeekFile(GIFFILE *pFile, int32_t iPosition) {
-    pyb_file_obj_t *f = pFile->fHandle;
-
-    f_lseek(&f->fp, iPosition);
-    pFile->iPos = f->fp.fptr;
+    // The file itself is only moved by the next read that misses read_buf
+    pFile->iPos = MAX(0, MIN(iPosition, pFile->iSize));
     return pFile->iPos;
 } /* GIFSeekFile() */
 
@@ -49,7 +79,6 @@ static void GIFDraw(GIFDRAW *pDraw) {
     // depending on the pixel type selected with gif.begin()
 
     gifio_ondiskgif_t *ondiskgif = (gifio_ondiskgif_t *)pDraw->pUser;
-    displayio_bitmap_t *bitmap = ondiskgif->bitmap;
     displayio_palette_t *palette = ondiskgif->palette;
 
     // Update the palette if we have one in RGB888
@@ -69,16 +98,15 @@ static void GIFDraw(GIFDRAW *pDraw) {
     }
 
     int iWidth = pDraw->iWidth;
-    if (iWidth + pDraw->iX > bitmap->width) {
-        iWidth = bitmap->width - pDraw->iX;
+    if (iWidth + pDraw->iX > ondiskgif->dest_width) {
+        iWidth = ondiskgif->dest_width - pDraw->iX;
     }
 
-    if (pDraw->iY + pDraw->y >= bitmap->height || pDraw->iX >= bitmap->width || iWidth < 1) {
+    if (ondiskgif->dest == NULL || pDraw->iY + pDraw->y >= ondiskgif->dest_height || pDraw->iX >= ondiskgif->dest_width || iWidth < 1) {
         return;
     }
 
-    int32_t row_start = (pDraw->y + pDraw->iY) * bitmap->stride;
-    uint32_t *row = bitmap->data + row_start;
+    uint8_t *row = ondiskgif->dest + (pDraw->y + pDraw->iY) * ondiskgif->dest_stride;
 
     if (pDraw->ucDisposalMethod == 2) { // restore to background color
         // Not supported currently. Need to reset the area the previous frame occupied
@@ -108,7 +136,16 @@ static void GIFDraw(GIFDRAW *pDraw) {
 
         uint8_t c, ucTransparent = pDraw->ucTransparent;
         d += pDraw->iX;
-        if (pDraw->ucHasTransparency == 1) {
+        if (ondiskgif->dest_swap) {
+            for (int x = 0; x < iWidth; x++)
+            {
+                c = *s++;
+                if (c != ucTransparent || pDraw->ucHasTransparency != 1) {
+                    *d = __builtin_bswap16(pPal[c]);
+                }
+                d++;
+            }
+        } else if (pDraw->ucHasTransparency == 1) {
             for (int x = 0; x < iWidth; x++)
             {
                 c = *s++;
@@ -142,7 +179,9 @@ void common_hal_gifio_ondiskgif_construct(gifio_ondiskgif_t *self, pyb_file_obj_
     self->gif.pfnDraw = GIFDraw;
     self->gif.pfnClose = NULL;
     self->gif.pfnOpen = NULL;
-    self->gif.GIFFile.fHandle = self->file;
+    self->gif.GIFFile.fHandle = self;
+    self->read_buf_pos = 0;
+    self->read_buf_len = 0;
 
     f_rewind(&self->file->fp);
     self->gif.GIFFile.iSize = (int32_t)f_size(&self->file->fp);
@@ -228,16 +267,24 @@ int32_t common_hal_gifio_ondiskgif_get_max_delay(gifio_ondiskgif_t *self) {
 }
 
 uint32_t common_hal_gifio_ondiskgif_next_frame(gifio_ondiskgif_t *self, bool setDirty) {
+    displayio_bitmap_t *bitmap = self->bitmap;
+    self->dest = (uint8_t *)bitmap->data;
+    self->dest_stride = bitmap->stride * sizeof(uint32_t);
+    self->dest_width = bitmap->width;
+    self->dest_height = bitmap->height;
+    self->dest_swap = false;
+
     int nextDelay = 0;
     int result = 0;
     result = GIF_playFrame(&self->gif, &nextDelay, self);
 
     if ((result >= 0) && (setDirty)) {
+        // Only the frame's own rectangle of the canvas changes
         displayio_area_t dirty_area = {
-            .x1 = 0,
-            .y1 = 0,
-            .x2 = self->bitmap->width,
-            .y2 = self->bitmap->height,
+            .x1 = self->gif.iX,
+            .y1 = self->gif.iY,
+            .x2 = self->gif.iX + self->gif.iWidth,
+            .y2 = self->gif.iY + self->gif.iHeight,
         };
 
         displayio_bitmap_set_dirty_area(self->bitmap, &dirty_area);
@@ -245,3 +292,64 @@ uint32_t common_hal_gifio_ondiskgif_next_frame(gifio_ondiskgif_t *self, bool set
 
     return nextDelay;
 }
+
+#if CIRCUITPY_FRAMEBUFFERIO
+uint32_t common_hal_gifio_ondiskgif_next_frame_to_display(gifio_ondiskgif_t *self, framebufferio_framebufferdisplay_obj_t *display, int x, int y) {
+    const _displayio_colorspace_t *colorspace = &display->core.colorspace;
+    if (self->palette != NULL || colorspace->depth != 16 || colorspace->grayscale) {
+        mp_raise_ValueError(MP_ERROR_TEXT("Unsupported colorspace"));
+    }
+    if (display->core.rotation != 0) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("%q must be %d"), MP_QSTR_rotation, 0);
+    }
+
+    const framebuffer_p_t *protocol = display->framebuffer_protocol;
+    mp_buffer_info_t bufinfo;
+    protocol->get_bufinfo(display->framebuffer, &bufinfo);
+    int width = display->core.width, height = display->core.height;
+    self->dest = NULL;
+    if (bufinfo.buf != NULL) {
+        self->dest = (uint8_t *)bufinfo.buf + display->first_pixel_offset + y * display->row_stride + x * 2;
+    }
+    self->dest_stride = display->row_stride;
+    self->dest_width = width - x;
+    self->dest_height = height - y;
+    // The decoder's pixels are big-endian, which the framebuffer only wants if it swaps bytes
+    self->dest_swap = !colorspace->reverse_bytes_in_word;
+
+    int nextDelay = 0;
+    GIF_playFrame(&self->gif, &nextDelay, self);
+
+    // Hand the framebuffer just the rows and columns the frame covered
+    displayio_area_t frame_area = {
+        .x1 = x + self->gif.iX,
+        .y1 = y + self->gif.iY,
+        .x2 = x + self->gif.iX + self->gif.iWidth,
+        .y2 = y + self->gif.iY + self->gif.iHeight,
+    };
+    displayio_area_t display_area = { 0, 0, width, height, NULL };
+    displayio_area_t dirty_area;
+    if (self->dest == NULL || !displayio_area_compute_overlap(&frame_area, &display_area, &dirty_area)) {
+        return nextDelay;
+    }
+
+    uint8_t dirty_row_bitmask[(height + 7) / 8];
+    memset(dirty_row_bitmask, 0, sizeof(dirty_row_bitmask));
+    bool use_spans = protocol->swapbuffers_spans != NULL;
+    framebuffer_dirty_span_t dirty_spans[use_spans ? height : 1];
+    for (int row = dirty_area.y1; row < dirty_area.y2; row++) {
+        dirty_row_bitmask[row / 8] |= 1 << (row & 7);
+        if (use_spans) {
+            dirty_spans[row].x1 = dirty_area.x1;
+            dirty_spans[row].x2 = dirty_area.x2;
+        }
+    }
+    if (use_spans) {
+        protocol->swapbuffers_spans(display->framebuffer, dirty_row_bitmask, dirty_spans);
+    } else {
+        protocol->swapbuffers(display->framebuffer, dirty_row_bitmask);
+    }
+
+    return nextDelay;
+}
+#endif
@@ -17,14 +17,28 @@
 
 #include "extmod/vfs_fat.h"
 
+// Enough to hold several sub-blocks of LZW data, which the decoder reads a byte and then a
+// block at a time
+#define ONDISKGIF_READ_BUF_SIZE (1024)
+
 typedef struct {
     mp_obj_base_t base;
     GIFIMAGE gif;
     pyb_file_obj_t *file;
     displayio_bitmap_t *bitmap;
     displayio_palette_t *palette;
+    // Where the frame being decoded is drawn: the bitmap's pixels, or a framebuffer
+    uint8_t *dest;
+    uint32_t dest_stride;
+    uint16_t dest_width;
+    uint16_t dest_height;
+    bool dest_swap; // Store RGB565 pixels in native rather than big-endian byte order
+    // The file data in read_buf starts at this file position
+    int32_t read_buf_pos;
+    int32_t read_buf_len;
     int32_t duration;
     int32_t frame_count;
     int32_t min_delay;
     int32_t max_delay;
+    uint8_t read_buf[ONDISKGIF_READ_BUF_SIZE];
 } gifio_ondiskgif_t;
@@ -10,9 +10,21 @@
 #include "mbedtls/ssl.h"
 
 void common_hal_hashlib_hash_update(hashlib_hash_obj_t *self, const uint8_t *data, size_t datalen) {
-    if (self->hash_type == MBEDTLS_SSL_HASH_SHA1) {
-        mbedtls_sha1_update_ret(&self->sha1, data, datalen);
-        return;
+    switch (self->hash_type) {
+        case MBEDTLS_SSL_HASH_MD5:
+            mbedtls_md5_update_ret(&self->md5, data, datalen);
+            break;
+        case MBEDTLS_SSL_HASH_SHA1:
+            mbedtls_sha1_update_ret(&self->sha1, data, datalen);
+            break;
+        case MBEDTLS_SSL_HASH_SHA224:
+        case MBEDTLS_SSL_HASH_SHA256:
+            mbedtls_sha256_update_ret(&self->sha256, data, datalen);
+            break;
+        case MBEDTLS_SSL_HASH_SHA384:
+        case MBEDTLS_SSL_HASH_SHA512:
+            mbedtls_sha512_update_ret(&self->sha512, data, datalen);
+            break;
     }
 }
 
@@ -20,19 +32,52 @@ void common_hal_hashlib_hash_digest(hashlib_hash_obj_t *self, uint8_t *data, siz
     if (datalen < common_hal_hashlib_hash_get_digest_size(self)) {
         return;
     }
-    if (self->hash_type == MBEDTLS_SSL_HASH_SHA1) {
-        // We copy the sha1 state so we can continue to update if needed or get
-        // the digest a second time.
-        mbedtls_sha1_context copy;
-        mbedtls_sha1_clone(&copy, &self->sha1);
-        mbedtls_sha1_finish_ret(&self->sha1, data);
-        mbedtls_sha1_clone(&self->sha1, &copy);
+    // Finish a copy of the state so we can continue to update if needed or get
+    // the digest a second time.
+    switch (self->hash_type) {
+        case MBEDTLS_SSL_HASH_MD5: {
+            mbedtls_md5_context copy;
+            mbedtls_md5_clone(&copy, &self->md5);
+            mbedtls_md5_finish_ret(&copy, data);
+            break;
+        }
+        case MBEDTLS_SSL_HASH_SHA1: {
+            mbedtls_sha1_context copy;
+            mbedtls_sha1_clone(&copy, &self->sha1);
+            mbedtls_sha1_finish_ret(&copy, data);
+            break;
+        }
+        case MBEDTLS_SSL_HASH_SHA224:
+        case MBEDTLS_SSL_HASH_SHA256: {
+            mbedtls_sha256_context copy;
+            mbedtls_sha256_clone(&copy, &self->sha256);
+            mbedtls_sha256_finish_ret(&copy, data);
+            break;
+        }
+        case MBEDTLS_SSL_HASH_SHA384:
+        case MBEDTLS_SSL_HASH_SHA512: {
+            mbedtls_sha512_context copy;
+            mbedtls_sha512_clone(&copy, &self->sha512);
+            mbedtls_sha512_finish_ret(&copy, data);
+            break;
+        }
     }
 }
 
 size_t common_hal_hashlib_hash_get_digest_size(hashlib_hash_obj_t *self) {
-    if (self->hash_type == MBEDTLS_SSL_HASH_SHA1) {
-        return 20;
+    switch (self->hash_type) {
+        case MBEDTLS_SSL_HASH_MD5:
+            return 16;
+        case MBEDTLS_SSL_HASH_SHA1:
+            return 20;
+        case MBEDTLS_SSL_HASH_SHA224:
+            return 28;
+        case MBEDTLS_SSL_HASH_SHA256:
+            return 32;
+        case MBEDTLS_SSL_HASH_SHA384:
+            return 48;
+        case MBEDTLS_SSL_HASH_SHA512:
+            return 64;
     }
     return 0;
 }
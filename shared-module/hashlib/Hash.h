@@ -6,12 +6,18 @@
 
 #pragma once
 
+#include "mbedtls/md5.h"
 #include "mbedtls/sha1.h"
+#include "mbedtls/sha256.h"
+#include "mbedtls/sha512.h"
 
 typedef struct {
     mp_obj_base_t base;
     union {
+        mbedtls_md5_context md5;
         mbedtls_sha1_context sha1;
+        mbedtls_sha256_context sha256;
+        mbedtls_sha512_context sha512;
     };
     // Of MBEDTLS_SSL_HASH_*
     uint8_t hash_type;
@@ -17,5 +17,25 @@ bool common_hal_hashlib_new(hashlib_hash_obj_t *self, const char *algorithm) {
         mbedtls_sha1_starts_ret(&self->sha1);
         return true;
     }
+    if (strcmp(algorithm, "sha224") == 0 || strcmp(algorithm, "sha256") == 0) {
+        bool is224 = strcmp(algorithm, "sha224") == 0;
+        self->hash_type = is224 ? MBEDTLS_SSL_HASH_SHA224 : MBEDTLS_SSL_HASH_SHA256;
+        mbedtls_sha256_init(&self->sha256);
+        mbedtls_sha256_starts_ret(&self->sha256, is224);
+        return true;
+    }
+    if (strcmp(algorithm, "sha384") == 0 || strcmp(algorithm, "sha512") == 0) {
+        bool is384 = strcmp(algorithm, "sha384") == 0;
+        self->hash_type = is384 ? MBEDTLS_SSL_HASH_SHA384 : MBEDTLS_SSL_HASH_SHA512;
+        mbedtls_sha512_init(&self->sha512);
+        mbedtls_sha512_starts_ret(&self->sha512, is384);
+        return true;
+    }
+    if (strcmp(algorithm, "md5") == 0) {
+        self->hash_type = MBEDTLS_SSL_HASH_MD5;
+        mbedtls_md5_init(&self->md5);
+        mbedtls_md5_starts_ret(&self->md5);
+        return true;
+    }
     return false;
 }
@@ -185,6 +185,62 @@ static int bitmap_output(JDEC *jd, void *data, JRECT *rect) {
     return 1;
 }
 
+// tjpgd's YCbCr to RGB conversion, including how it clips
+static inline uint8_t byteclip(int v) {
+    unsigned int u = (unsigned int)v & 0x3ff;
+    return u < 256 ? u : u < 512 ? 255 : 0;
+}
+
+static inline uint16_t ycbcr_to_rgb565_swapped(int yy, int cb, int cr) {
+    int r = byteclip(yy + (1435 * cr) / 1024);
+    int g = byteclip(yy - (352 * cb + 731 * cr) / 1024);
+    int b = byteclip(yy + (1814 * cb) / 1024);
+    return __builtin_bswap16(((r & 0xf8) << 8) | ((g & 0xfc) << 3) | (b >> 3));
+}
+
+// Convert an MCU's Y, Cb and Cr blocks straight into a 16-bit destination bitmap, giving the same
+// pixels as tjpgd's own conversion followed by a blit. Only full size and 1/8 scale are handled:
+// at 1/8 scale, each Y block is one pixel of its DC value, and the MCU shares one color.
+static int bitmap_output_yuv(JDEC *jd, void *data, JRECT *rect) {
+    jpegio_jpegdecoder_obj_t *self = CONTAINER_OF(jd, jpegio_jpegdecoder_obj_t, decoder);
+    const jd_yuv_t *mcu = data;
+    int msx = jd->msx;
+    int msy = jd->msy;
+    const jd_yuv_t *cb_block = mcu + msx * msy * 64;
+
+    // lim has already been clipped to the destination bitmap
+    int left = MAX(rect->left, self->lim.x1);
+    int right = MIN(rect->right + 1, self->lim.x2);
+    int top = MAX(rect->top, self->lim.y1);
+    int bottom = MIN(rect->bottom + 1, self->lim.y2);
+    if (left >= right || top >= bottom) {
+        return DECODER_CONTINUE;
+    }
+
+    displayio_bitmap_t *dest = self->dest;
+    int dest_x = self->x + left - self->lim.x1;
+    int dest_y = self->y + top - self->lim.y1;
+    for (int y = top; y < bottom; y++) {
+        uint16_t *row = (uint16_t *)(dest->data + (dest_y + y - top) * dest->stride) + dest_x;
+        int iy = y - rect->top;
+        if (jd->scale == 0) {
+            const jd_yuv_t *py = mcu + (iy >> 3) * msx * 64 + (iy & 7) * 8;
+            const jd_yuv_t *pc = cb_block + (iy >> (msy - 1)) * 8;
+            for (int x = left; x < right; x++) {
+                int ix = x - rect->left;
+                int c = ix >> (msx - 1);
+                *row++ = ycbcr_to_rgb565_swapped(py[(ix >> 3) * 64 + (ix & 7)], pc[c] - 128, pc[c + 64] - 128);
+            }
+        } else {
+            for (int x = left; x < right; x++) {
+                int ix = x - rect->left;
+                *row++ = ycbcr_to_rgb565_swapped(mcu[(iy * msx + ix) * 64], cb_block[0] - 128, cb_block[64] - 128);
+            }
+        }
+    }
+    return DECODER_CONTINUE;
+}
+
 void common_hal_jpegio_jpegdecoder_decode_into(
     jpegio_jpegdecoder_obj_t *self,
     displayio_bitmap_t *bitmap, int scale, int16_t x, int16_t y,
@@ -195,6 +251,10 @@ void common_hal_jpegio_jpegdecoder_decode_into(
         mp_raise_RuntimeError_varg(MP_ERROR_TEXT("%q() without %q()"), MP_QSTR_decode, MP_QSTR_open);
     }
 
+    // Only the part of lim that fits in the bitmap is needed
+    lim->x2 = MIN(lim->x2, lim->x1 + bitmap->width - x);
+    lim->y2 = MIN(lim->y2, lim->y1 + bitmap->height - y);
+
     self->x = x;
     self->y = y;
     self->lim = *lim;
@@ -202,9 +262,31 @@ void common_hal_jpegio_jpegdecoder_decode_into(
     self->skip_source_index_none = skip_source_index_none;
     self->skip_dest_index = skip_dest_index;
     self->skip_dest_index_none = skip_dest_index_none;
-
     self->dest = bitmap;
-    JRESULT result = jd_decomp(&self->decoder, bitmap_output, scale);
+
+    JRESULT result = JDR_OK;
+    if (lim->x1 < lim->x2 && lim->y1 < lim->y2) {
+        // The part of the full size image to decode. MCUs outside it are only entropy decoded,
+        // or skipped entirely at restart markers, and decoding stops after it.
+        JRECT roi = {
+            .left = lim->x1 << scale,
+            .right = (lim->x2 << scale) - 1,
+            .top = lim->y1 << scale,
+            .bottom = (lim->y2 << scale) - 1,
+        };
+        bool direct = bitmap->bits_per_value == 16 && !bitmap->read_only && (scale == 0 || scale == 3)
+            && skip_source_index_none && skip_dest_index_none;
+        result = jd_decomp_rect(&self->decoder, direct ? bitmap_output_yuv : bitmap_output, scale, &roi, direct);
+        if (direct) {
+            displayio_area_t area = {
+                .x1 = x,
+                .y1 = y,
+                .x2 = MIN(x + lim->x2 - lim->x1, bitmap->width),
+                .y2 = MIN(y + lim->y2 - lim->y1, bitmap->height),
+            };
+            displayio_bitmap_set_dirty_area(bitmap, &area);
+        }
+    }
     common_hal_jpegio_jpegdecoder_close(self);
     if (result != JDR_INTR) {
         check_jresult(result);
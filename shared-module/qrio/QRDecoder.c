@@ -4,6 +4,7 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <limits.h>
 #include <string.h>
 
 #include "py/gc.h"
@@ -13,32 +14,34 @@
 #include "shared-module/qrio/QRDecoder.h"
 
 void shared_module_qrio_qrdecoder_construct(qrdecoder_qrdecoder_obj_t *self, int width, int height) {
+    self->width = width;
+    self->height = height;
     self->quirc = quirc_new();
     quirc_resize(self->quirc, width, height);
+    self->window = NULL;
+    self->have_track = false;
 }
 
 int shared_module_qrio_qrdecoder_get_height(qrdecoder_qrdecoder_obj_t *self) {
-    int height;
-    quirc_begin(self->quirc, NULL, &height);
-    return height;
+    return self->height;
 }
 
 int shared_module_qrio_qrdecoder_get_width(qrdecoder_qrdecoder_obj_t *self) {
-    int width;
-    quirc_begin(self->quirc, &width, NULL);
-    return width;
+    return self->width;
 }
 void shared_module_qrio_qrdecoder_set_height(qrdecoder_qrdecoder_obj_t *self, int height) {
-    if (height != shared_module_qrio_qrdecoder_get_height(self)) {
-        int width = shared_module_qrio_qrdecoder_get_width(self);
-        quirc_resize(self->quirc, width, height);
+    if (height != self->height) {
+        self->height = height;
+        quirc_resize(self->quirc, self->width, height);
+        self->have_track = false;
     }
 }
 
 void shared_module_qrio_qrdecoder_set_width(qrdecoder_qrdecoder_obj_t *self, int width) {
-    if (width != shared_module_qrio_qrdecoder_get_width(self)) {
-        int height = shared_module_qrio_qrdecoder_get_height(self);
-        quirc_resize(self->quirc, width, height);
+    if (width != self->width) {
+        self->width = width;
+        quirc_resize(self->quirc, width, self->height);
+        self->have_track = false;
     }
 }
 
@@ -78,50 +81,200 @@ static mp_obj_t data_type(int type) {
     return mp_obj_new_int(type);
 }
 
-static void quirc_fill_buffer(qrdecoder_qrdecoder_obj_t *self, void *buf, qrio_pixel_policy_t policy) {
+static inline MP_ALWAYSINLINE uint8_t grey_at(const uint8_t *src, int i, qrio_pixel_policy_t policy) {
+    switch (policy) {
+        case QRIO_RGB565:
+            return (((const uint16_t *)src)[i] >> 3) & 0xfc;
+        case QRIO_RGB565_SWAPPED:
+            return (__builtin_bswap16(((const uint16_t *)src)[i]) >> 3) & 0xfc;
+        case QRIO_EVERY_BYTE:
+            return src[i];
+        case QRIO_ODD_BYTES:
+            return src[2 * i + 1];
+        case QRIO_EVEN_BYTES:
+        default:
+            return src[2 * i];
+    }
+}
+
+// Convert one row of the image to grey, taking every nth pixel
+static inline MP_ALWAYSINLINE void fill_row_policy(uint8_t *restrict dest, const uint8_t *restrict src, int count, int n, qrio_pixel_policy_t policy) {
+    if (n == 1) {
+        // Kept separate so that the compiler can vectorise the contiguous case
+        for (int i = 0; i < count; i++) {
+            dest[i] = grey_at(src, i, policy);
+        }
+        return;
+    }
+    for (int i = 0; i < count; i++) {
+        dest[i] = grey_at(src, i * n, policy);
+    }
+}
+
+// Fill all of q's image from the part of the buffer starting at (x, y), taking
+// every nth pixel of every nth row
+static void fill_image(struct quirc *q, const uint8_t *buf, int buf_width, int x, int y, int n, qrio_pixel_policy_t policy) {
     int width, height;
-    uint8_t *framebuffer = quirc_begin(self->quirc, &width, &height);
-    uint8_t *src = buf;
+    uint8_t *image = quirc_begin(q, &width, &height);
+    size_t bytes_per_pixel = policy == QRIO_EVERY_BYTE ? 1 : 2;
+    size_t stride = buf_width * bytes_per_pixel;
+    const uint8_t *src = buf + y * stride + x * bytes_per_pixel;
 
-    switch (policy) {
-        case QRIO_RGB565: {
-            uint16_t *src16 = buf;
-            for (int i = 0; i < width * height; i++) {
-                framebuffer[i] = (src16[i] >> 3) & 0xfc;
-            }
-            break;
+    for (int j = 0; j < height; j++, image += width, src += n * stride) {
+        // Each case gets a copy of the loops specialised to its policy
+        switch (policy) {
+            case QRIO_RGB565:
+                fill_row_policy(image, src, width, n, QRIO_RGB565);
+                break;
+            case QRIO_RGB565_SWAPPED:
+                fill_row_policy(image, src, width, n, QRIO_RGB565_SWAPPED);
+                break;
+            case QRIO_EVERY_BYTE:
+                if (n == 1) {
+                    memcpy(image, src, width);
+                } else {
+                    fill_row_policy(image, src, width, n, QRIO_EVERY_BYTE);
+                }
+                break;
+            case QRIO_ODD_BYTES:
+                fill_row_policy(image, src, width, n, QRIO_ODD_BYTES);
+                break;
+            case QRIO_EVEN_BYTES:
+                fill_row_policy(image, src, width, n, QRIO_EVEN_BYTES);
+                break;
         }
-        case QRIO_RGB565_SWAPPED: {
-            uint16_t *src16 = buf;
-            for (int i = 0; i < width * height; i++) {
-                framebuffer[i] = (__builtin_bswap16(src16[i]) >> 3) & 0xfc;
-            }
-            break;
+    }
+    quirc_end(q);
+}
+
+// Windows are allocated in steps of this many pixels, so a code moving about
+// a little doesn't need a new one every frame
+#define WINDOW_ALIGN (16)
+
+// Look for codes at full resolution in just the part of the image within the
+// given bounds, plus a margin for the quiet zone and for the code moving
+static struct quirc *scan_window(qrdecoder_qrdecoder_obj_t *self, const uint8_t *buf, qrio_pixel_policy_t policy, int x0, int y0, int x1, int y1) {
+    int width = self->width, height = self->height;
+
+    int margin = MAX(x1 - x0, y1 - y0) / 8 + 8;
+    x0 = MAX(0, x0 - margin);
+    y0 = MAX(0, y0 - margin);
+    x1 = MIN(width, x1 + margin);
+    y1 = MIN(height, y1 + margin);
+    int w = MIN(width, (MAX(x1 - x0, 1) + WINDOW_ALIGN - 1) & ~(WINDOW_ALIGN - 1));
+    int h = MIN(height, (MAX(y1 - y0, 1) + WINDOW_ALIGN - 1) & ~(WINDOW_ALIGN - 1));
+
+    // Keep the last window unless it doesn't fit, or is so much bigger that
+    // scanning it would waste most of the saving
+    int window_width = 0, window_height = 0;
+    if (self->window == NULL) {
+        self->window = quirc_new();
+    } else {
+        quirc_begin(self->window, &window_width, &window_height);
+    }
+    if (window_width < w || window_height < h || window_width > width || window_height > height
+        || window_width * window_height > 2 * w * h) {
+        quirc_resize(self->window, w, h);
+        window_width = w;
+        window_height = h;
+    }
+
+    // Centre the window on the bounds, but keep it within the image
+    self->window_x = MIN(MAX(0, (x0 + x1 - window_width) / 2), width - window_width);
+    self->window_y = MIN(MAX(0, (y0 + y1 - window_height) / 2), height - window_height);
+    fill_image(self->window, buf, width, self->window_x, self->window_y, 1, policy);
+    return self->window;
+}
+
+// Find the codes in the image, and return the quirc holding them. (*x, *y) is
+// where that quirc's image lies within the whole image.
+// Resize q unless it is already the given size
+static void fit(struct quirc *q, int width, int height) {
+    int q_width, q_height;
+    quirc_begin(q, &q_width, &q_height);
+    if (q_width != width || q_height != height) {
+        quirc_resize(q, width, height);
+    }
+}
+
+// Find the codes in the image, and return the quirc holding them. (*x, *y) is
+// where that quirc's image lies within the whole image.
+static struct quirc *find_codes(qrdecoder_qrdecoder_obj_t *self, const uint8_t *buf, qrio_pixel_policy_t policy, int subsample, bool track, int *x, int *y) {
+    int width = self->width, height = self->height;
+
+    if (track && self->have_track) {
+        struct quirc *q = scan_window(self, buf, policy, self->track_x0, self->track_y0, self->track_x1, self->track_y1);
+        if (quirc_count(q) > 0) {
+            *x = self->window_x;
+            *y = self->window_y;
+            return q;
         }
-        case QRIO_EVERY_BYTE:
-            memcpy(framebuffer, src, width * height);
-            break;
+    }
 
-        case QRIO_ODD_BYTES:
-            src++;
-            MP_FALLTHROUGH;
+    if (subsample > 1 && width >= subsample && height >= subsample) {
+        // Find candidates in a shrunk copy of the image, then look again at
+        // full resolution in just the region around them. The whole image is
+        // never needed at full resolution here, so the shrunk copy takes its
+        // place, and it stays that size while calls keep subsampling.
+        fit(self->quirc, width / subsample, height / subsample);
+        fill_image(self->quirc, buf, width, 0, 0, subsample, policy);
 
-        case QRIO_EVEN_BYTES:
-            for (int i = 0; i < width * height; i++) {
-                framebuffer[i] = src[2 * i];
+        int count = quirc_count(self->quirc);
+        if (count == 0) {
+            *x = *y = 0;
+            return self->quirc;
+        }
+        int x0 = INT_MAX, y0 = INT_MAX, x1 = INT_MIN, y1 = INT_MIN;
+        for (int i = 0; i < count; i++) {
+            quirc_extract(self->quirc, i, &self->code);
+            for (int j = 0; j < 4; j++) {
+                x0 = MIN(x0, self->code.corners[j].x);
+                y0 = MIN(y0, self->code.corners[j].y);
+                x1 = MAX(x1, self->code.corners[j].x + 1);
+                y1 = MAX(y1, self->code.corners[j].y + 1);
             }
-            break;
+        }
+        struct quirc *q = scan_window(self, buf, policy, x0 * subsample, y0 * subsample, x1 * subsample, y1 * subsample);
+        *x = self->window_x;
+        *y = self->window_y;
+        return q;
+    }
+
+    fit(self->quirc, width, height);
+    fill_image(self->quirc, buf, width, 0, 0, 1, policy);
+    *x = *y = 0;
+    return self->quirc;
+}
+
+// Extract a code found by find_codes, move its corners into the whole image's
+// coordinates, and take it into account for tracking
+static void extract_code(qrdecoder_qrdecoder_obj_t *self, struct quirc *q, int index, int x, int y) {
+    quirc_extract(q, index, &self->code);
+    for (int i = 0; i < 4; i++) {
+        struct quirc_point *corner = &self->code.corners[i];
+        corner->x += x;
+        corner->y += y;
+        if (!self->have_track) {
+            self->track_x0 = self->track_x1 = corner->x;
+            self->track_y0 = self->track_y1 = corner->y;
+            self->have_track = true;
+        }
+        self->track_x0 = MIN(self->track_x0, corner->x);
+        self->track_y0 = MIN(self->track_y0, corner->y);
+        self->track_x1 = MAX(self->track_x1, corner->x + 1);
+        self->track_y1 = MAX(self->track_y1, corner->y + 1);
     }
-    quirc_end(self->quirc);
 }
 
 
-mp_obj_t shared_module_qrio_qrdecoder_decode(qrdecoder_qrdecoder_obj_t *self, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy) {
-    quirc_fill_buffer(self, bufinfo->buf, policy);
-    int count = quirc_count(self->quirc);
+mp_obj_t shared_module_qrio_qrdecoder_decode(qrdecoder_qrdecoder_obj_t *self, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy, int subsample, bool track) {
+    int x, y;
+    struct quirc *q = find_codes(self, bufinfo->buf, policy, subsample, track, &x, &y);
+    int count = quirc_count(q);
     mp_obj_t result = mp_obj_new_list(0, NULL);
+    self->have_track = false;
     for (int i = 0; i < count; i++) {
-        quirc_extract(self->quirc, i, &self->code);
+        extract_code(self, q, i, x, y);
         mp_obj_t code_obj;
         if (quirc_decode(&self->code, &self->data) != QUIRC_SUCCESS) {
             continue;
@@ -137,12 +290,14 @@ mp_obj_t shared_module_qrio_qrdecoder_decode(qrdecoder_qrdecoder_obj_t *self, co
 }
 
 
-mp_obj_t shared_module_qrio_qrdecoder_find(qrdecoder_qrdecoder_obj_t *self, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy) {
-    quirc_fill_buffer(self, bufinfo->buf, policy);
-    int count = quirc_count(self->quirc);
+mp_obj_t shared_module_qrio_qrdecoder_find(qrdecoder_qrdecoder_obj_t *self, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy, int subsample, bool track) {
+    int x, y;
+    struct quirc *q = find_codes(self, bufinfo->buf, policy, subsample, track, &x, &y);
+    int count = quirc_count(q);
     mp_obj_t result = mp_obj_new_list(0, NULL);
+    self->have_track = false;
     for (int i = 0; i < count; i++) {
-        quirc_extract(self->quirc, i, &self->code);
+        extract_code(self, q, i, x, y);
         mp_obj_t code_obj;
         mp_obj_t elems[9] = {
             mp_obj_new_int(self->code.corners[0].x),
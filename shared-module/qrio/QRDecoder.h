@@ -12,7 +12,15 @@
 
 typedef struct qrio_qrdecoder_obj {
     mp_obj_base_t base;
+    int width, height;
+    // The whole image, at full resolution or shrunk by `subsample`
     struct quirc *quirc;
+    // A full resolution region of the image, allocated when first needed
+    struct quirc *window;
+    int window_x, window_y;
+    // Bounds of the codes found last time, for tracking
+    int track_x0, track_y0, track_x1, track_y1;
+    bool have_track;
     struct quirc_code code;
     struct quirc_data data;
 } qrdecoder_qrdecoder_obj_t;
@@ -22,5 +30,5 @@ int shared_module_qrio_qrdecoder_get_height(qrdecoder_qrdecoder_obj_t *);
 int shared_module_qrio_qrdecoder_get_width(qrdecoder_qrdecoder_obj_t *);
 void shared_module_qrio_qrdecoder_set_height(qrdecoder_qrdecoder_obj_t *, int height);
 void shared_module_qrio_qrdecoder_set_width(qrdecoder_qrdecoder_obj_t *, int width);
-mp_obj_t shared_module_qrio_qrdecoder_decode(qrdecoder_qrdecoder_obj_t *, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy);
-mp_obj_t shared_module_qrio_qrdecoder_find(qrdecoder_qrdecoder_obj_t *, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy);
+mp_obj_t shared_module_qrio_qrdecoder_decode(qrdecoder_qrdecoder_obj_t *, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy, int subsample, bool track);
+mp_obj_t shared_module_qrio_qrdecoder_find(qrdecoder_qrdecoder_obj_t *, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy, int subsample, bool track);
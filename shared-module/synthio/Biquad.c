@@ -5,117 +5,217 @@
 // SPDX-License-Identifier: MIT
 
 #include <math.h>
+#include <string.h>
 #include "shared-bindings/synthio/Biquad.h"
 #include "shared-module/synthio/Biquad.h"
+#include "shared-module/synthio/__init__.h"
+
+// sin(x) over a quarter wave, x = i * pi / 512
+#define SINE_TABLE_SIZE (256)
+static const float quarter_sine[SINE_TABLE_SIZE + 1] = {
+    0.f, 0.00613588465f, 0.0122715383f, 0.0184067299f, 0.0245412285f, 0.0306748032f, 0.0368072229f, 0.0429382569f,
+    0.0490676743f, 0.0551952443f, 0.0613207363f, 0.0674439196f, 0.0735645636f, 0.079682438f, 0.0857973123f, 0.0919089565f,
+    0.0980171403f, 0.104121634f, 0.110222207f, 0.116318631f, 0.122410675f, 0.128498111f, 0.134580709f, 0.140658239f,
+    0.146730474f, 0.152797185f, 0.158858143f, 0.16491312f, 0.170961889f, 0.17700422f, 0.183039888f, 0.189068664f,
+    0.195090322f, 0.201104635f, 0.207111376f, 0.21311032f, 0.21910124f, 0.225083911f, 0.231058108f, 0.237023606f,
+    0.24298018f, 0.248927606f, 0.25486566f, 0.260794118f, 0.266712757f, 0.272621355f, 0.278519689f, 0.284407537f,
+    0.290284677f, 0.296150888f, 0.302005949f, 0.30784964f, 0.31368174f, 0.319502031f, 0.325310292f, 0.331106306f,
+    0.336889853f, 0.342660717f, 0.34841868f, 0.354163525f, 0.359895037f, 0.365612998f, 0.371317194f, 0.37700741f,
+    0.382683432f, 0.388345047f, 0.39399204f, 0.3996242f, 0.405241314f, 0.410843171f, 0.41642956f, 0.422000271f,
+    0.427555093f, 0.433093819f, 0.438616239f, 0.444122145f, 0.44961133f, 0.455083587f, 0.460538711f, 0.465976496f,
+    0.471396737f, 0.47679923f, 0.482183772f, 0.48755016f, 0.492898192f, 0.498227667f, 0.503538384f, 0.508830143f,
+    0.514102744f, 0.51935599f, 0.524589683f, 0.529803625f, 0.53499762f, 0.540171473f, 0.545324988f, 0.550457973f,
+    0.555570233f, 0.560661576f, 0.565731811f, 0.570780746f, 0.575808191f, 0.580813958f, 0.585797857f, 0.590759702f,
+    0.595699304f, 0.600616479f, 0.605511041f, 0.610382806f, 0.615231591f, 0.620057212f, 0.624859488f, 0.629638239f,
+    0.634393284f, 0.639124445f, 0.643831543f, 0.648514401f, 0.653172843f, 0.657806693f, 0.662415778f, 0.666999922f,
+    0.671558955f, 0.676092704f, 0.680600998f, 0.685083668f, 0.689540545f, 0.693971461f, 0.698376249f, 0.702754744f,
+    0.707106781f, 0.711432196f, 0.715730825f, 0.720002508f, 0.724247083f, 0.72846439f, 0.732654272f, 0.736816569f,
+    0.740951125f, 0.745057785f, 0.749136395f, 0.753186799f, 0.757208847f, 0.761202385f, 0.765167266f, 0.769103338f,
+    0.773010453f, 0.776888466f, 0.780737229f, 0.784556597f, 0.788346428f, 0.792106577f, 0.795836905f, 0.799537269f,
+    0.803207531f, 0.806847554f, 0.810457198f, 0.81403633f, 0.817584813f, 0.821102515f, 0.824589303f, 0.828045045f,
+    0.831469612f, 0.834862875f, 0.838224706f, 0.841554977f, 0.844853565f, 0.848120345f, 0.851355193f, 0.854557988f,
+    0.85772861f, 0.860866939f, 0.863972856f, 0.867046246f, 0.870086991f, 0.873094978f, 0.876070094f, 0.879012226f,
+    0.881921264f, 0.884797098f, 0.88763962f, 0.890448723f, 0.893224301f, 0.89596625f, 0.898674466f, 0.901348847f,
+    0.903989293f, 0.906595705f, 0.909167983f, 0.911706032f, 0.914209756f, 0.91667906f, 0.919113852f, 0.921514039f,
+    0.923879533f, 0.926210242f, 0.92850608f, 0.930766961f, 0.932992799f, 0.93518351f, 0.937339012f, 0.939459224f,
+    0.941544065f, 0.943593458f, 0.945607325f, 0.947585591f, 0.949528181f, 0.951435021f, 0.95330604f, 0.955141168f,
+    0.956940336f, 0.958703475f, 0.960430519f, 0.962121404f, 0.963776066f, 0.965394442f, 0.966976471f, 0.968522094f,
+    0.970031253f, 0.971503891f, 0.972939952f, 0.974339383f, 0.97570213f, 0.977028143f, 0.978317371f, 0.979569766f,
+    0.98078528f, 0.981963869f, 0.983105487f, 0.984210092f, 0.985277642f, 0.986308097f, 0.987301418f, 0.988257568f,
+    0.98917651f, 0.99005821f, 0.990902635f, 0.991709754f, 0.992479535f, 0.993211949f, 0.99390697f, 0.994564571f,
+    0.995184727f, 0.995767414f, 0.996312612f, 0.996820299f, 0.997290457f, 0.997723067f, 0.998118113f, 0.998475581f,
+    0.998795456f, 0.999077728f, 0.999322385f, 0.999529418f, 0.999698819f, 0.999830582f, 0.999924702f, 0.999981175f,
+    1.f,
+};
+
+// sin(x) for 0 <= x <= pi, linearly interpolated from the table. The relative error is
+// under 5 parts per million, well below the resolution of the fixed point coefficients.
+static mp_float_t table_sin(mp_float_t x) {
+    if (x > MP_PI / 2) {
+        x = MP_PI - x;
+    }
+    mp_float_t position = x * (2 * SINE_TABLE_SIZE / MP_PI);
+    if (position <= 0) {
+        return 0;
+    }
+    size_t i = (size_t)position;
+    if (i >= SINE_TABLE_SIZE) {
+        return 1;
+    }
+    mp_float_t frac = position - i;
+    mp_float_t lo = quarter_sine[i], hi = quarter_sine[i + 1];
+    return lo + frac * (hi - lo);
+}
 
-mp_obj_t common_hal_synthio_new_lpf(mp_float_t w0, mp_float_t Q) {
-    mp_float_t s = MICROPY_FLOAT_C_FUN(sin)(w0);
-    mp_float_t c = MICROPY_FLOAT_C_FUN(cos)(w0);
+void synthio_biquad_compute(synthio_filter_mode_t mode, mp_float_t w0, mp_float_t Q, mp_float_t coefficients[5]) {
+    w0 = MIN(MAX(w0, 0), MP_PI);
+    mp_float_t s = table_sin(w0);
+    // 1 - cos(w0), from the half angle so that it stays accurate at low cutoffs
+    mp_float_t h = table_sin(w0 / 2);
+    mp_float_t one_minus_c = 2 * h * h;
     mp_float_t alpha = s / (2 * Q);
     mp_float_t a0 = 1 + alpha;
-    mp_float_t a1 = -2 * c;
+    mp_float_t a1 = -2 * (1 - one_minus_c);
     mp_float_t a2 = 1 - alpha;
-    mp_float_t b0 = (1 - c) / 2;
-    mp_float_t b1 = 1 - c;
-    mp_float_t b2 = (1 - c) / 2;
-
-    mp_obj_t out_args[] = {
-        mp_obj_new_float(a1 / a0),
-        mp_obj_new_float(a2 / a0),
-        mp_obj_new_float(b0 / a0),
-        mp_obj_new_float(b1 / a0),
-        mp_obj_new_float(b2 / a0),
-    };
+    mp_float_t b0, b1, b2;
+    switch (mode) {
+        default:
+        case SYNTHIO_LOW_PASS:
+            b0 = one_minus_c / 2;
+            b1 = one_minus_c;
+            b2 = one_minus_c / 2;
+            break;
+        case SYNTHIO_HIGH_PASS:
+            b0 = (2 - one_minus_c) / 2;
+            b1 = -(2 - one_minus_c);
+            b2 = (2 - one_minus_c) / 2;
+            break;
+        case SYNTHIO_BAND_PASS:
+            b0 = alpha;
+            b1 = 0;
+            b2 = -alpha;
+            break;
+    }
 
-    return namedtuple_make_new((const mp_obj_type_t *)&synthio_biquad_type_obj, MP_ARRAY_SIZE(out_args), 0, out_args);
+    coefficients[0] = a1 / a0;
+    coefficients[1] = a2 / a0;
+    coefficients[2] = b0 / a0;
+    coefficients[3] = b1 / a0;
+    coefficients[4] = b2 / a0;
 }
 
-mp_obj_t common_hal_synthio_new_hpf(mp_float_t w0, mp_float_t Q) {
-    mp_float_t s = MICROPY_FLOAT_C_FUN(sin)(w0);
-    mp_float_t c = MICROPY_FLOAT_C_FUN(cos)(w0);
-    mp_float_t alpha = s / (2 * Q);
-    mp_float_t a0 = 1 + alpha;
-    mp_float_t a1 = -2 * c;
-    mp_float_t a2 = 1 - alpha;
-    mp_float_t b0 = (1 + c) / 2;
-    mp_float_t b1 = -(1 + c);
-    mp_float_t b2 = (1 + c) / 2;
+static mp_obj_t new_biquad(synthio_filter_mode_t mode, mp_float_t w0, mp_float_t Q) {
+    mp_float_t coefficients[5];
+    synthio_biquad_compute(mode, w0, Q, coefficients);
 
     mp_obj_t out_args[] = {
-        mp_obj_new_float(a1 / a0),
-        mp_obj_new_float(a2 / a0),
-        mp_obj_new_float(b0 / a0),
-        mp_obj_new_float(b1 / a0),
-        mp_obj_new_float(b2 / a0),
+        mp_obj_new_float(coefficients[0]),
+        mp_obj_new_float(coefficients[1]),
+        mp_obj_new_float(coefficients[2]),
+        mp_obj_new_float(coefficients[3]),
+        mp_obj_new_float(coefficients[4]),
     };
 
     return namedtuple_make_new((const mp_obj_type_t *)&synthio_biquad_type_obj, MP_ARRAY_SIZE(out_args), 0, out_args);
 }
 
-mp_obj_t common_hal_synthio_new_bpf(mp_float_t w0, mp_float_t Q) {
-    mp_float_t s = MICROPY_FLOAT_C_FUN(sin)(w0);
-    mp_float_t c = MICROPY_FLOAT_C_FUN(cos)(w0);
-    mp_float_t alpha = s / (2 * Q);
-    mp_float_t a0 = 1 + alpha;
-    mp_float_t a1 = -2 * c;
-    mp_float_t a2 = 1 - alpha;
-    mp_float_t b0 = alpha;
-    mp_float_t b1 = 0;
-    mp_float_t b2 = -alpha;
+mp_obj_t common_hal_synthio_new_lpf(mp_float_t w0, mp_float_t Q) {
+    return new_biquad(SYNTHIO_LOW_PASS, w0, Q);
+}
 
-    mp_obj_t out_args[] = {
-        mp_obj_new_float(a1 / a0),
-        mp_obj_new_float(a2 / a0),
-        mp_obj_new_float(b0 / a0),
-        mp_obj_new_float(b1 / a0),
-        mp_obj_new_float(b2 / a0),
-    };
+mp_obj_t common_hal_synthio_new_hpf(mp_float_t w0, mp_float_t Q) {
+    return new_biquad(SYNTHIO_HIGH_PASS, w0, Q);
+}
 
-    return namedtuple_make_new((const mp_obj_type_t *)&synthio_biquad_type_obj, MP_ARRAY_SIZE(out_args), 0, out_args);
+mp_obj_t common_hal_synthio_new_bpf(mp_float_t w0, mp_float_t Q) {
+    return new_biquad(SYNTHIO_BAND_PASS, w0, Q);
 }
 
 #define BIQUAD_SHIFT (15)
-static int32_t biquad_scale_arg_obj(mp_obj_t arg) {
-    return (int32_t)MICROPY_FLOAT_C_FUN(round)(MICROPY_FLOAT_C_FUN(ldexp)(mp_obj_get_float(arg), BIQUAD_SHIFT));
+int32_t synthio_biquad_scale(mp_float_t coefficient) {
+    return (int32_t)MICROPY_FLOAT_C_FUN(round)(MICROPY_FLOAT_C_FUN(ldexp)(coefficient, BIQUAD_SHIFT));
 }
-void synthio_biquad_filter_assign(biquad_filter_state *st, mp_obj_t biquad_obj) {
+
+void synthio_biquad_filter_assign(biquad_filter_coefficients *c, mp_obj_t biquad_obj) {
     if (biquad_obj != mp_const_none) {
         mp_arg_validate_type(biquad_obj, (const mp_obj_type_t *)&synthio_biquad_type_obj, MP_QSTR_filter);
         mp_obj_tuple_t *biquad = (mp_obj_tuple_t *)MP_OBJ_TO_PTR(biquad_obj);
-        st->a1 = biquad_scale_arg_obj(biquad->items[0]);
-        st->a2 = biquad_scale_arg_obj(biquad->items[1]);
-        st->b0 = biquad_scale_arg_obj(biquad->items[2]);
-        st->b1 = biquad_scale_arg_obj(biquad->items[3]);
-        st->b2 = biquad_scale_arg_obj(biquad->items[4]);
+        c->a1 = synthio_biquad_scale(mp_obj_get_float(biquad->items[0]));
+        c->a2 = synthio_biquad_scale(mp_obj_get_float(biquad->items[1]));
+        c->b0 = synthio_biquad_scale(mp_obj_get_float(biquad->items[2]));
+        c->b1 = synthio_biquad_scale(mp_obj_get_float(biquad->items[3]));
+        c->b2 = synthio_biquad_scale(mp_obj_get_float(biquad->items[4]));
     }
 }
 
 void synthio_biquad_filter_reset(biquad_filter_state *st) {
-    memset(&st->x, 0, 4 * sizeof(int16_t));
+    memset(&st->x, 0, 2 * sizeof(int32_t));
+    memset(&st->y, 0, 2 * sizeof(int32_t));
+    st->started = false;
 }
 
-void synthio_biquad_filter_samples(biquad_filter_state *st, int32_t *buffer, size_t n_samples) {
-    int32_t a1 = st->a1;
-    int32_t a2 = st->a2;
-    int32_t b0 = st->b0;
-    int32_t b1 = st->b1;
-    int32_t b2 = st->b2;
+// Coefficients ramp with RAMP_SHIFT extra fractional bits, so that a change spread over a
+// whole block doesn't round away.
+#define RAMP_SHIFT (8)
+
+void synthio_biquad_filter_samples(biquad_filter_state *st, const biquad_filter_coefficients *target, int32_t *buffer, size_t n_samples) {
+    if (!st->started) {
+        st->coefficients = *target;
+        st->started = true;
+    }
 
     int32_t x0 = st->x[0];
     int32_t x1 = st->x[1];
     int32_t y0 = st->y[0];
     int32_t y1 = st->y[1];
 
-    for (size_t n = n_samples; n; --n, ++buffer) {
-        int32_t input = *buffer;
-        int32_t output = (b0 * input + b1 * x0 + b2 * x1 - a1 * y0 - a2 * y1 + (1 << (BIQUAD_SHIFT - 1))) >> BIQUAD_SHIFT;
-
-        x1 = x0;
-        x0 = input;
-        y1 = y0;
-        y0 = output;
-        *buffer = output;
+    if (memcmp(&st->coefficients, target, sizeof(*target)) == 0 || n_samples == 0) {
+        int32_t a1 = target->a1;
+        int32_t a2 = target->a2;
+        int32_t b0 = target->b0;
+        int32_t b1 = target->b1;
+        int32_t b2 = target->b2;
+
+        for (size_t n = n_samples; n; --n, ++buffer) {
+            int32_t input = *buffer;
+            int32_t output = (b0 * input + b1 * x0 + b2 * x1 - a1 * y0 - a2 * y1 + (1 << (BIQUAD_SHIFT - 1))) >> BIQUAD_SHIFT;
+
+            x1 = x0;
+            x0 = input;
+            y1 = y0;
+            y0 = output;
+            *buffer = output;
+        }
+    } else {
+        // The coefficients changed since the last block: move to the new ones a step per
+        // sample instead of all at once, which would be heard as zipper noise.
+        const biquad_filter_coefficients *from = &st->coefficients;
+        int32_t steps = n_samples;
+        int32_t a1 = from->a1 << RAMP_SHIFT, da1 = ((target->a1 - from->a1) << RAMP_SHIFT) / steps;
+        int32_t a2 = from->a2 << RAMP_SHIFT, da2 = ((target->a2 - from->a2) << RAMP_SHIFT) / steps;
+        int32_t b0 = from->b0 << RAMP_SHIFT, db0 = ((target->b0 - from->b0) << RAMP_SHIFT) / steps;
+        int32_t b1 = from->b1 << RAMP_SHIFT, db1 = ((target->b1 - from->b1) << RAMP_SHIFT) / steps;
+        int32_t b2 = from->b2 << RAMP_SHIFT, db2 = ((target->b2 - from->b2) << RAMP_SHIFT) / steps;
+
+        for (size_t n = n_samples; n; --n, ++buffer) {
+            a1 += da1;
+            a2 += da2;
+            b0 += db0;
+            b1 += db1;
+            b2 += db2;
+            int32_t input = *buffer;
+            int32_t output = ((b0 >> RAMP_SHIFT) * input + (b1 >> RAMP_SHIFT) * x0 + (b2 >> RAMP_SHIFT) * x1
+                - (a1 >> RAMP_SHIFT) * y0 - (a2 >> RAMP_SHIFT) * y1 + (1 << (BIQUAD_SHIFT - 1))) >> BIQUAD_SHIFT;
+
+            x1 = x0;
+            x0 = input;
+            y1 = y0;
+            y0 = output;
+            *buffer = output;
+        }
+        st->coefficients = *target;
     }
+
     st->x[0] = x0;
     st->x[1] = x1;
     st->y[0] = y0;
@@ -7,12 +7,21 @@
 #pragma once
 
 #include "py/obj.h"
+#include "shared-bindings/synthio/BlockBiquad.h"
 
 typedef struct {
     int32_t a1, a2, b0, b1, b2;
+} biquad_filter_coefficients;
+
+typedef struct {
+    // The coefficients at the end of the last block; a change is ramped in over the next one
+    biquad_filter_coefficients coefficients;
     int32_t x[2], y[2];
+    bool started;
 } biquad_filter_state;
 
-void synthio_biquad_filter_assign(biquad_filter_state *st, mp_obj_t biquad_obj);
+void synthio_biquad_compute(synthio_filter_mode_t mode, mp_float_t w0, mp_float_t Q, mp_float_t coefficients[5]);
+int32_t synthio_biquad_scale(mp_float_t coefficient);
+void synthio_biquad_filter_assign(biquad_filter_coefficients *c, mp_obj_t biquad_obj);
 void synthio_biquad_filter_reset(biquad_filter_state *st);
-void synthio_biquad_filter_samples(biquad_filter_state *st, int32_t *buffer, size_t n_samples);
+void synthio_biquad_filter_samples(biquad_filter_state *st, const biquad_filter_coefficients *target, int32_t *buffer, size_t n_samples);
@@ -0,0 +1,62 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-bindings/synthio/BlockBiquad.h"
+#include "shared-module/synthio/BlockBiquad.h"
+#include "shared-module/synthio/__init__.h"
+
+void common_hal_synthio_block_biquad_construct(synthio_block_biquad_t *self, synthio_filter_mode_t mode, mp_obj_t frequency, mp_obj_t Q) {
+    self->mode = mode;
+    synthio_block_assign_slot(frequency, &self->frequency, MP_QSTR_frequency);
+    synthio_block_assign_slot(Q, &self->Q, MP_QSTR_Q);
+    // Force the first tick to compute the coefficients
+    self->sample_rate = 0;
+}
+
+synthio_filter_mode_t common_hal_synthio_block_biquad_get_mode(synthio_block_biquad_t *self) {
+    return self->mode;
+}
+
+mp_obj_t common_hal_synthio_block_biquad_get_frequency(synthio_block_biquad_t *self) {
+    return self->frequency.obj;
+}
+
+void common_hal_synthio_block_biquad_set_frequency(synthio_block_biquad_t *self, mp_obj_t frequency) {
+    synthio_block_assign_slot(frequency, &self->frequency, MP_QSTR_frequency);
+}
+
+mp_obj_t common_hal_synthio_block_biquad_get_Q(synthio_block_biquad_t *self) {
+    return self->Q.obj;
+}
+
+void common_hal_synthio_block_biquad_set_Q(synthio_block_biquad_t *self, mp_obj_t Q) {
+    synthio_block_assign_slot(Q, &self->Q, MP_QSTR_Q);
+}
+
+const biquad_filter_coefficients *synthio_block_biquad_tick(synthio_block_biquad_t *self, int32_t sample_rate) {
+    if (self->sample_rate == sample_rate && self->last_tick == synthio_global_tick) {
+        return &self->coefficients;
+    }
+    self->last_tick = synthio_global_tick;
+
+    mp_float_t frequency = synthio_block_slot_get_limited(&self->frequency, MICROPY_FLOAT_CONST(0.), sample_rate / 2);
+    mp_float_t Q = synthio_block_slot_get_limited(&self->Q, MICROPY_FLOAT_CONST(0.01), MICROPY_FLOAT_CONST(100.));
+    if (self->sample_rate == sample_rate && frequency == self->last_frequency && Q == self->last_Q) {
+        return &self->coefficients;
+    }
+    self->sample_rate = sample_rate;
+    self->last_frequency = frequency;
+    self->last_Q = Q;
+
+    mp_float_t coefficients[5];
+    synthio_biquad_compute(self->mode, frequency / sample_rate * 2 * MP_PI, Q, coefficients);
+    self->coefficients.a1 = synthio_biquad_scale(coefficients[0]);
+    self->coefficients.a2 = synthio_biquad_scale(coefficients[1]);
+    self->coefficients.b0 = synthio_biquad_scale(coefficients[2]);
+    self->coefficients.b1 = synthio_biquad_scale(coefficients[3]);
+    self->coefficients.b2 = synthio_biquad_scale(coefficients[4]);
+    return &self->coefficients;
+}
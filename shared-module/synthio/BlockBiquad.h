@@ -0,0 +1,27 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-bindings/synthio/BlockBiquad.h"
+#include "shared-module/synthio/Biquad.h"
+#include "shared-module/synthio/block.h"
+
+typedef struct synthio_block_biquad {
+    mp_obj_base_t base;
+    synthio_filter_mode_t mode;
+    synthio_block_slot_t frequency, Q;
+
+    // The inputs the coefficients were last computed from, so that they are only
+    // recomputed when something actually moved
+    uint8_t last_tick;
+    int32_t sample_rate;
+    mp_float_t last_frequency, last_Q;
+    biquad_filter_coefficients coefficients;
+} synthio_block_biquad_t;
+
+// Update the inputs once per synthesizer tick and return the coefficients for this block
+const biquad_filter_coefficients *synthio_block_biquad_tick(synthio_block_biquad_t *self, int32_t sample_rate);
@@ -102,7 +102,8 @@ void common_hal_synthio_miditrack_construct(synthio_miditrack_obj_t *self,
     self->track.buf = (void *)buffer;
     self->track.len = len;
 
-    synthio_synth_init(&self->synth, sample_rate, 1, waveform_obj, envelope_obj);
+    synthio_synth_init(&self->synth, sample_rate, 1, waveform_obj, envelope_obj,
+        CIRCUITPY_SYNTHIO_MAX_CHANNELS, SYNTHIO_VOICE_STEALING_NONE);
 
     start_parse(self);
 }
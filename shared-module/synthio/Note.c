@@ -25,7 +25,9 @@ mp_obj_t common_hal_synthio_note_get_filter_obj(synthio_note_obj_t *self) {
 }
 
 void common_hal_synthio_note_set_filter(synthio_note_obj_t *self, mp_obj_t filter_in) {
-    synthio_biquad_filter_assign(&self->filter_state, filter_in);
+    if (!mp_obj_is_type(filter_in, &synthio_block_biquad_type)) {
+        synthio_biquad_filter_assign(&self->filter_coefficients, filter_in);
+    }
     self->filter_obj = filter_in;
 }
 
@@ -20,6 +20,7 @@ typedef struct synthio_note_obj {
     mp_obj_t waveform_obj, envelope_obj, ring_waveform_obj;
     mp_obj_t filter_obj;
 
+    biquad_filter_coefficients filter_coefficients;
     biquad_filter_state filter_state;
 
     int32_t sample_rate;
@@ -32,6 +33,8 @@ typedef struct synthio_note_obj {
     mp_buffer_info_t ring_waveform_buf;
     uint32_t ring_waveform_loop_start, ring_waveform_loop_end;
     synthio_envelope_definition_t envelope_def;
+    // The voice that last played this note; only a hint, as the note may be in several synthesizers
+    uint8_t voice;
 } synthio_note_obj_t;
 
 void synthio_note_recalculate(synthio_note_obj_t *self, int32_t sample_rate);
@@ -14,9 +14,9 @@
 
 void common_hal_synthio_synthesizer_construct(synthio_synthesizer_obj_t *self,
     uint32_t sample_rate, int channel_count, mp_obj_t waveform_obj,
-    mp_obj_t envelope_obj) {
+    mp_obj_t envelope_obj, int polyphony, synthio_voice_stealing_t voice_stealing) {
 
-    synthio_synth_init(&self->synth, sample_rate, channel_count, waveform_obj, envelope_obj);
+    synthio_synth_init(&self->synth, sample_rate, channel_count, waveform_obj, envelope_obj, polyphony, voice_stealing);
     self->blocks = mp_obj_new_list(0, NULL);
 }
 
@@ -73,7 +73,7 @@ void synthio_synthesizer_get_buffer_structure(synthio_synthesizer_obj_t *self, b
 }
 
 void common_hal_synthio_synthesizer_release_all(synthio_synthesizer_obj_t *self) {
-    for (size_t i = 0; i < CIRCUITPY_SYNTHIO_MAX_CHANNELS; i++) {
+    for (size_t i = 0; i < self->synth.voice_count; i++) {
         if (self->synth.span.note_obj[i] != SYNTHIO_SILENCE) {
             synthio_span_change_note(&self->synth, self->synth.span.note_obj[i], SYNTHIO_SILENCE);
         }
@@ -151,13 +151,13 @@ void common_hal_synthio_synthesizer_retrigger(synthio_synthesizer_obj_t *self, m
 
 mp_obj_t common_hal_synthio_synthesizer_get_pressed_notes(synthio_synthesizer_obj_t *self) {
     int count = 0;
-    for (int chan = 0; chan < CIRCUITPY_SYNTHIO_MAX_CHANNELS; chan++) {
+    for (int chan = 0; chan < self->synth.voice_count; chan++) {
         if (self->synth.span.note_obj[chan] != SYNTHIO_SILENCE && SYNTHIO_NOTE_IS_PLAYING(&self->synth, chan)) {
             count += 1;
         }
     }
     mp_obj_tuple_t *result = MP_OBJ_TO_PTR(mp_obj_new_tuple(count, NULL));
-    for (size_t chan = 0, j = 0; chan < CIRCUITPY_SYNTHIO_MAX_CHANNELS; chan++) {
+    for (size_t chan = 0, j = 0; chan < self->synth.voice_count; chan++) {
         if (self->synth.span.note_obj[chan] != SYNTHIO_SILENCE && SYNTHIO_NOTE_IS_PLAYING(&self->synth, chan)) {
             result->items[j++] = self->synth.span.note_obj[chan];
         }
@@ -166,16 +166,27 @@ mp_obj_t common_hal_synthio_synthesizer_get_pressed_notes(synthio_synthesizer_ob
 }
 
 envelope_state_e common_hal_synthio_synthesizer_note_info(synthio_synthesizer_obj_t *self, mp_obj_t note, mp_float_t *vol_out) {
-    for (int chan = 0; chan < CIRCUITPY_SYNTHIO_MAX_CHANNELS; chan++) {
-        if (self->synth.span.note_obj[chan] == note) {
-            *vol_out = self->synth.envelope_state[chan].level / 32767.;
-            return self->synth.envelope_state[chan].state;
-        }
+    int chan = synthio_synth_find_voice(&self->synth, note);
+    if (chan == -1) {
+        return (envelope_state_e) - 1;
     }
-    return (envelope_state_e) - 1;
+    *vol_out = self->synth.envelope_state[chan].level / 32767.;
+    return self->synth.envelope_state[chan].state;
 }
 
 
 mp_obj_t common_hal_synthio_synthesizer_get_blocks(synthio_synthesizer_obj_t *self) {
     return self->blocks;
 }
+
+mp_int_t common_hal_synthio_synthesizer_get_polyphony(synthio_synthesizer_obj_t *self) {
+    return self->synth.voice_count;
+}
+
+synthio_voice_stealing_t common_hal_synthio_synthesizer_get_voice_stealing(synthio_synthesizer_obj_t *self) {
+    return self->synth.voice_stealing;
+}
+
+void common_hal_synthio_synthesizer_set_voice_stealing(synthio_synthesizer_obj_t *self, synthio_voice_stealing_t voice_stealing) {
+    self->synth.voice_stealing = voice_stealing;
+}
@@ -0,0 +1,204 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <math.h>
+#include <string.h>
+
+#include "py/runtime.h"
+#include "shared-module/synthio/__init__.h"
+#include "shared-module/synthio/Wavetable.h"
+
+// In-place radix-2 FFT; n must be a power of two. sign is -1 for the forward transform and
+// 1 for the inverse, which is not normalized.
+static void fft(mp_float_t *re, mp_float_t *im, size_t n, int sign) {
+    for (size_t i = 1, j = 0; i < n; i++) {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j) {
+            mp_float_t t = re[i];
+            re[i] = re[j];
+            re[j] = t;
+            t = im[i];
+            im[i] = im[j];
+            im[j] = t;
+        }
+    }
+    for (size_t len = 2; len <= n; len <<= 1) {
+        size_t half = len / 2;
+        mp_float_t theta = sign * 2 * MP_PI / len;
+        for (size_t k = 0; k < half; k++) {
+            mp_float_t wr = MICROPY_FLOAT_C_FUN(cos)(theta * k);
+            mp_float_t wi = MICROPY_FLOAT_C_FUN(sin)(theta * k);
+            for (size_t i = k; i < n; i += len) {
+                size_t j = i + half;
+                mp_float_t tr = re[j] * wr - im[j] * wi;
+                mp_float_t ti = re[j] * wi + im[j] * wr;
+                re[j] = re[i] - tr;
+                im[j] = im[i] - ti;
+                re[i] += tr;
+                im[i] += ti;
+            }
+        }
+    }
+}
+
+// Make one cycle of the level from the first max_harmonic harmonics of the spectrum, and
+// return its peak
+static mp_float_t synthesize_level(const synthio_wavetable_level_t *level, const mp_float_t *spectrum_re, const mp_float_t *spectrum_im, size_t length, mp_float_t *re, mp_float_t *im) {
+    size_t n = 1 << level->length_shift;
+    mp_float_t scale = MICROPY_FLOAT_CONST(1.) / length;
+    memset(re, 0, n * sizeof(mp_float_t));
+    memset(im, 0, n * sizeof(mp_float_t));
+    re[0] = spectrum_re[0] * scale;
+    for (size_t h = 1; h <= level->max_harmonic; h++) {
+        re[h] = re[n - h] = spectrum_re[h] * scale;
+        im[h] = spectrum_im[h] * scale;
+        im[n - h] = -im[h];
+    }
+    fft(re, im, n, 1);
+
+    mp_float_t peak = 0;
+    for (size_t i = 0; i < n; i++) {
+        peak = MAX(peak, MICROPY_FLOAT_C_FUN(fabs)(re[i]));
+    }
+    return peak;
+}
+
+void common_hal_synthio_wavetable_construct(synthio_wavetable_t *self, mp_obj_t waveform_obj) {
+    mp_buffer_info_t bufinfo;
+    synthio_synth_parse_waveform(&bufinfo, waveform_obj);
+    const int16_t *waveform = bufinfo.buf;
+    size_t waveform_length = bufinfo.len;
+
+    uint8_t length_shift = SYNTHIO_WAVETABLE_MIN_SHIFT;
+    size_t length = 1 << length_shift;
+    while (length < waveform_length) {
+        length <<= 1;
+        length_shift++;
+    }
+
+    // Lay out one level per octave. Level 0 has every harmonic the table can hold; later ones
+    // are twice oversampled (for smooth interpolation) and so half as long as the one before.
+    size_t total_length = 0;
+    uint8_t level_count = 0;
+    for (size_t harmonics = length / 2; harmonics >= 2; harmonics /= 2) {
+        synthio_wavetable_level_t *level = &self->levels[level_count];
+        uint8_t level_shift = level_count == 0 ? length_shift : length_shift + 1 - level_count;
+        level->length_shift = MAX(level_shift, SYNTHIO_WAVETABLE_MIN_LEVEL_SHIFT);
+        level->max_harmonic = harmonics - 1;
+        total_length += (1 << level->length_shift) + 1;
+        level_count++;
+    }
+    self->level_count = level_count;
+
+    mp_float_t *spectrum_re = m_new(mp_float_t, 4 * length);
+    mp_float_t *spectrum_im = spectrum_re + length;
+    mp_float_t *re = spectrum_im + length;
+    mp_float_t *im = re + length;
+
+    // Hold each sample for as long as nearest-sample playback would, so that short waveforms
+    // such as the default square wave keep the harmonics they are heard with
+    for (size_t i = 0; i < length; i++) {
+        spectrum_re[i] = waveform[(uint32_t)(i * waveform_length / length)];
+        spectrum_im[i] = 0;
+    }
+    fft(spectrum_re, spectrum_im, length, -1);
+
+    // Band limiting a waveform with sharp edges makes it overshoot, so scale every level by the
+    // same amount to fit the loudest, keeping them equally loud.
+    mp_float_t peak = 0;
+    for (int i = 0; i < level_count; i++) {
+        peak = MAX(peak, synthesize_level(&self->levels[i], spectrum_re, spectrum_im, length, re, im));
+    }
+    mp_float_t gain = peak > 32767 ? 32767 / peak : MICROPY_FLOAT_CONST(1.);
+
+    self->samples = m_new(int16_t, total_length);
+    int16_t *samples = self->samples;
+    for (int i = 0; i < level_count; i++) {
+        synthio_wavetable_level_t *level = &self->levels[i];
+        synthesize_level(level, spectrum_re, spectrum_im, length, re, im);
+        size_t n = 1 << level->length_shift;
+        for (size_t j = 0; j < n; j++) {
+            mp_float_t sample = MICROPY_FLOAT_C_FUN(round)(re[j] * gain);
+            samples[j] = (int16_t)MIN(32767, MAX(-32768, sample));
+        }
+        samples[n] = samples[0];
+        level->samples = samples;
+        samples += n + 1;
+    }
+
+    m_del(mp_float_t, spectrum_re, 4 * length);
+    self->waveform_obj = waveform_obj;
+}
+
+mp_obj_t common_hal_synthio_wavetable_get_waveform_obj(synthio_wavetable_t *self) {
+    return self->waveform_obj;
+}
+
+mp_int_t common_hal_synthio_wavetable_get_levels(synthio_wavetable_t *self) {
+    return self->level_count;
+}
+
+void common_hal_synthio_wavetable_get_buffer(synthio_wavetable_t *self, mp_buffer_info_t *bufinfo) {
+    bufinfo->buf = (void *)self->levels[0].samples;
+    bufinfo->len = (1 << self->levels[0].length_shift) * sizeof(int16_t);
+    bufinfo->typecode = 'h';
+}
+
+const synthio_wavetable_t *synthio_wavetable_from_obj(mp_obj_t obj) {
+    if (mp_obj_is_type(obj, &synthio_wavetable_type)) {
+        return MP_OBJ_TO_PTR(obj);
+    }
+    return NULL;
+}
+
+uint32_t synthio_wavetable_dds(uint64_t frequency_scaled, int32_t sample_rate) {
+    uint64_t dds_rate = (sample_rate / 2 + (frequency_scaled << (32 - SYNTHIO_FREQUENCY_SHIFT))) / sample_rate;
+    return MIN(dds_rate, UINT32_MAX);
+}
+
+const synthio_wavetable_level_t *synthio_wavetable_get_level(const synthio_wavetable_t *self, uint32_t dds_rate) {
+    for (int i = 0; i < self->level_count; i++) {
+        const synthio_wavetable_level_t *level = &self->levels[i];
+        // nyquist is half a cycle per sample
+        if ((uint64_t)level->max_harmonic * dds_rate < (UINT64_C(1) << 31)) {
+            return level;
+        }
+    }
+    return NULL;
+}
+
+static inline uint32_t wavetable_render(const synthio_wavetable_level_t *level, uint32_t phase, uint32_t dds_rate, int32_t dds_step, int32_t *out_buffer32, uint16_t dur, bool ring) {
+    const int16_t *samples = level->samples;
+    uint8_t length_shift = level->length_shift;
+    uint8_t index_shift = 32 - length_shift;
+    for (uint16_t i = 0; i < dur; i++) {
+        dds_rate += dds_step;
+        phase += dds_rate;
+        uint32_t idx = phase >> index_shift;
+        // 15 bits of the position between two samples, so that the product fits in 32 bits
+        int32_t frac = (phase << length_shift) >> 17;
+        int32_t a = samples[idx];
+        int32_t sample = a + (((samples[idx + 1] - a) * frac) >> 15);
+        if (ring) {
+            out_buffer32[i] = (sample * out_buffer32[i]) / 32768;
+        } else {
+            out_buffer32[i] = sample;
+        }
+    }
+    return phase;
+}
+
+uint32_t synthio_wavetable_render(const synthio_wavetable_level_t *level, uint32_t phase, uint32_t dds_rate, int32_t dds_step, int32_t *out_buffer32, uint16_t dur) {
+    return wavetable_render(level, phase, dds_rate, dds_step, out_buffer32, dur, false);
+}
+
+uint32_t synthio_wavetable_ring(const synthio_wavetable_level_t *level, uint32_t phase, uint32_t dds_rate, int32_t *out_buffer32, uint16_t dur) {
+    return wavetable_render(level, phase, dds_rate, 0, out_buffer32, dur, true);
+}
@@ -0,0 +1,51 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+#include "shared-bindings/synthio/Wavetable.h"
+
+// The waveform is resampled to a power of two length, at least 2^8 samples
+#define SYNTHIO_WAVETABLE_MIN_SHIFT (8)
+// Tables of band-limited levels are at least 2^6 samples, so that interpolating them stays smooth
+#define SYNTHIO_WAVETABLE_MIN_LEVEL_SHIFT (6)
+// One level per octave, until only the fundamental is left: at most one less than the number
+// of bits in the length of the longest waveform
+#define SYNTHIO_WAVETABLE_MAX_LEVELS (13)
+
+typedef struct {
+    // (1 << length_shift) + 1 samples; the last repeats the first so interpolation needn't wrap
+    const int16_t *samples;
+    uint8_t length_shift;
+    // The highest harmonic in this level
+    uint16_t max_harmonic;
+} synthio_wavetable_level_t;
+
+typedef struct synthio_wavetable {
+    mp_obj_base_t base;
+    mp_obj_t waveform_obj;
+    int16_t *samples;
+    uint8_t level_count;
+    synthio_wavetable_level_t levels[SYNTHIO_WAVETABLE_MAX_LEVELS];
+} synthio_wavetable_t;
+
+// obj as a wavetable, or NULL if it is some other kind of waveform
+const synthio_wavetable_t *synthio_wavetable_from_obj(mp_obj_t obj);
+
+// Phases and rates of wavetable oscillators are fractions of a cycle, 2^32 to the cycle, so
+// that wrapping around is free
+uint32_t synthio_wavetable_dds(uint64_t frequency_scaled, int32_t sample_rate);
+
+// The level with the most harmonics that are all below nyquist at dds_rate, or NULL if even
+// the fundamental is not
+const synthio_wavetable_level_t *synthio_wavetable_get_level(const synthio_wavetable_t *self, uint32_t dds_rate);
+
+// Fill out_buffer32 from the level, starting at phase and changing the rate by dds_step each
+// sample. Returns the new phase.
+uint32_t synthio_wavetable_render(const synthio_wavetable_level_t *level, uint32_t phase, uint32_t dds_rate, int32_t dds_step, int32_t *out_buffer32, uint16_t dur);
+// The same, but ring modulate out_buffer32 by the level instead
+uint32_t synthio_wavetable_ring(const synthio_wavetable_level_t *level, uint32_t phase, uint32_t dds_rate, int32_t *out_buffer32, uint16_t dur);
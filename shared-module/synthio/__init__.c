@@ -8,7 +8,9 @@
 #include "shared-module/synthio/__init__.h"
 #include "shared-bindings/synthio/__init__.h"
 #include "shared-module/synthio/Biquad.h"
+#include "shared-module/synthio/BlockBiquad.h"
 #include "shared-module/synthio/Note.h"
+#include "shared-module/synthio/Wavetable.h"
 #include "py/runtime.h"
 #include <math.h>
 #include <stdlib.h>
@@ -129,25 +131,25 @@ static synthio_envelope_definition_t *synthio_synth_get_note_envelope(synthio_sy
 #define RANGE_LOW (-28000)
 #define RANGE_HIGH (28000)
 #define RANGE_SHIFT (16)
-#define RANGE_SCALE (0xfffffff / (32768 * CIRCUITPY_SYNTHIO_MAX_CHANNELS - RANGE_HIGH))
+#define RANGE_SCALE(voice_count) (0xfffffff / (32768 * (voice_count) - RANGE_HIGH))
 
 // dynamic range compression via a downward compressor with hard knee
 //
 // When the output value is within the range +-28000 (about 85% of full scale),
 // it is unchanged. Otherwise, it undergoes a gain reduction so that the
-// largest possible values, (+32768,-32767) * CIRCUITPY_SYNTHIO_MAX_CHANNELS,
-// still fit within the output range
+// largest possible values, (+32768,-32767) * voice_count, still fit within
+// the output range
 //
 // This produces a much louder overall volume with multiple voices, without
 // much additional processing.
 //
 // https://en.wikipedia.org/wiki/Dynamic_range_compression
 static
-int16_t mix_down_sample(int32_t sample) {
+int16_t mix_down_sample(int32_t sample, int32_t range_scale) {
     if (sample < RANGE_LOW) {
-        sample = (((sample - RANGE_LOW) * RANGE_SCALE) >> RANGE_SHIFT) + RANGE_LOW;
+        sample = (((sample - RANGE_LOW) * range_scale) >> RANGE_SHIFT) + RANGE_LOW;
     } else if (sample > RANGE_HIGH) {
-        sample = (((sample - RANGE_HIGH) * RANGE_SCALE) >> RANGE_SHIFT) + RANGE_HIGH;
+        sample = (((sample - RANGE_HIGH) * range_scale) >> RANGE_SHIFT) + RANGE_HIGH;
     }
     return sample;
 }
@@ -162,28 +164,35 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
     const int16_t *waveform = synth->waveform_bufinfo.buf;
     uint32_t waveform_start = 0;
     uint32_t waveform_length = synth->waveform_bufinfo.len;
+    const synthio_wavetable_t *wavetable = synthio_wavetable_from_obj(synth->waveform_obj);
 
     uint32_t ring_dds_rate = 0;
     const int16_t *ring_waveform = NULL;
     uint32_t ring_waveform_start = 0;
     uint32_t ring_waveform_length = 0;
+    const synthio_wavetable_t *ring_wavetable = NULL;
 
     if (mp_obj_is_small_int(note_obj)) {
         uint8_t note = mp_obj_get_int(note_obj);
         uint8_t octave = note / 12;
         uint16_t base_freq = notes[note % 12];
-        // rate = base_freq * waveform_length
-        // den = sample_rate * 2 ^ (10 - octave)
-        // den = sample_rate * 2 ^ 10 / 2^octave
-        // dds_rate = 2^SHIFT * rate / den
-        // dds_rate = 2^(SHIFT-10+octave) * base_freq * waveform_length / sample_rate
-        dds_rate = (sample_rate / 2 + ((uint64_t)(base_freq * waveform_length) << (SYNTHIO_FREQUENCY_SHIFT - 10 + octave))) / sample_rate;
+        if (wavetable) {
+            dds_rate = synthio_wavetable_dds((uint64_t)base_freq << (SYNTHIO_FREQUENCY_SHIFT - 10 + octave), sample_rate);
+        } else {
+            // rate = base_freq * waveform_length
+            // den = sample_rate * 2 ^ (10 - octave)
+            // den = sample_rate * 2 ^ 10 / 2^octave
+            // dds_rate = 2^SHIFT * rate / den
+            // dds_rate = 2^(SHIFT-10+octave) * base_freq * waveform_length / sample_rate
+            dds_rate = (sample_rate / 2 + ((uint64_t)(base_freq * waveform_length) << (SYNTHIO_FREQUENCY_SHIFT - 10 + octave))) / sample_rate;
+        }
     } else {
         synthio_note_obj_t *note = MP_OBJ_TO_PTR(note_obj);
         int32_t frequency_scaled = synthio_note_step(note, sample_rate, dur, loudness);
         if (note->waveform_buf.buf) {
             waveform = note->waveform_buf.buf;
             waveform_length = note->waveform_buf.len;
+            wavetable = synthio_wavetable_from_obj(note->waveform_obj);
             if (note->waveform_loop_start > 0 && note->waveform_loop_start < waveform_length) {
                 waveform_start = note->waveform_loop_start;
             }
@@ -191,20 +200,29 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
                 waveform_length = note->waveform_loop_end;
             }
         }
-        dds_rate = synthio_frequency_convert_scaled_to_dds((uint64_t)frequency_scaled * (waveform_length - waveform_start), sample_rate);
+        if (wavetable) {
+            dds_rate = synthio_wavetable_dds(frequency_scaled, sample_rate);
+        } else {
+            dds_rate = synthio_frequency_convert_scaled_to_dds((uint64_t)frequency_scaled * (waveform_length - waveform_start), sample_rate);
+        }
         if (note->ring_frequency_scaled != 0 && note->ring_waveform_buf.buf) {
-            ring_waveform = note->ring_waveform_buf.buf;
-            ring_waveform_length = note->ring_waveform_buf.len;
-            if (note->ring_waveform_loop_start > 0 && note->ring_waveform_loop_start < ring_waveform_length) {
-                ring_waveform_start = note->waveform_loop_start;
-            }
-            if (note->ring_waveform_loop_end > ring_waveform_start && note->ring_waveform_loop_end < ring_waveform_length) {
-                ring_waveform_length = note->ring_waveform_loop_end;
-            }
-            ring_dds_rate = synthio_frequency_convert_scaled_to_dds((uint64_t)note->ring_frequency_bent * (ring_waveform_length - ring_waveform_start), sample_rate);
-            uint32_t lim = ring_waveform_length << SYNTHIO_FREQUENCY_SHIFT;
-            if (ring_dds_rate > lim / sizeof(int16_t)) {
-                ring_dds_rate = 0; // can't ring at that frequency
+            ring_wavetable = synthio_wavetable_from_obj(note->ring_waveform_obj);
+            if (ring_wavetable) {
+                ring_dds_rate = synthio_wavetable_dds(note->ring_frequency_bent, sample_rate);
+            } else {
+                ring_waveform = note->ring_waveform_buf.buf;
+                ring_waveform_length = note->ring_waveform_buf.len;
+                if (note->ring_waveform_loop_start > 0 && note->ring_waveform_loop_start < ring_waveform_length) {
+                    ring_waveform_start = note->waveform_loop_start;
+                }
+                if (note->ring_waveform_loop_end > ring_waveform_start && note->ring_waveform_loop_end < ring_waveform_length) {
+                    ring_waveform_length = note->ring_waveform_loop_end;
+                }
+                ring_dds_rate = synthio_frequency_convert_scaled_to_dds((uint64_t)note->ring_frequency_bent * (ring_waveform_length - ring_waveform_start), sample_rate);
+                uint32_t lim = ring_waveform_length << SYNTHIO_FREQUENCY_SHIFT;
+                if (ring_dds_rate > lim / sizeof(int16_t)) {
+                    ring_dds_rate = 0; // can't ring at that frequency
+                }
             }
         }
     }
@@ -213,30 +231,73 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
     uint32_t lim = waveform_length << SYNTHIO_FREQUENCY_SHIFT;
     uint32_t accum = synth->accum[chan];
 
-    if (dds_rate > lim / 2) {
-        // beyond nyquist, can't play note
-        return false;
-    }
+    // a note that switches between a wavetable and a plain waveform keeps its phase and pitch
+    uint32_t accum_lim = wavetable ? 0 : lim;
+    if ((accum_lim == 0) != (synth->accum_lim[chan] == 0)) {
+        uint64_t from = synth->accum_lim[chan] ? synth->accum_lim[chan] : UINT64_C(1) << 32;
+        uint64_t to = accum_lim ? accum_lim : UINT64_C(1) << 32;
+        accum = accum * to / from;
+        synth->dds_rate[chan] = MIN(synth->dds_rate[chan] * to / from, UINT32_MAX);
+    }
+    synth->accum_lim[chan] = accum_lim;
+
+    if (wavetable) {
+        // glide from the previous block's pitch, playing the level that suits the higher of
+        // the two; the previous rate may be beyond nyquist for this wavetable
+        uint32_t last_dds_rate = synth->ramp_ready[chan] ? synth->dds_rate[chan] : dds_rate;
+        const synthio_wavetable_level_t *level = synthio_wavetable_get_level(wavetable, MAX(dds_rate, last_dds_rate));
+        if (!level) {
+            last_dds_rate = dds_rate;
+            level = synthio_wavetable_get_level(wavetable, dds_rate);
+        }
+        if (!level) {
+            // beyond nyquist, can't play note
+            return false;
+        }
+        synth->dds_rate[chan] = dds_rate;
+        int32_t dds_step = ((int32_t)dds_rate - (int32_t)last_dds_rate) / dur;
+        synth->accum[chan] = synthio_wavetable_render(level, accum, last_dds_rate, dds_step, out_buffer32, dur);
+    } else {
+        if (dds_rate > lim / 2) {
+            // beyond nyquist, can't play note
+            return false;
+        }
 
-    // can happen if note waveform gets set mid-note, but the expensive modulo is usually avoided
-    if (accum > lim) {
-        accum = accum % lim + offset;
-    }
+        // glide from the previous block's pitch instead of stepping to the new one
+        uint32_t last_dds_rate = synth->dds_rate[chan];
+        if (!synth->ramp_ready[chan] || last_dds_rate > lim / 2) {
+            last_dds_rate = dds_rate;
+        }
+        synth->dds_rate[chan] = dds_rate;
+        int32_t dds_step = ((int32_t)dds_rate - (int32_t)last_dds_rate) / dur;
+        dds_rate = last_dds_rate;
 
-    // first, fill with waveform
-    for (uint16_t i = 0; i < dur; i++) {
-        accum += dds_rate;
-        // because dds_rate is low enough, the subtraction is guaranteed to go back into range, no expensive modulo needed
+        // can happen if note waveform gets set mid-note, but the expensive modulo is usually avoided
         if (accum > lim) {
-            accum = accum - lim + offset;
+            accum = accum % lim + offset;
         }
-        int16_t idx = accum >> SYNTHIO_FREQUENCY_SHIFT;
-        out_buffer32[i] = waveform[idx];
+
+        // first, fill with waveform
+        for (uint16_t i = 0; i < dur; i++) {
+            dds_rate += dds_step;
+            accum += dds_rate;
+            // because dds_rate is low enough, the subtraction is guaranteed to go back into range, no expensive modulo needed
+            if (accum > lim) {
+                accum = accum - lim + offset;
+            }
+            int16_t idx = accum >> SYNTHIO_FREQUENCY_SHIFT;
+            out_buffer32[i] = waveform[idx];
+        }
+        synth->accum[chan] = accum;
     }
-    synth->accum[chan] = accum;
 
-    if (ring_dds_rate) {
-        if (ring_dds_rate > lim / 2) {
+    if (ring_wavetable) {
+        const synthio_wavetable_level_t *level = synthio_wavetable_get_level(ring_wavetable, ring_dds_rate);
+        if (level) {
+            synth->ring_accum[chan] = synthio_wavetable_ring(level, synth->ring_accum[chan], ring_dds_rate, out_buffer32, dur);
+        }
+    } else if (ring_dds_rate) {
+        if (!wavetable && ring_dds_rate > lim / 2) {
             // beyond nyquist, can't play ring (but did synth main sound so
             // return true)
             return true;
@@ -278,19 +339,77 @@ static mp_obj_t synthio_synth_get_note_filter(mp_obj_t note_obj) {
     return mp_const_none;
 }
 
-static void sum_with_loudness(int32_t *out_buffer32, int32_t *tmp_buffer32, int16_t loudness[2], size_t dur, int synth_chan) {
+// Loudness ramps with LOUDNESS_RAMP_SHIFT extra fractional bits
+#define LOUDNESS_RAMP_SHIFT (8)
+
+static void sum_with_loudness(int32_t *out_buffer32, int32_t *tmp_buffer32, const int16_t last_loudness[2], const int16_t loudness[2], size_t dur, int synth_chan) {
+    if (last_loudness[0] == loudness[0] && last_loudness[1] == loudness[1]) {
+        if (synth_chan == 1) {
+            for (size_t i = 0; i < dur; i++) {
+                *out_buffer32++ += (*tmp_buffer32++ *loudness[0]) >> 16;
+            }
+        } else {
+            for (size_t i = 0; i < dur; i++) {
+                *out_buffer32++ += (*tmp_buffer32 * loudness[0]) >> 16;
+                *out_buffer32++ += (*tmp_buffer32++ *loudness[1]) >> 16;
+            }
+        }
+        return;
+    }
+
+    // the envelope or amplitude moved since the last block, so ramp across this one
+    int32_t l0 = last_loudness[0] << LOUDNESS_RAMP_SHIFT;
+    int32_t l1 = last_loudness[1] << LOUDNESS_RAMP_SHIFT;
+    int32_t dl0 = ((loudness[0] - last_loudness[0]) << LOUDNESS_RAMP_SHIFT) / (int32_t)dur;
+    int32_t dl1 = ((loudness[1] - last_loudness[1]) << LOUDNESS_RAMP_SHIFT) / (int32_t)dur;
     if (synth_chan == 1) {
         for (size_t i = 0; i < dur; i++) {
-            *out_buffer32++ += (*tmp_buffer32++ *loudness[0]) >> 16;
+            l0 += dl0;
+            *out_buffer32++ += (*tmp_buffer32++ *(l0 >> LOUDNESS_RAMP_SHIFT)) >> 16;
         }
     } else {
         for (size_t i = 0; i < dur; i++) {
-            *out_buffer32++ += (*tmp_buffer32 * loudness[0]) >> 16;
-            *out_buffer32++ += (*tmp_buffer32++ *loudness[1]) >> 16;
+            l0 += dl0;
+            l1 += dl1;
+            *out_buffer32++ += (*tmp_buffer32 * (l0 >> LOUDNESS_RAMP_SHIFT)) >> 16;
+            *out_buffer32++ += (*tmp_buffer32++ *(l1 >> LOUDNESS_RAMP_SHIFT)) >> 16;
         }
     }
 }
 
+// Put a voice at a position in the voice list by swapping it with the voice there. Starting
+// and stopping a voice swap it across the boundary between the active and free voices.
+static void synthio_voice_swap(synthio_synth_t *synth, int voice, int position) {
+    int other = synth->voices[position];
+    int old_position = synth->voice_position[voice];
+    synth->voices[position] = voice;
+    synth->voice_position[voice] = position;
+    synth->voices[old_position] = other;
+    synth->voice_position[other] = old_position;
+}
+
+static void synthio_voice_stop(synthio_synth_t *synth, int voice) {
+    synth->span.note_obj[voice] = SYNTHIO_SILENCE;
+    synthio_voice_swap(synth, voice, --synth->active_count);
+}
+
+static void synthio_voice_start(synthio_synth_t *synth, int voice, mp_obj_t note_obj) {
+    if (synth->span.note_obj[voice] == SYNTHIO_SILENCE) {
+        synthio_voice_swap(synth, voice, synth->active_count++);
+    }
+    synth->span.note_obj[voice] = note_obj;
+    if (mp_obj_is_small_int(note_obj)) {
+        synth->midi_voice[MP_OBJ_SMALL_INT_VALUE(note_obj) & 127] = voice;
+    } else {
+        synthio_note_obj_t *note = MP_OBJ_TO_PTR(note_obj);
+        note->voice = voice;
+    }
+    synth->pressed_at[voice] = synth->press_count++;
+    synthio_envelope_state_init(&synth->envelope_state[voice], synthio_synth_get_note_envelope(synth, note_obj));
+    synth->accum[voice] = 0;
+    synth->ramp_ready[voice] = false;
+}
+
 void synthio_synth_synthesize(synthio_synth_t *synth, uint8_t **bufptr, uint32_t *buffer_length, uint8_t channel) {
 
     if (channel == synth->other_channel) {
@@ -307,20 +426,27 @@ void synthio_synth_synthesize(synthio_synth_t *synth, uint8_t **bufptr, uint32_t
 
     uint16_t dur = MIN(SYNTHIO_MAX_DUR, synth->span.dur);
     synth->span.dur -= dur;
+    if (dur == 0) {
+        *buffer_length = synth->last_buffer_length = 0;
+        *bufptr = (uint8_t *)synth->buffers[synth->buffer_index];
+        return;
+    }
 
     int32_t out_buffer32[SYNTHIO_MAX_DUR * synth->channel_count];
     int32_t tmp_buffer32[SYNTHIO_MAX_DUR];
     memset(out_buffer32, 0, synth->channel_count * dur * sizeof(int32_t));
 
-    for (int chan = 0; chan < CIRCUITPY_SYNTHIO_MAX_CHANNELS; chan++) {
+    // walk the active voices backwards, so that a voice that stops is replaced in the list
+    // by one that was already visited
+    for (int i = synth->active_count - 1; i >= 0; i--) {
+        int chan = synth->voices[i];
         mp_obj_t note_obj = synth->span.note_obj[chan];
-        if (note_obj == SYNTHIO_SILENCE) {
-            continue;
-        }
 
-        if (synth->envelope_state[chan].level == 0) {
-            // note is truly finished, but we only just noticed
-            synth->span.note_obj[chan] = SYNTHIO_SILENCE;
+        // when the note is truly finished, but we only just noticed, render one last
+        // block that fades out from the previous loudness rather than stopping dead
+        bool finished = synth->envelope_state[chan].level == 0;
+        if (finished && !synth->ramp_ready[chan]) {
+            synthio_voice_stop(synth, chan);
             continue;
         }
 
@@ -329,17 +455,31 @@ void synthio_synth_synthesize(synthio_synth_t *synth, uint8_t **bufptr, uint32_t
         if (!synth_note_into_buffer(synth, chan, tmp_buffer32, dur, loudness)) {
             // for some other reason, such as being above nyquist, note
             // couldn't be synthed, so don't filter or sum it in
+            if (finished) {
+                synthio_voice_stop(synth, chan);
+            }
             continue;
         }
 
         mp_obj_t filter_obj = synthio_synth_get_note_filter(note_obj);
         if (filter_obj != mp_const_none) {
             synthio_note_obj_t *note = MP_OBJ_TO_PTR(note_obj);
-            synthio_biquad_filter_samples(&note->filter_state, tmp_buffer32, dur);
+            const biquad_filter_coefficients *coefficients = &note->filter_coefficients;
+            if (mp_obj_is_type(filter_obj, &synthio_block_biquad_type)) {
+                coefficients = synthio_block_biquad_tick(MP_OBJ_TO_PTR(filter_obj), synth->sample_rate);
+            }
+            synthio_biquad_filter_samples(&note->filter_state, coefficients, tmp_buffer32, dur);
         }
 
         // adjust loudness by envelope
-        sum_with_loudness(out_buffer32, tmp_buffer32, loudness, dur, synth->channel_count);
+        int16_t *last_loudness = synth->ramp_ready[chan] ? synth->loudness[chan] : loudness;
+        sum_with_loudness(out_buffer32, tmp_buffer32, last_loudness, loudness, dur, synth->channel_count);
+        synth->loudness[chan][0] = loudness[0];
+        synth->loudness[chan][1] = loudness[1];
+        synth->ramp_ready[chan] = !finished;
+        if (finished) {
+            synthio_voice_stop(synth, chan);
+        }
     }
 
     int16_t *out_buffer16 = (int16_t *)(void *)synth->buffers[synth->buffer_index];
@@ -347,15 +487,13 @@ void synthio_synth_synthesize(synthio_synth_t *synth, uint8_t **bufptr, uint32_t
     // mix down audio
     for (size_t i = 0; i < dur * synth->channel_count; i++) {
         int32_t sample = out_buffer32[i];
-        out_buffer16[i] = mix_down_sample(sample);
+        out_buffer16[i] = mix_down_sample(sample, synth->range_scale);
     }
 
     // advance envelope states
-    for (int chan = 0; chan < CIRCUITPY_SYNTHIO_MAX_CHANNELS; chan++) {
+    for (int i = 0; i < synth->active_count; i++) {
+        int chan = synth->voices[i];
         mp_obj_t note_obj = synth->span.note_obj[chan];
-        if (note_obj == SYNTHIO_SILENCE) {
-            continue;
-        }
         synthio_envelope_state_step(&synth->envelope_state[chan], synthio_synth_get_note_envelope(synth, note_obj), dur);
     }
 
@@ -388,9 +526,11 @@ mp_obj_t synthio_synth_envelope_get(synthio_synth_t *synth) {
     return synth->envelope_obj;
 }
 
-void synthio_synth_init(synthio_synth_t *synth, uint32_t sample_rate, int channel_count, mp_obj_t waveform_obj, mp_obj_t envelope_obj) {
+void synthio_synth_init(synthio_synth_t *synth, uint32_t sample_rate, int channel_count, mp_obj_t waveform_obj, mp_obj_t envelope_obj,
+    int voice_count, synthio_voice_stealing_t voice_stealing) {
     synthio_synth_parse_waveform(&synth->waveform_bufinfo, waveform_obj);
     mp_arg_validate_int_range(channel_count, 1, 2, MP_QSTR_channel_count);
+    mp_arg_validate_int_range(voice_count, 1, 255, MP_QSTR_polyphony);
     synth->buffer_length = SYNTHIO_MAX_DUR * SYNTHIO_BYTES_PER_SAMPLE * channel_count;
     synth->buffers[0] = m_malloc(synth->buffer_length);
     synth->buffers[1] = m_malloc(synth->buffer_length);
@@ -400,8 +540,26 @@ void synthio_synth_init(synthio_synth_t *synth, uint32_t sample_rate, int channe
     synth->sample_rate = sample_rate;
     synthio_synth_envelope_set(synth, envelope_obj);
 
-    for (size_t i = 0; i < CIRCUITPY_SYNTHIO_MAX_CHANNELS; i++) {
+    synth->voice_count = voice_count;
+    synth->voice_stealing = voice_stealing;
+    synth->range_scale = RANGE_SCALE(voice_count);
+    synth->span.note_obj = m_new(mp_obj_t, voice_count);
+    synth->accum = m_new0(uint32_t, voice_count);
+    synth->ring_accum = m_new0(uint32_t, voice_count);
+    synth->accum_lim = m_new0(uint32_t, voice_count);
+    synth->dds_rate = m_new0(uint32_t, voice_count);
+    synth->loudness = m_malloc(voice_count * sizeof(*synth->loudness));
+    synth->ramp_ready = m_new0(bool, voice_count);
+    synth->envelope_state = m_new0(synthio_envelope_state_t, voice_count);
+    synth->pressed_at = m_new0(uint32_t, voice_count);
+    synth->voices = m_new(uint8_t, voice_count);
+    synth->voice_position = m_new(uint8_t, voice_count);
+    synth->active_count = 0;
+
+    for (int i = 0; i < voice_count; i++) {
         synth->span.note_obj[i] = SYNTHIO_SILENCE;
+        synth->voices[i] = i;
+        synth->voice_position[i] = i;
     }
 }
 
@@ -433,23 +591,85 @@ void synthio_synth_parse_waveform(mp_buffer_info_t *bufinfo_waveform, mp_obj_t w
     parse_common(bufinfo_waveform, waveform_obj, MP_QSTR_waveform, SYNTHIO_WAVEFORM_SIZE);
 }
 
-static int find_channel_with_note(synthio_synth_t *synth, mp_obj_t note) {
-    for (int i = 0; i < CIRCUITPY_SYNTHIO_MAX_CHANNELS; i++) {
-        if (synth->span.note_obj[i] == note) {
-            return i;
+int synthio_synth_find_voice(synthio_synth_t *synth, mp_obj_t note_obj) {
+    int voice;
+    if (mp_obj_is_small_int(note_obj)) {
+        voice = synth->midi_voice[MP_OBJ_SMALL_INT_VALUE(note_obj) & 127];
+    } else {
+        synthio_note_obj_t *note = MP_OBJ_TO_PTR(note_obj);
+        voice = note->voice;
+    }
+    if (voice < synth->voice_count && synth->span.note_obj[voice] == note_obj) {
+        return voice;
+    }
+    if (mp_obj_is_small_int(note_obj)) {
+        return -1;
+    }
+    // the hint is stale, because the note was since played by another synthesizer
+    for (int i = 0; i < synth->active_count; i++) {
+        voice = synth->voices[i];
+        if (synth->span.note_obj[voice] == note_obj) {
+            return voice;
+        }
+    }
+    return -1;
+}
+
+static mp_float_t synthio_note_frequency(mp_obj_t note_obj) {
+    if (mp_obj_is_small_int(note_obj)) {
+        return common_hal_synthio_midi_to_hz_float(MP_OBJ_SMALL_INT_VALUE(note_obj));
+    }
+    synthio_note_obj_t *note = MP_OBJ_TO_PTR(note_obj);
+    return note->frequency;
+}
+
+static int find_voice_for_new_note(synthio_synth_t *synth, mp_obj_t new_note) {
+    if (synth->voice_stealing == SYNTHIO_VOICE_STEALING_SAME_NOTE) {
+        // a note at the same pitch as a sounding one takes over its voice
+        mp_float_t frequency = synthio_note_frequency(new_note);
+        for (int i = 0; i < synth->active_count; i++) {
+            int voice = synth->voices[i];
+            if (synthio_note_frequency(synth->span.note_obj[voice]) == frequency) {
+                return voice;
+            }
         }
     }
+
+    if (synth->active_count < synth->voice_count) {
+        return synth->voices[synth->active_count];
+    }
+
+    // replace the releasing note with lowest volume level
     int result = -1;
-    if (note == SYNTHIO_SILENCE) {
-        // replace the releasing note with lowest volume level
-        int level = 32768;
-        for (int chan = 0; chan < CIRCUITPY_SYNTHIO_MAX_CHANNELS; chan++) {
-            if (!SYNTHIO_NOTE_IS_PLAYING(synth, chan)) {
-                synthio_envelope_state_t *state = &synth->envelope_state[chan];
-                if (state->level < level) {
-                    result = chan;
-                    level = state->level;
-                }
+    int level = 32768;
+    for (int i = 0; i < synth->active_count; i++) {
+        int voice = synth->voices[i];
+        if (!SYNTHIO_NOTE_IS_PLAYING(synth, voice)) {
+            synthio_envelope_state_t *state = &synth->envelope_state[voice];
+            if (state->level < level) {
+                result = voice;
+                level = state->level;
+            }
+        }
+    }
+    if (result != -1 || synth->voice_stealing == SYNTHIO_VOICE_STEALING_NONE) {
+        return result;
+    }
+
+    // every voice is held, so steal one
+    uint32_t age = 0;
+    for (int i = 0; i < synth->active_count; i++) {
+        int voice = synth->voices[i];
+        if (synth->voice_stealing == SYNTHIO_VOICE_STEALING_QUIETEST) {
+            if (synth->envelope_state[voice].level < level) {
+                result = voice;
+                level = synth->envelope_state[voice].level;
+            }
+        } else {
+            uint32_t voice_age = synth->press_count - synth->pressed_at[voice];
+            if (result == -1 || voice_age > age) {
+                result = voice;
+                age = voice_age;
             }
         }
     }
@@ -458,19 +678,21 @@ static int find_channel_with_note(synthio_synth_t *synth, mp_obj_t note) {
 
 bool synthio_span_change_note(synthio_synth_t *synth, mp_obj_t old_note, mp_obj_t new_note) {
     int channel;
-    if (new_note != SYNTHIO_SILENCE && (channel = find_channel_with_note(synth, new_note)) != -1) {
+    if (new_note != SYNTHIO_SILENCE && (channel = synthio_synth_find_voice(synth, new_note)) != -1) {
         // note already playing, re-enter attack phase
         synth->envelope_state[channel].state = SYNTHIO_ENVELOPE_STATE_ATTACK;
         return true;
     }
-    channel = find_channel_with_note(synth, old_note);
+    if (old_note == SYNTHIO_SILENCE) {
+        channel = find_voice_for_new_note(synth, new_note);
+    } else {
+        channel = synthio_synth_find_voice(synth, old_note);
+    }
     if (channel != -1) {
         if (new_note == SYNTHIO_SILENCE) {
             synthio_envelope_state_release(&synth->envelope_state[channel], synthio_synth_get_note_envelope(synth, old_note));
         } else {
-            synth->span.note_obj[channel] = new_note;
-            synthio_envelope_state_init(&synth->envelope_state[channel], synthio_synth_get_note_envelope(synth, new_note));
-            synth->accum[channel] = 0;
+            synthio_voice_start(synth, channel, new_note);
         }
         return true;
     }
@@ -13,13 +13,15 @@
 #define SYNTHIO_NOTE_IS_SIMPLE(note) (mp_obj_is_small_int(note))
 #define SYNTHIO_NOTE_IS_PLAYING(synth, i) ((synth)->envelope_state[(i)].state != SYNTHIO_ENVELOPE_STATE_RELEASE)
 #define SYNTHIO_FREQUENCY_SHIFT (16)
+// M_PI is not part of the math.h standard and may not be defined
+#define MP_PI MICROPY_FLOAT_CONST(3.14159265358979323846)
 
 #include "shared-module/audiocore/__init__.h"
 #include "shared-bindings/synthio/__init__.h"
 
 typedef struct {
     uint16_t dur;
-    mp_obj_t note_obj[CIRCUITPY_SYNTHIO_MAX_CHANNELS];
+    mp_obj_t *note_obj; // one per voice
 } synthio_midi_span_t;
 
 typedef struct {
@@ -48,9 +50,31 @@ typedef struct synthio_synth {
     synthio_envelope_definition_t global_envelope_definition;
     mp_obj_t waveform_obj, filter_obj, envelope_obj;
     synthio_midi_span_t span;
-    uint32_t accum[CIRCUITPY_SYNTHIO_MAX_CHANNELS];
-    uint32_t ring_accum[CIRCUITPY_SYNTHIO_MAX_CHANNELS];
-    synthio_envelope_state_t envelope_state[CIRCUITPY_SYNTHIO_MAX_CHANNELS];
+    // Per-voice state is kept as a structure of arrays, each with voice_count entries
+    uint8_t voice_count;
+    synthio_voice_stealing_t voice_stealing;
+    uint32_t *accum;
+    uint32_t *ring_accum;
+    // What a whole cycle of accum and dds_rate was last measured in: the lim of a plain
+    // waveform, or 0 for a wavetable, whose cycle is 2^32
+    uint32_t *accum_lim;
+    // Control values at the end of the previous block, which the next block ramps from
+    uint32_t *dds_rate;
+    int16_t (*loudness)[2];
+    bool *ramp_ready;
+    synthio_envelope_state_t *envelope_state;
+    // The value of press_count when each voice's note was pressed, to find the oldest voice
+    uint32_t *pressed_at;
+    uint32_t press_count;
+    // The first active_count entries are the voices that have a note, the rest are free.
+    // voice_position[voice] is the voice's index in voices.
+    uint8_t *voices;
+    uint8_t *voice_position;
+    uint8_t active_count;
+    // Which voice last played each MIDI note number, so that finding a note doesn't need a
+    // search. Note objects keep the same hint themselves.
+    uint8_t midi_voice[128];
+    int32_t range_scale;
 } synthio_synth_t;
 
 typedef struct {
@@ -66,7 +90,8 @@ typedef struct {
 void synthio_synth_synthesize(synthio_synth_t *synth, uint8_t **buffer, uint32_t *buffer_length, uint8_t channel);
 void synthio_synth_deinit(synthio_synth_t *synth);
 bool synthio_synth_deinited(synthio_synth_t *synth);
-void synthio_synth_init(synthio_synth_t *synth, uint32_t sample_rate, int channel_count, mp_obj_t waveform_obj, mp_obj_t envelope);
+void synthio_synth_init(synthio_synth_t *synth, uint32_t sample_rate, int channel_count, mp_obj_t waveform_obj, mp_obj_t envelope,
+    int voice_count, synthio_voice_stealing_t voice_stealing);
 void synthio_synth_get_buffer_structure(synthio_synth_t *synth, bool single_channel_output,
     bool *single_buffer, bool *samples_signed, uint32_t *max_buffer_length, uint8_t *spacing);
 void synthio_synth_reset_buffer(synthio_synth_t *synth, bool single_channel_output, uint8_t channel);
@@ -75,6 +100,7 @@ void synthio_synth_parse_filter(mp_buffer_info_t *bufinfo_filter, mp_obj_t filte
 void synthio_synth_parse_envelope(uint16_t *envelope_sustain_index, mp_buffer_info_t *bufinfo_envelope, mp_obj_t envelope_obj, mp_obj_t envelope_hold_obj);
 
 bool synthio_span_change_note(synthio_synth_t *synth, mp_obj_t old_note, mp_obj_t new_note);
+int synthio_synth_find_voice(synthio_synth_t *synth, mp_obj_t note);
 
 void synthio_envelope_step(synthio_envelope_definition_t *definition, synthio_envelope_state_t *state, int n_samples);
 void synthio_envelope_definition_set(synthio_envelope_definition_t *envelope, mp_obj_t obj, uint32_t sample_rate);
@@ -6,6 +6,9 @@
 
 #include "shared-module/terminalio/Terminal.h"
 
+#include <string.h>
+
+#include "py/runtime.h"
 #include "shared-module/fontio/BuiltinFont.h"
 #include "shared-bindings/displayio/TileGrid.h"
 #include "shared-bindings/terminalio/Terminal.h"
@@ -21,6 +24,29 @@ void terminalio_terminal_clear_status_bar(terminalio_terminal_obj_t *self) {
     }
 }
 
+static uint8_t terminal_get_glyph_index(terminalio_terminal_obj_t *self, unichar c) {
+    if (c >= 0x20 && c <= 0x7e) {
+        return c - 0x20;
+    }
+    if (c < 0x20) {
+        // Control characters have no glyph, and keeping them out of the cache lets codepoint 0
+        // mark an empty slot.
+        return fontio_builtinfont_get_glyph_index(self->font, c);
+    }
+    size_t slot = c & (TERMINALIO_GLYPH_CACHE_SIZE - 1);
+    if (self->glyph_cache_codepoint[slot] != c) {
+        self->glyph_cache_codepoint[slot] = c;
+        self->glyph_cache_tile_index[slot] = fontio_builtinfont_get_glyph_index(self->font, c);
+    }
+    return self->glyph_cache_tile_index[slot];
+}
+
+// Grows the area of changed tiles, in tile coordinates, to include x1 up to x2 of row y.
+static void terminal_extend_dirty(displayio_area_t *dirty, uint16_t x1, uint16_t x2, uint16_t y) {
+    displayio_area_t row = { .x1 = x1, .y1 = y, .x2 = x2, .y2 = y + 1 };
+    displayio_area_union(dirty, &row, dirty);
+}
+
 void common_hal_terminalio_terminal_construct(terminalio_terminal_obj_t *self,
     displayio_tilegrid_t *scroll_area, const fontio_builtinfont_t *font,
     displayio_tilegrid_t *status_bar) {
@@ -32,6 +58,8 @@ void common_hal_terminalio_terminal_construct(terminalio_terminal_obj_t *self,
     self->status_x = 0;
     self->status_y = 0;
     self->first_row = 0;
+    // Codepoint 0 never goes through the cache so it marks an empty slot.
+    memset(self->glyph_cache_codepoint, 0, sizeof(self->glyph_cache_codepoint));
     common_hal_displayio_tilegrid_set_all_tiles(self->scroll_area, 0);
     if (self->status_bar) {
         common_hal_displayio_tilegrid_set_all_tiles(self->status_bar, 0);
@@ -46,9 +74,21 @@ size_t common_hal_terminalio_terminal_write(terminalio_terminal_obj_t *self, con
         return len;
     }
 
+    displayio_tilegrid_t *scroll_area = self->scroll_area;
+    uint8_t *tiles = displayio_tilegrid_get_tiles(scroll_area);
+    if (tiles == NULL) {
+        return len;
+    }
+    // Tiles are written directly and their area is marked dirty once at the end of the write.
+    displayio_area_t dirty = { 0 };
+    // The builtin font maps printable ASCII to the first tiles so runs of it can be copied over
+    // when the bitmap has them all.
+    bool ascii_in_bitmap = scroll_area->tiles_in_bitmap > 0x7e - 0x20;
+
     const byte *i = data;
+    const byte *end = data + len;
     uint16_t start_y = self->cursor_y;
-    while (i < data + len) {
+    while (i < end) {
         unichar c = utf8_get_char(i);
         i = utf8_next_char(i);
         if (self->in_osc_command) {
@@ -61,7 +101,7 @@ size_t common_hal_terminalio_terminal_write(terminalio_terminal_obj_t *self, con
                 self->osc_command == 0 &&
                 self->status_bar != NULL &&
                 self->status_y < self->status_bar->height_in_tiles) {
-                uint8_t tile_index = fontio_builtinfont_get_glyph_index(self->font, c);
+                uint8_t tile_index = terminal_get_glyph_index(self, c);
                 if (tile_index != 0xff) {
                     // Clear the tile grid before we start putting new info.
                     if (self->status_x == 0 && self->status_y == 0) {
@@ -80,9 +120,20 @@ size_t common_hal_terminalio_terminal_write(terminalio_terminal_obj_t *self, con
         // Always handle ASCII.
         if (c < 128) {
             if (c >= 0x20 && c <= 0x7e) {
-                uint8_t tile_index = fontio_builtinfont_get_glyph_index(self->font, c);
-                common_hal_displayio_tilegrid_set_tile(self->scroll_area, self->cursor_x, self->cursor_y, tile_index);
-                self->cursor_x++;
+                if (ascii_in_bitmap) {
+                    // Copy the whole run of printable ASCII that fits on this row.
+                    uint8_t *row = tiles + self->cursor_y * scroll_area->width_in_tiles;
+                    uint16_t x = self->cursor_x;
+                    row[x++] = c - 0x20;
+                    while (x < scroll_area->width_in_tiles && i < end && *i >= 0x20 && *i <= 0x7e) {
+                        row[x++] = *i++ - 0x20;
+                    }
+                    terminal_extend_dirty(&dirty, self->cursor_x, x, self->cursor_y);
+                    self->cursor_x = x;
+                } else {
+                    common_hal_displayio_tilegrid_set_tile(scroll_area, self->cursor_x, self->cursor_y, c - 0x20);
+                    self->cursor_x++;
+                }
             } else if (c == '\r') {
                 self->cursor_x = 0;
             } else if (c == '\n') {
@@ -107,9 +158,8 @@ size_t common_hal_terminalio_terminal_write(terminalio_terminal_obj_t *self, con
                 if (i[0] == '[') {
                     if (i[1] == 'K') {
                         // Clear the rest of the line.
-                        for (uint16_t k = self->cursor_x; k < self->scroll_area->width_in_tiles; k++) {
-                            common_hal_displayio_tilegrid_set_tile(self->scroll_area, k, self->cursor_y, 0);
-                        }
+                        displayio_tilegrid_fill_tile_row(scroll_area, self->cursor_x, scroll_area->width_in_tiles, self->cursor_y, 0);
+                        terminal_extend_dirty(&dirty, self->cursor_x, scroll_area->width_in_tiles, self->cursor_y);
                         i += 2;
                     } else {
                         if (c == 'D') {
@@ -166,11 +216,16 @@ size_t common_hal_terminalio_terminal_write(terminalio_terminal_obj_t *self, con
                 }
             }
         } else {
-            uint8_t tile_index = fontio_builtinfont_get_glyph_index(self->font, c);
+            uint8_t tile_index = terminal_get_glyph_index(self, c);
             if (tile_index != 0xff) {
-                common_hal_displayio_tilegrid_set_tile(self->scroll_area, self->cursor_x, self->cursor_y, tile_index);
+                if (tile_index >= scroll_area->tiles_in_bitmap) {
+                    // Tiles written before this one still need redrawing
+                    displayio_tilegrid_mark_tiles_dirty(scroll_area, &dirty);
+                    mp_raise_ValueError(MP_ERROR_TEXT("Tile index out of bounds"));
+                }
+                tiles[self->cursor_y * scroll_area->width_in_tiles + self->cursor_x] = tile_index;
+                terminal_extend_dirty(&dirty, self->cursor_x, self->cursor_x + 1, self->cursor_y);
                 self->cursor_x++;
-
             }
         }
         if (self->cursor_x >= self->scroll_area->width_in_tiles) {
@@ -183,14 +238,14 @@ size_t common_hal_terminalio_terminal_write(terminalio_terminal_obj_t *self, con
         if (self->cursor_y != start_y) {
             // clear the new row in case of scroll up
             if (self->cursor_y == self->scroll_area->top_left_y) {
-                for (uint16_t j = 0; j < self->scroll_area->width_in_tiles; j++) {
-                    common_hal_displayio_tilegrid_set_tile(self->scroll_area, j, self->cursor_y, 0);
-                }
+                displayio_tilegrid_fill_tile_row(scroll_area, 0, scroll_area->width_in_tiles, self->cursor_y, 0);
+                terminal_extend_dirty(&dirty, 0, scroll_area->width_in_tiles, self->cursor_y);
                 common_hal_displayio_tilegrid_set_top_left(self->scroll_area, 0, (self->cursor_y + self->scroll_area->height_in_tiles + 1) % self->scroll_area->height_in_tiles);
             }
             start_y = self->cursor_y;
         }
     }
+    displayio_tilegrid_mark_tiles_dirty(scroll_area, &dirty);
     return i - data;
 }
 
@@ -13,6 +13,9 @@
 #include "shared-module/fontio/BuiltinFont.h"
 #include "shared-module/displayio/TileGrid.h"
 
+// Number of non-ASCII glyph lookups remembered per terminal. Must be a power of two.
+#define TERMINALIO_GLYPH_CACHE_SIZE (8)
+
 typedef struct  {
     mp_obj_base_t base;
     const fontio_builtinfont_t *font;
@@ -25,6 +28,9 @@ typedef struct  {
     uint16_t first_row;
     uint16_t osc_command;
     bool in_osc_command;
+    // Direct mapped cache of font lookups because the font's unicode table is searched linearly.
+    unichar glyph_cache_codepoint[TERMINALIO_GLYPH_CACHE_SIZE];
+    uint8_t glyph_cache_tile_index[TERMINALIO_GLYPH_CACHE_SIZE];
 } terminalio_terminal_obj_t;
 
 extern void terminalio_terminal_clear_status_bar(terminalio_terminal_obj_t *self);
@@ -44,6 +44,42 @@ uint32_t common_hal_vectorio_circle_get_pixel(void *obj, int16_t x, int16_t y) {
     return pythagorasSmallerThanRadius ? self->color_index : 0;
 }
 
+// Largest x with x * x <= n.
+static int32_t _isqrt(int32_t n) {
+    int32_t root = 0;
+    int32_t bit = 1 << 30;
+    while (bit > n) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (n >= root + bit) {
+            n -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+// Covers the same pixels as get_pixel: the x + y <= radius test there is only a shortcut since
+// it implies x * x + y * y <= radius * radius.
+size_t common_hal_vectorio_circle_get_spans(void *obj, int16_t y, vectorio_span_t *spans, size_t max_spans) {
+    vectorio_circle_t *self = obj;
+    int32_t radius = self->radius;
+    y = abs(y);
+    if (y > radius) {
+        return 0;
+    }
+    int16_t half_width = _isqrt(radius * radius - (int32_t)y * y);
+    if (max_spans > 0) {
+        spans[0].x1 = -half_width;
+        spans[0].x2 = half_width + 1;
+    }
+    return 1;
+}
+
 
 void common_hal_vectorio_circle_get_area(void *circle, displayio_area_t *out_area) {
     vectorio_circle_t *self = circle;
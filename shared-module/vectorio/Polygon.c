@@ -59,15 +59,55 @@ static void _clobber_points_list(vectorio_polygon_t *self, mp_obj_t points_tuple
     self->len = 2 * len;
 }
 
+static vectorio_polygon_crossing_t *_crossings(vectorio_polygon_t *self) {
+    return (vectorio_polygon_crossing_t *)(self->edges + self->len / 2);
+}
+
+// Builds the edge table used by get_spans from the points list. Horizontal edges never cross a
+// row so they are left out.
+static void _build_edge_table(vectorio_polygon_t *self) {
+    size_t point_count = self->len / 2;
+    self->edge_count = 0;
+    self->edges = gc_realloc(self->edges,
+        point_count * (sizeof(vectorio_polygon_edge_t) + sizeof(vectorio_polygon_crossing_t)), true);
+
+    for (size_t i = 0; i < point_count; i++) {
+        int16_t x1 = self->points_list[2 * i];
+        int16_t y1 = self->points_list[2 * i + 1];
+        int16_t x2 = self->points_list[(2 * i + 2) % self->len];
+        int16_t y2 = self->points_list[(2 * i + 3) % self->len];
+        if (y1 == y2) {
+            continue;
+        }
+        vectorio_polygon_edge_t edge;
+        if (y1 < y2) {
+            edge = (vectorio_polygon_edge_t) { .x_top = x1, .y_top = y1, .x_bottom = x2, .y_bottom = y2, .winding = 1 };
+        } else {
+            edge = (vectorio_polygon_edge_t) { .x_top = x2, .y_top = y2, .x_bottom = x1, .y_bottom = y1, .winding = -1 };
+        }
+        // Insertion sort by y_top. Point lists are short and only change when points are set.
+        size_t j = self->edge_count;
+        while (j > 0 && self->edges[j - 1].y_top > edge.y_top) {
+            self->edges[j] = self->edges[j - 1];
+            j--;
+        }
+        self->edges[j] = edge;
+        self->edge_count++;
+    }
+}
+
 
 
 void common_hal_vectorio_polygon_construct(vectorio_polygon_t *self, mp_obj_t points_list, uint16_t color_index) {
     VECTORIO_POLYGON_DEBUG("%p polygon_construct: ", self);
     self->points_list = NULL;
+    self->edges = NULL;
     self->len = 0;
+    self->edge_count = 0;
     self->on_dirty.obj = NULL;
     self->color_index = color_index + 1;
     _clobber_points_list(self, points_list);
+    _build_edge_table(self);
     VECTORIO_POLYGON_DEBUG("\n");
 }
 
@@ -94,7 +134,9 @@ mp_obj_t common_hal_vectorio_polygon_get_points(vectorio_polygon_t *self) {
 }
 void common_hal_vectorio_polygon_set_points(vectorio_polygon_t *self, mp_obj_t points_list) {
     VECTORIO_POLYGON_DEBUG("%p common_hal_vectorio_polygon_set_points: ", self);
+    self->edge_count = 0;
     _clobber_points_list(self, points_list);
+    _build_edge_table(self);
     if (self->on_dirty.obj != NULL) {
         self->on_dirty.event(self->on_dirty.obj);
     }
@@ -185,6 +227,70 @@ uint32_t common_hal_vectorio_polygon_get_pixel(void *obj, int16_t x, int16_t y)
     return winding_number == 0 ? 0 : self->color_index;
 }
 
+// Smallest integer >= numerator / denominator for a positive denominator.
+static int32_t _ceil_div(int32_t numerator, int32_t denominator) {
+    if (numerator >= 0) {
+        return (numerator + denominator - 1) / denominator;
+    }
+    return -(-numerator / denominator);
+}
+
+// Scanline version of get_pixel that applies the same nonzero winding rule to a whole row at
+// once. An edge counts for the pixels strictly left of where it crosses the row, so each
+// crossing is rounded up to the first pixel it no longer counts for.
+size_t common_hal_vectorio_polygon_get_spans(void *obj, int16_t y, vectorio_span_t *spans, size_t max_spans) {
+    vectorio_polygon_t *self = obj;
+    vectorio_polygon_crossing_t *crossings = _crossings(self);
+    size_t crossing_count = 0;
+    int16_t winding_number = 0;
+
+    for (uint16_t i = 0; i < self->edge_count; i++) {
+        const vectorio_polygon_edge_t *edge = &self->edges[i];
+        if (edge->y_top > y) {
+            // The rest of the edges start below this row.
+            break;
+        }
+        if (edge->y_bottom <= y) {
+            continue;
+        }
+        int32_t numerator = (y - edge->y_top) * (edge->x_bottom - edge->x_top);
+        int16_t x = edge->x_top + _ceil_div(numerator, edge->y_bottom - edge->y_top);
+
+        size_t j = crossing_count;
+        while (j > 0 && crossings[j - 1].x > x) {
+            crossings[j] = crossings[j - 1];
+            j--;
+        }
+        crossings[j].x = x;
+        crossings[j].winding = edge->winding;
+        crossing_count++;
+        winding_number += edge->winding;
+    }
+
+    // Left of every crossing, all of the edges count. Walk right dropping them one at a time.
+    size_t span_count = 0;
+    int16_t span_start = SHRT_MIN;
+    for (size_t i = 0; i < crossing_count; i++) {
+        bool was_inside = winding_number != 0;
+        winding_number -= crossings[i].winding;
+        bool inside = winding_number != 0;
+        if (inside && !was_inside) {
+            span_start = crossings[i].x;
+        } else if (!inside && was_inside && crossings[i].x > span_start) {
+            if (span_count > 0 && span_count <= max_spans && spans[span_count - 1].x2 == span_start) {
+                spans[span_count - 1].x2 = crossings[i].x;
+                continue;
+            }
+            if (span_count < max_spans) {
+                spans[span_count].x1 = span_start;
+                spans[span_count].x2 = crossings[i].x;
+            }
+            span_count++;
+        }
+    }
+    return span_count;
+}
+
 mp_obj_t common_hal_vectorio_polygon_get_draw_protocol(void *polygon) {
     vectorio_polygon_t *self = polygon;
     return self->draw_protocol_instance;
@@ -11,11 +11,31 @@
 #include "py/obj.h"
 #include "shared-module/vectorio/__init__.h"
 
+// A non-horizontal polygon edge with y_top < y_bottom. winding is +1 when the points run
+// downward along it and -1 when they run upward.
+typedef struct {
+    int16_t x_top;
+    int16_t y_top;
+    int16_t x_bottom;
+    int16_t y_bottom;
+    int8_t winding;
+} vectorio_polygon_edge_t;
+
+// Where an edge crosses a row: pixels left of x are inside the edge.
+typedef struct {
+    int16_t x;
+    int8_t winding;
+} vectorio_polygon_crossing_t;
+
 typedef struct {
     mp_obj_base_t base;
     // An int array[ x, y, ... ]
     int16_t *points_list;
+    // Edge table sorted by y_top, followed by room for one crossing per edge used while
+    // finding spans.
+    vectorio_polygon_edge_t *edges;
     uint16_t len;
+    uint16_t edge_count;
     uint16_t color_index;
     vectorio_event_t on_dirty;
     mp_obj_t draw_protocol_instance;
@@ -33,6 +33,18 @@ uint32_t common_hal_vectorio_rectangle_get_pixel(void *obj, int16_t x, int16_t y
     return 0;
 }
 
+size_t common_hal_vectorio_rectangle_get_spans(void *obj, int16_t y, vectorio_span_t *spans, size_t max_spans) {
+    vectorio_rectangle_t *self = obj;
+    if (y < 0 || y >= self->height || self->width == 0) {
+        return 0;
+    }
+    if (max_spans > 0) {
+        spans[0].x1 = 0;
+        spans[0].x2 = self->width;
+    }
+    return 1;
+}
+
 
 void common_hal_vectorio_rectangle_get_area(void *rectangle, displayio_area_t *out_area) {
     vectorio_rectangle_t *self = rectangle;
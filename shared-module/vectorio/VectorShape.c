@@ -320,6 +320,127 @@ void common_hal_vectorio_vector_shape_set_pixel_shader(vectorio_vector_shape_t *
     common_hal_vectorio_vector_shape_set_dirty(self);
 }
 
+// Most rows have one or two runs. Rows with more than this fall back to get_pixel.
+#define VECTORIO_MAX_SPANS_PER_ROW (16)
+
+static void _shade_pixel(vectorio_vector_shape_t *self, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_pixel) {
+    output_pixel->opaque = true;
+    if (self->pixel_shader == mp_const_none) {
+        output_pixel->pixel = input_pixel->pixel;
+    } else if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
+        displayio_palette_get_color(self->pixel_shader, colorspace, input_pixel, output_pixel);
+    } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
+        displayio_colorconverter_convert(self->pixel_shader, colorspace, input_pixel, output_pixel);
+    }
+}
+
+static void _write_pixel(const _displayio_colorspace_t *colorspace, uint32_t *buffer, uint16_t linestride_px, uint16_t pixel_index, uint32_t pixel) {
+    if (colorspace->depth == 16) {
+        VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x 16", pixel);
+        *(((uint16_t *)buffer) + pixel_index) = pixel;
+    } else if (colorspace->depth == 32) {
+        VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x 32", pixel);
+        *(((uint32_t *)buffer) + pixel_index) = pixel;
+    } else if (colorspace->depth == 8) {
+        VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %02x 8", pixel);
+        *(((uint8_t *)buffer) + pixel_index) = pixel;
+    } else if (colorspace->depth < 8) {
+        uint8_t pixels_per_byte = 8 / colorspace->depth;
+        // Reorder the offsets to pack multiple rows into a byte (meaning they share a column).
+        if (!colorspace->pixels_in_byte_share_row) {
+            uint16_t row = pixel_index / linestride_px;
+            uint16_t col = pixel_index % linestride_px;
+            pixel_index = col * pixels_per_byte + (row / pixels_per_byte) * pixels_per_byte * linestride_px + row % pixels_per_byte;
+        }
+        uint8_t shift = (pixel_index % pixels_per_byte) * colorspace->depth;
+        if (colorspace->reverse_pixels_in_byte) {
+            // Reverse the shift by subtracting it from the leftmost shift.
+            shift = (pixels_per_byte - 1) * colorspace->depth - shift;
+        }
+        VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %2d %d", pixel, colorspace->depth);
+        ((uint8_t *)buffer)[pixel_index / pixels_per_byte] |= pixel << shift;
+    }
+}
+
+// Fills screen row y of overlap from the shape's spans instead of testing every pixel. Returns
+// false if the row has too many spans, in which case nothing was drawn. Shapes are a single color
+// so it is shaded once into *color and reused for the rest of the area.
+static bool _fill_row_from_spans(vectorio_vector_shape_t *self, const _displayio_colorspace_t *colorspace,
+    const displayio_area_t *overlap, int16_t y, uint16_t mask_start_px, uint16_t linestride_px,
+    uint32_t *mask, uint32_t *buffer, displayio_output_pixel_t *color, bool *color_known, bool *full_coverage) {
+    const displayio_buffer_transform_t *transform = self->absolute_transform;
+    int16_t origin_x = transform->x + transform->dx * self->x;
+    int16_t origin_y = transform->y + transform->dy * self->y;
+    int16_t shape_y = y - origin_y;
+    if (transform->dy < 1) {
+        shape_y *= -1;
+    }
+
+    vectorio_span_t spans[VECTORIO_MAX_SPANS_PER_ROW];
+    size_t span_count = self->ishape.get_spans(self->ishape.shape, shape_y, spans, VECTORIO_MAX_SPANS_PER_ROW);
+    if (span_count > VECTORIO_MAX_SPANS_PER_ROW) {
+        return false;
+    }
+
+    int16_t gap_start = overlap->x1;
+    for (size_t s = 0; s < span_count; s++) {
+        // Spans run left to right in shape space which is right to left on screen when mirrored.
+        const vectorio_span_t *span;
+        int16_t x1;
+        int16_t x2;
+        if (transform->dx < 1) {
+            span = &spans[span_count - 1 - s];
+            x1 = origin_x - span->x2 + 1;
+            x2 = origin_x - span->x1 + 1;
+        } else {
+            span = &spans[s];
+            x1 = origin_x + span->x1;
+            x2 = origin_x + span->x2;
+        }
+        x1 = MAX(x1, overlap->x1);
+        x2 = MIN(x2, overlap->x2);
+        if (x1 >= x2) {
+            continue;
+        }
+        // Pixels between spans aren't covered. They only spoil coverage if nothing above drew them.
+        for (int16_t x = gap_start; x < x1 && *full_coverage; x++) {
+            uint16_t pixel_index = mask_start_px + (x - overlap->x1);
+            if ((mask[pixel_index / 32] & (1u << (pixel_index % 32))) == 0) {
+                *full_coverage = false;
+            }
+        }
+        gap_start = x2;
+
+        if (!*color_known) {
+            displayio_input_pixel_t input_pixel = { .x = x1, .y = y };
+            input_pixel.pixel = self->ishape.get_pixel(self->ishape.shape, span->x1, shape_y) - 1;
+            color->pixel = 0;
+            _shade_pixel(self, colorspace, &input_pixel, color);
+            *color_known = true;
+        }
+        if (!color->opaque) {
+            *full_coverage = false;
+        }
+        for (int16_t x = x1; x < x2; x++) {
+            uint16_t pixel_index = mask_start_px + (x - overlap->x1);
+            uint32_t *mask_doubleword = &(mask[pixel_index / 32]);
+            uint32_t mask_bit = 1u << (pixel_index % 32);
+            if ((*mask_doubleword & mask_bit) != 0) {
+                continue;
+            }
+            *mask_doubleword |= mask_bit;
+            _write_pixel(colorspace, buffer, linestride_px, pixel_index, color->pixel);
+        }
+    }
+    for (int16_t x = gap_start; x < overlap->x2 && *full_coverage; x++) {
+        uint16_t pixel_index = mask_start_px + (x - overlap->x1);
+        if ((mask[pixel_index / 32] & (1u << (pixel_index % 32))) == 0) {
+            *full_coverage = false;
+        }
+    }
+    return true;
+}
+
 bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displayio_colorspace_t *colorspace, const displayio_area_t *area, uint32_t *mask, uint32_t *buffer) {
     // Shape areas are relative to 0,0.  This will allow rotation about a known axis.
     //   The consequence is that the area reported by the shape itself is _relative_ to 0,0.
@@ -348,7 +469,6 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
 
     bool full_coverage = displayio_area_equal(area, &overlap);
 
-    uint8_t pixels_per_byte = 8 / colorspace->depth;
     VECTORIO_SHAPE_DEBUG(" xy:(%3d %3d) tform:{x:%d y:%d dx:%d dy:%d scl:%d w:%d h:%d mx:%d my:%d tr:%d}",
         self->x, self->y,
         self->absolute_transform->x, self->absolute_transform->y, self->absolute_transform->dx, self->absolute_transform->dy, self->absolute_transform->scale,
@@ -359,7 +479,7 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
     uint16_t line_dirty_offset_px = (overlap.y1 - area->y1) * linestride_px;
     uint16_t column_dirty_offset_px = overlap.x1 - area->x1;
     VECTORIO_SHAPE_DEBUG(", linestride:%3d line_offset:%3d col_offset:%3d depth:%2d ppb:%2d shape:%s",
-        linestride_px, line_dirty_offset_px, column_dirty_offset_px, colorspace->depth, pixels_per_byte, mp_obj_get_type_str(self->ishape.shape));
+        linestride_px, line_dirty_offset_px, column_dirty_offset_px, colorspace->depth, 8 / colorspace->depth, mp_obj_get_type_str(self->ishape.shape));
 
     displayio_input_pixel_t input_pixel;
     displayio_output_pixel_t output_pixel;
@@ -367,9 +487,19 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
     displayio_area_t shape_area;
     self->ishape.get_area(self->ishape.shape, &shape_area);
 
+    // Spans are rows in shape space so they only line up with screen rows when not transposed.
+    bool use_spans = self->ishape.get_spans != NULL && !self->absolute_transform->transpose_xy;
+    displayio_output_pixel_t span_color;
+    bool span_color_known = false;
+
     uint16_t mask_start_px = line_dirty_offset_px;
     for (input_pixel.y = overlap.y1; input_pixel.y < overlap.y2; ++input_pixel.y) {
         mask_start_px += column_dirty_offset_px;
+        if (use_spans && _fill_row_from_spans(self, colorspace, &overlap, input_pixel.y, mask_start_px, linestride_px,
+            mask, buffer, &span_color, &span_color_known, &full_coverage)) {
+            mask_start_px += linestride_px - column_dirty_offset_px;
+            continue;
+        }
         for (input_pixel.x = overlap.x1; input_pixel.x < overlap.x2; ++input_pixel.x) {
             // Check the mask first to see if the pixel has already been set.
             uint16_t pixel_index = mask_start_px + (input_pixel.x - overlap.x1);
@@ -406,15 +536,7 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
             } else {
                 // Pixel is not transparent. Let's pull the pixel value index down to 0-base for more error-resistant palettes.
                 input_pixel.pixel -= 1;
-                output_pixel.opaque = true;
-
-                if (self->pixel_shader == mp_const_none) {
-                    output_pixel.pixel = input_pixel.pixel;
-                } else if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
-                    displayio_palette_get_color(self->pixel_shader, colorspace, &input_pixel, &output_pixel);
-                } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
-                    displayio_colorconverter_convert(self->pixel_shader, colorspace, &input_pixel, &output_pixel);
-                }
+                _shade_pixel(self, colorspace, &input_pixel, &output_pixel);
 
                 // We double-check this to fast-path the case when a pixel is not covered by the shape & not call the color converter unnecessarily.
                 if (!output_pixel.opaque) {
@@ -423,30 +545,7 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
                 }
 
                 *mask_doubleword |= 1u << mask_bit;
-                if (colorspace->depth == 16) {
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x 16", output_pixel.pixel);
-                    *(((uint16_t *)buffer) + pixel_index) = output_pixel.pixel;
-                } else if (colorspace->depth == 32) {
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x 32", output_pixel.pixel);
-                    *(((uint32_t *)buffer) + pixel_index) = output_pixel.pixel;
-                } else if (colorspace->depth == 8) {
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %02x 8", output_pixel.pixel);
-                    *(((uint8_t *)buffer) + pixel_index) = output_pixel.pixel;
-                } else if (colorspace->depth < 8) {
-                    // Reorder the offsets to pack multiple rows into a byte (meaning they share a column).
-                    if (!colorspace->pixels_in_byte_share_row) {
-                        uint16_t row = pixel_index / linestride_px;
-                        uint16_t col = pixel_index % linestride_px;
-                        pixel_index = col * pixels_per_byte + (row / pixels_per_byte) * pixels_per_byte * linestride_px + row % pixels_per_byte;
-                    }
-                    uint8_t shift = (pixel_index % pixels_per_byte) * colorspace->depth;
-                    if (colorspace->reverse_pixels_in_byte) {
-                        // Reverse the shift by subtracting it from the leftmost shift.
-                        shift = (pixels_per_byte - 1) * colorspace->depth - shift;
-                    }
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %2d %d", output_pixel.pixel, colorspace->depth);
-                    ((uint8_t *)buffer)[pixel_index / pixels_per_byte] |= output_pixel.pixel << shift;
-                }
+                _write_pixel(colorspace, buffer, linestride_px, pixel_index, output_pixel.pixel);
             }
         }
         mask_start_px += linestride_px - column_dirty_offset_px;
@@ -0,0 +1,140 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <string.h>
+
+#include "py/runtime.h"
+#include "shared-bindings/zlib/Decompress.h"
+#include "shared-module/zlib/__init__.h"
+
+// Output is decoded this many bytes at a time. The decoder can't stop partway through a symbol
+// when the input runs out, so each step is tried on a copy of its state and backed out if it
+// needed more input than there was.
+#define STEP_SIZE (1024)
+
+void common_hal_zlib_decompress_construct(zlib_decompress_obj_t *self, mp_int_t wbits) {
+    memset(&self->decomp, 0, sizeof(self->decomp));
+    uzlib_uncompress_init(&self->decomp, NULL, 0);
+    self->wbits = wbits;
+    self->window = NULL;
+    self->window_size = 0;
+    self->input = NULL;
+    self->input_len = 0;
+    self->input_size = 0;
+    self->unused_data = mp_const_empty_bytes;
+    self->header_done = false;
+    self->eof = false;
+}
+
+bool common_hal_zlib_decompress_get_eof(zlib_decompress_obj_t *self) {
+    return self->eof;
+}
+
+mp_obj_t common_hal_zlib_decompress_get_unused_data(zlib_decompress_obj_t *self) {
+    return self->unused_data;
+}
+
+static void raise_error(int st) {
+    mp_raise_type_arg(&mp_type_ValueError, MP_OBJ_NEW_SMALL_INT(st));
+}
+
+// Parse the header and make the window for its window size. Returns false if the header
+// isn't all there yet.
+static bool parse_header(zlib_decompress_obj_t *self) {
+    self->saved = self->decomp;
+    int st = zlib_parse_header(&self->decomp, self->wbits);
+    if (self->decomp.eof) {
+        self->decomp = self->saved;
+        return false;
+    }
+    if (st < 0) {
+        raise_error(st);
+    }
+
+    // A zlib header gives the window size. Raw streams use the size from wbits, and gzip
+    // streams may use the largest.
+    int window_bits = 15;
+    if (self->wbits < 0 && self->wbits >= -15) {
+        window_bits = MAX(-self->wbits, 8);
+    } else if (self->wbits >= 0 && self->wbits < 16) {
+        window_bits = st + 8;
+    }
+    self->window_size = 1 << window_bits;
+    self->window = m_new(byte, self->window_size + STEP_SIZE);
+    self->decomp.dest_start = self->window;
+    self->decomp.dest = self->window;
+    self->header_done = true;
+    return true;
+}
+
+mp_obj_t common_hal_zlib_decompress_decompress(zlib_decompress_obj_t *self, const byte *data, size_t len, size_t max_length) {
+    if (self->eof) {
+        // Like CPython, keep anything past the end of the stream
+        if (len > 0) {
+            self->unused_data = mp_binary_op(MP_BINARY_OP_ADD, self->unused_data, mp_obj_new_bytes(data, len));
+        }
+        return mp_const_empty_bytes;
+    }
+
+    // Append the data to the input that is left over from before
+    if (self->decomp.source != NULL) {
+        self->input_len = self->decomp.source_limit - self->decomp.source;
+        memmove(self->input, self->decomp.source, self->input_len);
+    }
+    if (self->input_len + len > self->input_size) {
+        size_t new_size = MAX(self->input_len + len, self->input_size * 2);
+        self->input = m_renew(byte, self->input, self->input_size, new_size);
+        self->input_size = new_size;
+    }
+    memcpy(self->input + self->input_len, data, len);
+    self->input_len += len;
+    self->decomp.source = self->input;
+    self->decomp.source_limit = self->input + self->input_len;
+
+    vstr_t out;
+    vstr_init(&out, 0);
+    if (self->header_done || parse_header(self)) {
+        size_t step = STEP_SIZE;
+        while (step > 0 && (max_length == 0 || out.len < max_length)) {
+            if (max_length) {
+                step = MIN(step, max_length - out.len);
+            }
+            // Keep only the window of history once there is no room for the step
+            TINF_DATA *decomp = &self->decomp;
+            if (decomp->dest + step > self->window + self->window_size + STEP_SIZE) {
+                memmove(self->window, decomp->dest - self->window_size, self->window_size);
+                decomp->dest = self->window + self->window_size;
+            }
+            decomp->dest_limit = decomp->dest + step;
+
+            self->saved = *decomp;
+            int st = uzlib_uncompress_chksum(decomp);
+            if (decomp->eof) {
+                // Try a shorter step, to get as much output as the input allows
+                *decomp = self->saved;
+                step /= 2;
+                continue;
+            }
+            if (st < 0) {
+                raise_error(st);
+            }
+
+            // Grow the output geometrically
+            size_t n = decomp->dest - self->saved.dest;
+            if (out.len + n > out.alloc) {
+                vstr_hint_size(&out, MAX(n, out.alloc));
+            }
+            vstr_add_strn(&out, (const char *)self->saved.dest, n);
+
+            if (st == TINF_DONE) {
+                self->eof = true;
+                self->unused_data = mp_obj_new_bytes(decomp->source, decomp->source_limit - decomp->source);
+                break;
+            }
+        }
+    }
+    return mp_obj_new_bytes_from_vstr(&out);
+}
@@ -0,0 +1,29 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+#include "lib/uzlib/tinf.h"
+
+typedef struct {
+    mp_obj_base_t base;
+    TINF_DATA decomp;
+    // The decoder before the current step, to back out of a step that runs out of input
+    TINF_DATA saved;
+    mp_int_t wbits;
+    // The last window_size bytes of output, which later matches may copy, followed by room
+    // for the next step
+    byte *window;
+    size_t window_size;
+    // Input that has not been decompressed yet
+    byte *input;
+    size_t input_len;
+    size_t input_size;
+    mp_obj_t unused_data;
+    bool header_done;
+    bool eof;
+} zlib_decompress_obj_t;
@@ -21,6 +21,7 @@
 
 #define UZLIB_CONF_PARANOID_CHECKS (1)
 #include "lib/uzlib/tinf.h"
+#include "shared-module/zlib/__init__.h"
 
 #if 0 // print debugging info
 #define DEBUG_printf DEBUG_printf
@@ -28,49 +29,70 @@
 #define DEBUG_printf(...) (void)0
 #endif
 
-mp_obj_t common_hal_zlib_decompress(mp_obj_t data, mp_int_t wbits) {
-    mp_buffer_info_t bufinfo;
-    mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
+int zlib_parse_header(TINF_DATA *decomp, mp_int_t wbits) {
+    if (wbits >= 16) {
+        return uzlib_gzip_parse_header(decomp);
+    } else if (wbits >= 0) {
+        return uzlib_zlib_parse_header(decomp);
+    }
+    return TINF_OK;
+}
 
+static TINF_DATA *zlib_start(mp_buffer_info_t *bufinfo, mp_int_t wbits) {
     TINF_DATA *decomp = m_new_obj(TINF_DATA);
     memset(decomp, 0, sizeof(*decomp));
     DEBUG_printf("sizeof(TINF_DATA)=" UINT_FMT "\n", sizeof(*decomp));
     uzlib_uncompress_init(decomp, NULL, 0);
-    mp_uint_t dest_buf_size = (bufinfo.len + 15) & ~15;
-    byte *dest_buf = m_new(byte, dest_buf_size);
+    decomp->source = bufinfo->buf;
+    decomp->source_limit = (unsigned char *)bufinfo->buf + bufinfo->len;
 
-    decomp->dest = dest_buf;
-    decomp->dest_limit = dest_buf + dest_buf_size;
-    DEBUG_printf("zlib: Initial out buffer: " UINT_FMT " bytes\n", decomp->destSize);
-    decomp->source = bufinfo.buf;
-    decomp->source_limit = (unsigned char *)bufinfo.buf + bufinfo.len;
-    int st;
+    int st = zlib_parse_header(decomp, wbits);
+    if (st < 0) {
+        mp_raise_type_arg(&mp_type_ValueError, MP_OBJ_NEW_SMALL_INT(st));
+    }
+    return decomp;
+}
 
-    if (wbits >= 16) {
-        st = uzlib_gzip_parse_header(decomp);
-        if (st < 0) {
-            goto error;
-        }
-    } else if (wbits >= 0) {
-        st = uzlib_zlib_parse_header(decomp);
-        if (st < 0) {
-            goto error;
+mp_obj_t common_hal_zlib_decompress(mp_obj_t data, mp_int_t wbits, mp_int_t bufsize) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
+    TINF_DATA *decomp = zlib_start(&bufinfo, wbits);
+
+    // Start with room for the whole output if its size is known, from bufsize or else from
+    // the end of a gzip stream. DEFLATE expands data at most 1032 times, so a larger size
+    // there is corrupt and is ignored.
+    size_t dest_buf_size = bufsize;
+    if (dest_buf_size == 0 && wbits >= 16 && bufinfo.len >= 18) {
+        const byte *isize = (const byte *)bufinfo.buf + bufinfo.len - 4;
+        dest_buf_size = isize[0] | (isize[1] << 8) | (isize[2] << 16) | ((uint32_t)isize[3] << 24);
+        if (dest_buf_size / 1032 > bufinfo.len) {
+            dest_buf_size = 0;
         }
     }
+    if (dest_buf_size == 0) {
+        dest_buf_size = bufinfo.len * 2;
+    }
+    // Leave a spare byte, so that the end of the stream is found without growing the buffer
+    dest_buf_size = (dest_buf_size + 16) & ~15;
+    byte *dest_buf = m_new(byte, dest_buf_size);
 
-    while (1) {
-        st = uzlib_uncompress_chksum(decomp);
-        if (st < 0) {
-            goto error;
-        }
-        if (st == TINF_DONE) {
-            break;
-        }
+    decomp->dest_start = dest_buf;
+    decomp->dest = dest_buf;
+    decomp->dest_limit = dest_buf + dest_buf_size;
+    DEBUG_printf("zlib: Initial out buffer: " UINT_FMT " bytes\n", dest_buf_size);
+
+    int st;
+    // Double the buffer each time it fills, so that large outputs take few reallocations
+    while ((st = uzlib_uncompress_chksum(decomp)) == TINF_OK) {
         size_t offset = decomp->dest - dest_buf;
-        dest_buf = m_renew(byte, dest_buf, dest_buf_size, dest_buf_size + 256);
-        dest_buf_size += 256;
+        dest_buf = m_renew(byte, dest_buf, dest_buf_size, dest_buf_size * 2);
+        dest_buf_size *= 2;
+        decomp->dest_start = dest_buf;
         decomp->dest = dest_buf + offset;
-        decomp->dest_limit = dest_buf + offset + 256;
+        decomp->dest_limit = dest_buf + dest_buf_size;
+    }
+    if (st < 0) {
+        mp_raise_type_arg(&mp_type_ValueError, MP_OBJ_NEW_SMALL_INT(st));
     }
 
     mp_uint_t final_sz = decomp->dest - dest_buf;
@@ -79,7 +101,38 @@ mp_obj_t common_hal_zlib_decompress(mp_obj_t data, mp_int_t wbits) {
     mp_obj_t res = mp_obj_new_bytearray_by_ref(final_sz, dest_buf);
     m_del_obj(TINF_DATA, decomp);
     return res;
+}
 
-error:
-    mp_raise_type_arg(&mp_type_ValueError, MP_OBJ_NEW_SMALL_INT(st));
+mp_int_t common_hal_zlib_decompress_into(mp_obj_t data, mp_obj_t buffer, mp_int_t wbits) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
+    mp_buffer_info_t dest_bufinfo;
+    mp_get_buffer_raise(buffer, &dest_bufinfo, MP_BUFFER_WRITE);
+    TINF_DATA *decomp = zlib_start(&bufinfo, wbits);
+
+    decomp->dest_start = dest_bufinfo.buf;
+    decomp->dest = dest_bufinfo.buf;
+    decomp->dest_limit = (byte *)dest_bufinfo.buf + dest_bufinfo.len;
+    int st = uzlib_uncompress_chksum(decomp);
+    mp_int_t len = decomp->dest - (byte *)dest_bufinfo.buf;
+    if (st == TINF_OK) {
+        // The buffer is full, but the stream may end right here. Unless a match is still being
+        // copied, decode one more step into a spare byte to find out: with no history before
+        // it, the step only succeeds for a literal or the end of the stream.
+        byte spare;
+        if (decomp->btype == 0 || decomp->curlen == 0) {
+            decomp->dest_start = &spare;
+            decomp->dest = &spare;
+            decomp->dest_limit = &spare + 1;
+            st = uzlib_uncompress_chksum(decomp);
+        }
+        if (st != TINF_DONE) {
+            mp_raise_ValueError(MP_ERROR_TEXT("buffer too small"));
+        }
+    }
+    if (st < 0) {
+        mp_raise_type_arg(&mp_type_ValueError, MP_OBJ_NEW_SMALL_INT(st));
+    }
+    m_del_obj(TINF_DATA, decomp);
+    return len;
 }
@@ -0,0 +1,14 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+#include "lib/uzlib/tinf.h"
+
+// Parse the gzip or zlib header that wbits calls for, if any. Returns a negative TINF error
+// if the header is bad.
+int zlib_parse_header(TINF_DATA *decomp, mp_int_t wbits);
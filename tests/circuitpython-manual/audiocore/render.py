@@ -0,0 +1,76 @@
+# Render the canonical audio graphs from perf_bench as fast as possible with audiocore.render
+# and report throughput, get_buffer latency percentiles and real-time headroom.
+#
+# Build the unix coverage port, then from the tests directory run
+#     ../ports/unix/build-coverage/micropython circuitpython-manual/audiocore/render.py [graph] [wav]
+# where graph is one of synthio, mixer or mp3 (default: all of them). If a wav filename is
+# given, the rendered audio of the last graph is written there so it can be listened to.
+
+import sys
+
+sys.path.insert(0, "perf_bench")
+
+import audiocore
+
+SECONDS = 10
+
+
+def synthio_graph():
+    import module_audio_synthio
+
+    return module_audio_synthio.graph(12)
+
+
+def mixer_graph():
+    import module_audio_mixer
+
+    return module_audio_mixer.graph(module_audio_mixer.VOICES)
+
+
+def mp3_graph():
+    import module_audio_mp3
+
+    return module_audio_mp3.graph()
+
+
+GRAPHS = {"synthio": synthio_graph, "mixer": mixer_graph, "mp3": mp3_graph}
+
+
+def percentile(values, fraction):
+    return values[min(len(values) - 1, int(len(values) * fraction))]
+
+
+def report(name, sample, wav=None):
+    rate = sample.sample_rate
+    file = open(wav, "wb") if wav else None
+    frames, latencies = audiocore.render(sample, rate * SECONDS, file=file)
+    if file:
+        file.close()
+    latencies = sorted(latencies)
+    elapsed = sum(latencies) or 1
+    buffer_us = 1e6 * frames / len(latencies) / rate
+    print(
+        "%-8s %10d frames/s %7.1fx real time  get_buffer p50 %4dus p99 %4dus max %5dus"
+        " (buffer %.0fus, worst case %.1fx)"
+        % (
+            name,
+            frames * 1e6 / elapsed,
+            frames * 1e6 / rate / elapsed,
+            percentile(latencies, 0.5),
+            percentile(latencies, 0.99),
+            latencies[-1],
+            buffer_us,
+            buffer_us / max(1, latencies[-1]),
+        )
+    )
+
+
+names = sys.argv[1:2] or ("synthio", "mixer", "mp3")
+wav = sys.argv[2] if len(sys.argv) > 2 else None
+for name in names:
+    try:
+        sample = GRAPHS[name]()
+    except (ImportError, SystemExit):
+        print("%-8s skipped" % name)
+        continue
+    report(name, sample, wav)
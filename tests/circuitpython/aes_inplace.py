@@ -0,0 +1,60 @@
+import aesio
+from binascii import hexlify, unhexlify
+
+# Test vectors from NIST Special Publication 800-38A, 2001 edition
+plaintext = unhexlify(
+    "6bc1bee22e409f96e93d7e117393172a"
+    "ae2d8a571e03ac9c9eb76fac45af8e51"
+    "30c81c46a35ce411e5fbc1191a0a52ef"
+    "f69f2445df4f9b17ad2b417be66c3710"
+)
+
+print("CBC-AES192")
+key = unhexlify("8e73b0f7da0e6452c810f32b809079e562f8ead2522c6b7b")
+iv = unhexlify("000102030405060708090a0b0c0d0e0f")
+buf = bytearray(plaintext)
+aesio.AES(key, aesio.MODE_CBC, iv).encrypt_into(buf, buf)
+for i in range(0, len(buf), 16):
+    print(str(hexlify(buf[i : i + 16]), ""))
+# In pieces, through memoryview slices of one buffer
+cipher = aesio.AES(key, aesio.MODE_CBC, iv)
+mv = memoryview(buf)
+cipher.decrypt_into(mv[:16], mv[:16])
+cipher.decrypt_into(mv[16:], mv[16:])
+print(buf == plaintext)
+print()
+
+print("CTR-AES256")
+key = unhexlify("603deb1015ca71be2b73aef0857d77811f352c073b6108d72d9810a30914dff4")
+counter = unhexlify("f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff")
+buf = bytearray(plaintext)
+aesio.AES(key, aesio.MODE_CTR, counter).encrypt_into(buf, buf)
+for i in range(0, len(buf), 16):
+    print(str(hexlify(buf[i : i + 16]), ""))
+# Odd lengths and blocks split across calls
+expected = bytes(buf)
+for first in (16, 32, 48):
+    cipher = aesio.AES(key, aesio.MODE_CTR, counter)
+    out = bytearray(len(plaintext))
+    cipher.encrypt_into(plaintext[:first], memoryview(out)[:first])
+    cipher.encrypt_into(plaintext[first:], memoryview(out)[first:])
+    print(first, out == expected)
+out = bytearray(37)
+aesio.AES(key, aesio.MODE_CTR, counter).encrypt_into(plaintext[:37], out)
+print(out == expected[:37])
+print()
+
+print("overlap")
+# The source and destination are overlapping slices of the same buffer
+key = unhexlify("2b7e151628aed2a6abf7158809cf4f3c")
+for shift in (-5, 5, 16):
+    buf = bytearray(100)
+    src = 20 if shift < 0 else 10
+    buf[src : src + 64] = plaintext
+    mv = memoryview(buf)
+    aesio.AES(key, aesio.MODE_CTR, counter).encrypt_into(
+        mv[src : src + 64], mv[src + shift : src + shift + 64]
+    )
+    out = bytearray(64)
+    aesio.AES(key, aesio.MODE_CTR, counter).encrypt_into(plaintext, out)
+    print(shift, buf[src + shift : src + shift + 64] == out)
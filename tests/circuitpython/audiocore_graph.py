@@ -0,0 +1,113 @@
+import array
+import audiocore
+
+
+def raw(data, typecode="h", **kwargs):
+    return audiocore.RawSample(array.array(typecode, data), sample_rate=8000, **kwargs)
+
+
+def play(graph, blocks=1):
+    for i in range(blocks):
+        result, buffer = audiocore.get_buffer(graph)
+        print(result, list(buffer))
+
+
+ramp = list(range(0, 8000, 1000))
+
+# An empty graph plays silence and never ends
+graph = audiocore.Graph(block_size=16)
+print(graph.output, graph.buffer_count, graph.sample_rate)
+play(graph)
+
+# A single source, read straight from the sample, then padded with silence once it ends
+graph = audiocore.Graph(block_size=16)
+source = graph.source(raw(ramp * 3))
+graph.output = source
+print(graph.output is source, graph.buffer_count)
+play(graph, 2)
+print(source.playing)
+
+# A looping source carries on over the end of the sample
+graph = audiocore.Graph(block_size=16)
+graph.output = graph.source(raw(ramp + [-1]), loop=True)
+play(graph)
+
+# Gains in a chain share their input's buffer
+graph = audiocore.Graph(block_size=16)
+node = graph.source(raw(ramp * 2, channel_count=1))
+node = graph.gain(node, 0.5)
+node = graph.gain(node, 0.5)
+graph.output = graph.gain(node)
+print(graph.buffer_count)
+play(graph)
+
+# Mixing saturates and buffers are reused once the nodes that read them have run
+graph = audiocore.Graph(block_size=16)
+loud = graph.source(raw([30000, -30000] * 8), loop=True)
+quiet = graph.source(raw([3000, -3000] * 8), loop=True)
+graph.output = graph.mix((loud, quiet, graph.gain(quiet, 0.25)))
+print(graph.buffer_count)
+play(graph)
+graph.output.level = 0.5
+play(graph)
+print(graph.output.level)
+
+# A wide graph needs no more buffers than it has nodes that are waiting to be read
+graph = audiocore.Graph(block_size=16)
+mixes = []
+for i in range(4):
+    a = graph.gain(graph.source(raw(ramp * 2)), 0.5)
+    b = graph.gain(graph.source(raw(ramp * 2)), 0.5)
+    mixes.append(graph.mix((a, b)))
+graph.output = graph.mix(mixes, level=0.25)
+print(graph.buffer_count)
+play(graph)
+
+# Samples in another format are converted as they play
+graph = audiocore.Graph(block_size=16, channel_count=2)
+graph.output = graph.source(audiocore.RawSample(array.array("B", [128, 192, 0, 255]), sample_rate=4000))
+play(graph)
+
+# The graph ends when all of its sources have ended, and reset starts them over
+graph = audiocore.Graph(block_size=16)
+a = graph.source(raw([100] * 20))
+b = graph.source(raw([10] * 4))
+graph.output = graph.mix((a, b))
+play(graph, 2)
+print(a.playing, b.playing, graph.output.playing)
+audiocore.reset_buffer(graph)
+play(graph)
+
+# The graph is itself a sample
+graph = audiocore.Graph(block_size=16)
+graph.output = graph.source(raw(ramp * 2))
+outer = audiocore.Graph(block_size=16)
+outer.output = outer.gain(outer.source(graph), 0.5)
+play(outer)
+
+# Errors
+other = audiocore.Graph()
+# Nothing plays inner until graph's output is set to this node
+inner = audiocore.Graph()
+inner_source = graph.source(inner)
+inner.output = inner.source(graph)
+for f in (
+    lambda: graph.gain(other.source(raw(ramp))),
+    lambda: setattr(graph, "output", other.source(raw(ramp))),
+    lambda: graph.mix(()),
+    lambda: graph.gain(source, 2),
+    lambda: graph.gain(ramp),
+    lambda: audiocore.Graph(channel_count=3),
+    lambda: outer.source(outer),
+    lambda: graph.source(outer),
+    lambda: setattr(graph, "output", inner_source),
+):
+    try:
+        f()
+    except Exception as e:
+        print(type(e).__name__, e)
+graph.deinit()
+try:
+    graph.output
+except Exception as e:
+    print(type(e).__name__, e)
@@ -0,0 +1,46 @@
+import array
+import audiocore
+import audiomixer
+
+
+def mix(sample, **kwargs):
+    mixer = audiomixer.Mixer(voice_count=1, buffer_size=16, sample_rate=8000, **kwargs)
+    mixer.voice[0].play(sample, loop=True)
+    print(list(audiocore.get_buffer(mixer)[1]))
+
+
+# The format can be given for a buffer that has no type, such as bytes
+data = bytes([0, 0x80, 0xFF, 0x7F, 0x01, 0x00, 0x00, 0x40])
+for bits_per_sample, samples_signed in ((8, False), (8, True), (16, True), (16, False)):
+    sample = audiocore.RawSample(
+        data, bits_per_sample=bits_per_sample, samples_signed=samples_signed
+    )
+    print(audiocore.get_structure(sample))
+    mix(sample, channel_count=1)
+
+# It overrides the type of an array
+sample = audiocore.RawSample(array.array("h", [256, -256]), samples_signed=False)
+print(audiocore.get_structure(sample))
+
+# A memoryview of part of a bank of samples is played in place, with the format converted as it
+# is mixed
+bank = bytes(range(0, 256, 8))
+view = memoryview(bank)[8:16]
+sample = audiocore.RawSample(view, channel_count=2)
+del bank
+mix(sample, channel_count=1)
+mix(sample, channel_count=2)
+mix(sample, channel_count=2, bits_per_sample=8, samples_signed=False)
+mix(audiocore.RawSample(view), channel_count=2)
+
+for kwargs in (dict(bits_per_sample=12), dict(bits_per_sample=16, single_buffer=False)):
+    try:
+        audiocore.RawSample(data[1:], **kwargs)
+    except ValueError as e:
+        print("ValueError", e)
+
+# 16-bit samples must be aligned
+try:
+    audiocore.RawSample(memoryview(data)[1:], bits_per_sample=16)
+except ValueError as e:
+    print("ValueError")
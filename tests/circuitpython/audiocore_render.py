@@ -0,0 +1,36 @@
+import array
+import io
+import struct
+import audiocore
+import synthio
+
+# A RawSample stops after its one buffer, even when more frames are asked for.
+sample = audiocore.RawSample(array.array("h", range(-500, 500, 10)), sample_rate=8000)
+frames, latencies = audiocore.render(sample, 1000)
+print(frames, len(latencies))
+frames, latencies = audiocore.render(sample, 1 << 30)
+print(frames, len(latencies))
+
+# Rendering to a stream writes a WAV file with the lengths filled in.
+f = io.BytesIO()
+frames, latencies = audiocore.render(sample, 30, file=f)
+data = f.getvalue()
+print(frames, len(data))
+print(data[:4], data[8:16], data[36:40])
+print(struct.unpack("<IIHHIIHHI", data[4:8] + data[16:36] + data[40:44]))
+print(struct.unpack("<5h", data[44:54]))
+
+# WAV stores 8-bit samples unsigned and 16-bit samples signed, so other samples are converted.
+for typecode in "bBhH":
+    sample = audiocore.RawSample(array.array(typecode, [0, 1, 100]), sample_rate=8000)
+    f = io.BytesIO()
+    audiocore.render(sample, 3, file=f)
+    data = f.getvalue()
+    print(typecode, data[34], data[44:])
+
+# A synthesizer never finishes, so the frame count bounds the render.
+synth = synthio.Synthesizer(sample_rate=8000, channel_count=2)
+synth.press(60)
+f = io.BytesIO()
+frames, latencies = audiocore.render(synth, 1000, file=f)
+print(frames, len(latencies), len(f.getvalue()))
@@ -0,0 +1,77 @@
+import array
+import io
+import audiocore
+
+# Build a WAV file in memory by rendering a ramp.
+ramp = audiocore.RawSample(array.array("h", range(-20000, 20000, 37)), sample_rate=8000)
+f = io.BytesIO()
+audiocore.render(ramp, 2000, file=f)
+wav = f.getvalue()
+print(len(wav))
+
+
+def play(sample):
+    out = io.BytesIO()
+    frames, latencies = audiocore.render(sample, 5000, file=out)
+    return frames, out.getvalue()[44:] == wav[44:]
+
+
+# A file system that is busy for two reads out of three once playback starts. Busy reads return
+# None, which the stream protocol reports as EAGAIN. It can't seek.
+class BusyFile(io.IOBase):
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+        self.busy = False
+        self.reads = 0
+
+    def readinto(self, buf):
+        self.reads += 1
+        if self.busy and self.reads % 3:
+            return None
+        n = min(len(buf), len(self.data) - self.pos)
+        buf[:n] = self.data[self.pos : self.pos + n]
+        self.pos += n
+        return n
+
+    def ioctl(self, req, arg):
+        return -22
+
+
+for prefetch in (0, 1, 2, 8):
+    sample = audiocore.WaveFile(io.BytesIO(wav), prefetch=prefetch)
+    audiocore.reset_buffer(sample)
+    print(prefetch, play(sample), sample.underruns)
+
+# Replaying seeks back to the data.
+audiocore.reset_buffer(sample)
+print(play(sample), sample.underruns)
+
+# A stream with nothing to give yet gets a moment of silence rather than a wait, and its data
+# follows once it comes. Python streams are only read on demand, whatever the prefetch.
+for prefetch in (0, 2):
+    busy = BusyFile(wav)
+    sample = audiocore.WaveFile(busy, prefetch=prefetch)
+    busy.busy = True
+    audiocore.reset_buffer(sample)
+    out = io.BytesIO()
+    audiocore.render(sample, 5000, file=out)
+    played = [s for s in array.array("h", out.getvalue()[44:]) if s]
+    print(prefetch, played == list(array.array("h", wav[44:])), sample.underruns > 0)
+
+# A provided buffer of 8 to 1024 bytes is split into prefetch + 2 slots, or fewer when the
+# slots would be under 4 bytes.
+for buffer, prefetch in ((bytearray(20), 3), (bytearray(8), 2), (bytearray(1024), 0)):
+    sample = audiocore.WaveFile(io.BytesIO(wav), buffer, prefetch=prefetch)
+    audiocore.reset_buffer(sample)
+    print(play(sample), audiocore.get_structure(sample))
+for buffer, prefetch in ((bytearray(7), 0), (bytearray(1025), 2), (bytearray(64), 9)):
+    try:
+        audiocore.WaveFile(io.BytesIO(wav), buffer, prefetch=prefetch)
+    except ValueError as e:
+        print("ValueError", e)
+
+try:
+    audiocore.WaveFile(io.StringIO("RIFF"))
+except TypeError as e:
+    print("TypeError", e)
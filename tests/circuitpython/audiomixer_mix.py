@@ -0,0 +1,42 @@
+import array
+import audiocore
+import audiomixer
+
+
+def mix(typecode, voices, levels=None, **kwargs):
+    mixer = audiomixer.Mixer(voice_count=len(voices), buffer_size=16, sample_rate=8000, **kwargs)
+    for i, samples in enumerate(voices):
+        sample = audiocore.RawSample(
+            array.array(typecode, samples), channel_count=kwargs.get("channel_count", 2)
+        )
+        if levels:
+            mixer.voice[i].level = levels[i]
+        mixer.voice[i].play(sample, loop=True)
+    print(list(audiocore.get_buffer(mixer)[1]))
+
+
+# Voices are summed before saturating, so the order of loud voices doesn't matter.
+loud = [30000, -30000, 20000, 32767]
+quiet = [-25000, 30000, -25000, 0]
+mix("h", [loud, loud, quiet])
+mix("h", [quiet, loud, loud])
+mix("h", [loud, quiet, loud])
+
+# Per-voice levels
+mix("h", [[1000, -1000, 32767, -32768], [100, 200, 300, 400]], levels=[0.5, 0.25])
+
+# Unsigned and 8-bit samples
+mix("H", [[0, 65535, 32768, 40000], [65535, 65535, 32768, 0]], samples_signed=False)
+mix("b", [[100, -100, 127, -128], [100, -100, -27, 28]], bits_per_sample=8)
+mix(
+    "B",
+    [[228, 28, 255, 0], [228, 28, 101, 156]],
+    bits_per_sample=8,
+    samples_signed=False,
+)
+
+# A voice that ends without looping stops contributing
+mixer = audiomixer.Mixer(voice_count=2, buffer_size=32, channel_count=1, sample_rate=8000)
+mixer.voice[0].play(audiocore.RawSample(array.array("h", [1000] * 3)))
+mixer.voice[1].play(audiocore.RawSample(array.array("h", [1, 2, 3, 4])), loop=True)
+print(list(audiocore.get_buffer(mixer)[1]), mixer.voice[0].playing)
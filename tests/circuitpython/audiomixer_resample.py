@@ -0,0 +1,34 @@
+import array
+import audiocore
+import audiomixer
+
+
+def play(mixer_kwargs, typecode, data, sample_rate, channel_count, loop=False, buffers=1):
+    mixer = audiomixer.Mixer(voice_count=1, buffer_size=48, sample_rate=8000, **mixer_kwargs)
+    sample = audiocore.RawSample(
+        array.array(typecode, data), channel_count=channel_count, sample_rate=sample_rate
+    )
+    mixer.voice[0].play(sample, loop=loop)
+    for i in range(buffers):
+        print(list(audiocore.get_buffer(mixer)[1]))
+    print(mixer.voice[0].playing)
+
+
+# Upsampling interpolates between source frames and holds the last one
+play(dict(channel_count=1), "h", [0, 1000, 2000, 3000, 4000, 5000], 4000, 1)
+# Downsampling
+play(dict(channel_count=1), "h", [i * 1000 for i in range(16)], 16000, 1)
+# Unsigned 8-bit stereo to signed 16-bit stereo, looping
+play(dict(channel_count=2), "B", [128, 0, 255, 128], 8000, 2, loop=True, buffers=2)
+# Stereo to mono averages the channels
+play(dict(channel_count=1), "h", [100, 300, -1000, -2000], 8000, 2)
+# Mono to stereo, signed 16-bit to unsigned 8-bit
+play(
+    dict(channel_count=2, bits_per_sample=8, samples_signed=False),
+    "h",
+    [0, 1000, -1000, 32767],
+    4000,
+    1,
+)
+# An empty looping sample stops instead of hanging
+play(dict(channel_count=1), "h", [], 4000, 1, loop=True)
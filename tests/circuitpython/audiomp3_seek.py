@@ -0,0 +1,61 @@
+import io
+import audiocore
+import audiomp3
+
+with open("../circuitpython-manual/audiocore/jeplayer-splash-44100-stereo.mp3", "rb") as f:
+    data = f.read()
+
+# An ID3 tag longer than the input buffer, which is skipped by seeking past it
+id3 = b"ID3\x03\x00\x00\x00\x00\x20\x00" + bytes(4096)
+
+
+# Frames are compared by the hash of their samples
+def frames(decoder, count=1 << 30):
+    result = []
+    while len(result) < count:
+        status, buffer = audiocore.get_buffer(decoder)
+        if status == 2 or len(buffer) == 0:
+            break
+        result.append(hash(bytes(buffer)))
+        if status == 0:
+            break
+    return result
+
+
+decoder = audiomp3.MP3Decoder(io.BytesIO(id3 + data))
+reference = frames(decoder)
+frame_samples = decoder.samples_decoded // len(reference) // decoder.channel_count
+print(len(reference), frame_samples)
+silence = hash(bytes(frame_samples * decoder.channel_count * 2))
+
+# Looping goes straight back to the first frame
+audiocore.reset_buffer(decoder)
+print(frames(decoder) == reference)
+
+# Each of these frames takes the start of its data from the bit reservoir, which a seek empties,
+# so it plays as silence. The frames after it can differ too, because the decoder's filter state
+# from before the seek doesn't carry over. The frames after them match.
+for frame in (100, 5, 31, 32, 33, 64, 150):
+    decoder.seek(frame * frame_samples + 7)
+    samples = decoder.samples_decoded
+    buffers = frames(decoder, 5)
+    print(frame, samples, buffers[0] == silence, buffers[3:] == reference[frame + 3 : frame + 5])
+
+# Back to the start. The first frame is the encoder's Info frame, which uses no reservoir.
+decoder.seek(0)
+print(decoder.samples_decoded, frames(decoder, 5)[3:] == reference[3:5])
+
+# Seeking ahead of what has been played, in a decoder that hasn't played anything
+decoder = audiomp3.MP3Decoder(io.BytesIO(data))
+decoder.seek(120 * frame_samples)
+buffers = frames(decoder, 5)
+print(buffers[0] == silence, buffers[3:] == reference[123:125])
+
+# Seeking past the end
+decoder.seek(1 << 24)
+print(decoder.samples_decoded, frames(decoder))
+
+try:
+    decoder.seek(-1)
+except ValueError as e:
+    print("ValueError", e)
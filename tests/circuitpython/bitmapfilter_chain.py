@@ -0,0 +1,126 @@
+from displayio import Bitmap, Palette
+import bitmapfilter
+
+
+def noise_bitmap(w, h, seed):
+    b = Bitmap(w, h, 65536)
+    for y in range(h):
+        for x in range(w):
+            seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF
+            b[x, y] = seed >> 8 & 0xFFFF
+    return b
+
+
+def make_quadrant_bitmap(w, h):
+    b = Bitmap(w, h, 1)
+    for i in range(h):
+        for j in range(w):
+            b[j, i] = (i < h // 2) ^ (j < w // 2)
+    return b
+
+
+def same(a, b):
+    for y in range(a.height):
+        for x in range(a.width):
+            if a[x, y] != b[x, y]:
+                return False
+    return True
+
+
+def swap(p):
+    return (p >> 8) | ((p & 0xFF) << 8)
+
+
+# The unscaled convolution of each channel, with the edges extended, clipped as morph does
+def reference_morph(b, weights, mask=None):
+    n = int(len(weights) ** 0.5)
+    k = n // 2
+    out = Bitmap(b.width, b.height, 65536)
+    for y in range(b.height):
+        for x in range(b.width):
+            if mask and mask[x, y]:
+                out[x, y] = b[x, y]
+                continue
+            acc = [0, 0, 0]
+            for j in range(n):
+                yy = min(max(y + j - k, 0), b.height - 1)
+                for i in range(n):
+                    xx = min(max(x + i - k, 0), b.width - 1)
+                    p = swap(b[xx, yy])
+                    w = weights[j * n + i]
+                    acc[0] += w * (p >> 11)
+                    acc[1] += w * (p >> 5 & 0x3F)
+                    acc[2] += w * (p & 0x1F)
+            r = min(max(acc[0], 0), 31)
+            g = min(max(acc[1], 0), 63)
+            bl = min(max(acc[2], 0), 31)
+            out[x, y] = swap(r << 11 | g << 5 | bl)
+    return out
+
+
+print("morph")
+# Kernels that can be split into a row and a column pass, and ones that can't
+for n, weights in enumerate((
+    (0, 0, 0, 0, 1, 0, 0, 0, 0),
+    (0, 1, 0, 0, 1, 0, 0, 1, 0),
+    (1, -1, 1, -2, 2, -2, 1, -1, 1),
+    (0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0),
+    (0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0),
+    (-1, -1, -1, -1, 9, -1, -1, -1, -1),
+)):
+    for w, h in ((1, 1), (2, 6), (9, 7)):
+        for mask in (None, make_quadrant_bitmap(w, h)):
+            b = noise_bitmap(w, h, w * 10 + h)
+            expected = reference_morph(b, weights, mask)
+            bitmapfilter.morph(b, weights, mul=1, mask=mask)
+            print(n, w, h, mask is not None, same(b, expected))
+
+print("chain")
+palette = Palette(256)
+for i in range(256):
+    palette[i] = i * 0x010203 & 0xFFFFFF
+mixer = bitmapfilter.ChannelMixerOffset(0.3, 0.7, -0.2, 0.1, 0.4, 0.5, 0.2, -0.05, 0.1, 0.2, 0.9, 0.02)
+
+
+def gamma(x):
+    return x * x
+
+
+def invert(x):
+    return 1 - x
+
+
+for w, h in ((1, 1), (70, 3)):
+    for mask in (None, make_quadrant_bitmap(w, h)):
+        b = noise_bitmap(w, h, w + h)
+        c = noise_bitmap(w, h, w + h)
+        bitmapfilter.mix(b, mixer, mask=mask)
+        bitmapfilter.solarize(b, mask=mask)
+        bitmapfilter.lookup(b, (gamma, invert, gamma), mask=mask)
+        result = bitmapfilter.chain(
+            c,
+            [
+                (bitmapfilter.mix, mixer),
+                (bitmapfilter.solarize,),
+                (bitmapfilter.lookup, (gamma, invert, gamma)),
+            ],
+            mask=mask,
+        )
+        print(w, h, mask is not None, result is c, same(b, c))
+        bitmapfilter.false_color(b, palette, mask=mask)
+        bitmapfilter.chain(c, ((bitmapfilter.false_color, palette),), mask)
+        print(w, h, mask is not None, same(b, c))
+
+b = noise_bitmap(4, 4, 1)
+bitmapfilter.chain(b, ())
+print(same(b, noise_bitmap(4, 4, 1)))
+for filters in (
+    ((bitmapfilter.morph, (1,)),),
+    ((bitmapfilter.mix,),),
+    ((bitmapfilter.solarize, 0.5, 0.5),),
+    ((),),
+):
+    try:
+        bitmapfilter.chain(b, filters)
+    except ValueError as e:
+        print("ValueError", e)
@@ -0,0 +1,40 @@
+import displayio
+import bitmaptools
+
+
+def dump(bitmap):
+    for y in range(bitmap.height):
+        print("".join("%x" % (bitmap[x, y] % 16) for x in range(bitmap.width)))
+    print()
+
+
+def pattern(value_count):
+    bitmap = displayio.Bitmap(19, 5, value_count)
+    for y in range(bitmap.height):
+        for x in range(bitmap.width):
+            bitmap[x, y] = (x + 3 * y) % min(value_count, 16)
+    return bitmap
+
+
+for value_count in (2, 4, 16, 256, 65536):
+    print("value_count", value_count)
+
+    # Blit a bitmap onto itself in every direction. Each source pixel must be read before it
+    # is overwritten.
+    for x, y, x1, y1 in ((3, 0, 0, 0), (0, 0, 5, 0), (2, 1, 0, 0), (0, 0, 1, 2), (9, 0, 1, 1)):
+        bitmap = pattern(value_count)
+        bitmaptools.blit(bitmap, bitmap, x, y, x1=x1, y1=y1, x2=x1 + 12, y2=y1 + 3)
+        dump(bitmap)
+
+    # Skipped source and destination pixels, clipped at the right and bottom edges.
+    bitmap = pattern(value_count)
+    source = pattern(value_count)
+    bitmaptools.blit(bitmap, source, 11, 2, x1=1, y1=0, x2=15, y2=5, skip_source_index=1)
+    dump(bitmap)
+    bitmaptools.blit(bitmap, source, 1, 1, x1=0, y1=1, x2=9, y2=4, skip_dest_index=0)
+    dump(bitmap)
+
+# Smaller source depth into a larger destination depth.
+bitmap = pattern(65536)
+bitmaptools.blit(bitmap, pattern(4), 2, 1, skip_source_index=3)
+dump(bitmap)
@@ -0,0 +1,71 @@
+import bitmaptools
+import displayio
+
+Colorspace = displayio.Colorspace
+DitherAlgorithm = bitmaptools.DitherAlgorithm
+
+
+def gradient(width, height):
+    b = displayio.Bitmap(width, height, 65536)
+    for y in range(height):
+        for x in range(width):
+            g = (x * 63 + y * 17) // (width + 8) & 63
+            b[x, y] = (g >> 1) << 11 | g << 5 | (x * 3 + y) & 31
+    return b
+
+
+def show(b):
+    for y in range(b.height):
+        print("".join("#" if b[x, y] else "." for x in range(b.width)))
+    print()
+
+
+src = gradient(24, 6)
+for algorithm in (DitherAlgorithm.Atkinson, DitherAlgorithm.FloydStenberg, DitherAlgorithm.Bayer):
+    print(algorithm)
+    dst = displayio.Bitmap(src.width, src.height, 2)
+    bitmaptools.dither(dst, src, Colorspace.RGB565, algorithm)
+    show(dst)
+
+# 1-bit output is packed 32 pixels at a time; rows that end part way through a word, or
+# just past one, come out the same as 16-bit output
+for width in (1, 31, 32, 33, 70):
+    src = gradient(width, 5)
+    for algorithm in (DitherAlgorithm.Atkinson, DitherAlgorithm.FloydStenberg, DitherAlgorithm.Bayer):
+        d1 = displayio.Bitmap(width, 5, 2)
+        d16 = displayio.Bitmap(width, 5, 65536)
+        bitmaptools.dither(d1, src, Colorspace.RGB565, algorithm)
+        bitmaptools.dither(d16, src, Colorspace.RGB565, algorithm)
+        same = all(d1[x, y] == (d16[x, y] != 0) for y in range(5) for x in range(width))
+        count = sum(d1[x, y] for y in range(5) for x in range(width))
+        print(width, algorithm, same, count)
+
+# The same image in each colorspace dithers the same
+src = gradient(40, 8)
+swapped = displayio.Bitmap(40, 8, 65536)
+bgr = displayio.Bitmap(40, 8, 65536)
+l8 = displayio.Bitmap(40, 8, 256)
+for y in range(8):
+    for x in range(40):
+        p = src[x, y]
+        swapped[x, y] = (p >> 8) | (p & 0xFF) << 8
+        bgr[x, y] = (p >> 11) | (p & 0x7E0) | (p & 0x1F) << 11
+        g = (p >> 5) & 63
+        l8[x, y] = (g * 255 + 31) // 63
+expected = displayio.Bitmap(40, 8, 2)
+bitmaptools.dither(expected, src, Colorspace.RGB565)
+for b, colorspace in ((swapped, Colorspace.RGB565_SWAPPED), (bgr, Colorspace.BGR565)):
+    dst = displayio.Bitmap(40, 8, 2)
+    bitmaptools.dither(dst, b, colorspace)
+    print(colorspace, all(dst[x, y] == expected[x, y] for y in range(8) for x in range(40)))
+
+# A flat gray, ordered, sets the share of pixels the matrix says it should
+for level in (0, 64, 128, 200, 255):
+    gray = displayio.Bitmap(16, 16, 256)
+    gray.fill(level)
+    dst = displayio.Bitmap(16, 16, 2)
+    bitmaptools.dither(dst, gray, Colorspace.L8, DitherAlgorithm.Bayer)
+    print("L8", level, sum(dst[x, y] for y in range(16) for x in range(16)))
+dst = displayio.Bitmap(40, 8, 2)
+bitmaptools.dither(dst, l8, Colorspace.L8)
+print("L8 gradient", sum(dst[x, y] for y in range(8) for x in range(40)))
@@ -0,0 +1,43 @@
+import math
+import bitmaptools
+import displayio
+
+
+def show(b):
+    for y in range(b.height):
+        print("".join("%x" % b[x, y] for x in range(b.width)))
+    print()
+
+
+for depth in (2, 256, 65536):
+    print("depth", depth)
+    src = displayio.Bitmap(4, 3, depth)
+    for y in range(3):
+        for x in range(4):
+            src[x, y] = (x + y * 4) % min(depth, 16)
+
+    # Quarter turns about the middle. Rounding in the float stepping drops or shifts some edge
+    # rows and columns, and these check that it still does so the same way.
+    for quarter in range(4):
+        dst = displayio.Bitmap(6, 6, depth)
+        bitmaptools.rotozoom(dst, src, ox=3, oy=3, px=2, py=2, angle=quarter * math.pi / 2)
+        show(dst)
+
+    # Zoomed, with transparency and clipping on both sides
+    dst = displayio.Bitmap(10, 8, depth)
+    dst.fill(1)
+    bitmaptools.rotozoom(
+        dst, src, ox=5, oy=4, scale=2, skip_index=0, source_clip0=(0, 0), source_clip1=(3, 3)
+    )
+    show(dst)
+    dst.fill(0)
+    bitmaptools.rotozoom(
+        dst, src, ox=5, oy=4, scale=2.5, angle=0.3, dest_clip0=(2, 1), dest_clip1=(8, 7)
+    )
+    show(dst)
+
+# Nothing is drawn when the source lands outside the destination or the scale is 0
+dst = displayio.Bitmap(4, 4, 65536)
+bitmaptools.rotozoom(dst, src, ox=100, oy=-100)
+bitmaptools.rotozoom(dst, src, scale=0)
+show(dst)
@@ -0,0 +1,65 @@
+import os
+import displayio
+import gifio
+
+os.umount("/")
+
+
+class RAMBlockDevice:
+    ERASE_BLOCK_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.ERASE_BLOCK_SIZE)
+
+    def readblocks(self, block, buf, off=0):
+        addr = block * self.ERASE_BLOCK_SIZE + off
+        buf[:] = self.data[addr : addr + len(buf)]
+
+    def writeblocks(self, block, buf, off=None):
+        if off is None:
+            off = 0
+        addr = block * self.ERASE_BLOCK_SIZE + off
+        self.data[addr : addr + len(buf)] = buf
+
+    def ioctl(self, op, arg):
+        if op == 4:  # block count
+            return len(self.data) // self.ERASE_BLOCK_SIZE
+        if op == 5:  # block size
+            return self.ERASE_BLOCK_SIZE
+        if op == 6:  # erase block
+            return 0
+
+
+bdev = RAMBlockDevice(128)
+os.VfsFat.mkfs(bdev)
+os.mount(os.VfsFat(bdev), "/")
+
+# Four frames, each with its own delay, in a file several times the size of OnDiskGif's
+# read-ahead buffer
+w, h = 40, 30
+with gifio.GifWriter("/anim.gif", w, h, displayio.Colorspace.L8) as g:
+    for n in range(4):
+        b = bytearray(w * h)
+        for y in range(h):
+            for x in range(w):
+                b[y * w + x] = ((x * 7 + y * 13 + n * 64) * 5) & 0xFF
+        g.add_frame(b, 0.1 * (n + 1))
+print(os.stat("/anim.gif")[6] > 2048)
+
+
+def play(odg, count):
+    frames = []
+    for _ in range(count):
+        delay = odg.next_frame()
+        frames.append((round(delay, 3), bytes(memoryview(odg.bitmap))))
+    return frames
+
+
+# Playing past the last frame goes back to the first
+with gifio.OnDiskGif("/anim.gif") as odg:
+    print(odg.width, odg.height, odg.frame_count, odg.duration)
+    first = play(odg, odg.frame_count)
+    print([delay for delay, _ in first])
+    print(len(set(pixels for _, pixels in first)))
+    for _ in range(2):
+        print(play(odg, odg.frame_count) == first)
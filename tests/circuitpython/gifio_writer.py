@@ -0,0 +1,154 @@
+import array
+import io
+import displayio
+import gifio
+
+
+# A straightforward GIF decoder, to check what GifWriter produced
+def lzw_decode(data, min_code_size):
+    clear = 1 << min_code_size
+    end = clear + 1
+    pos = bits = nbits = 0
+    code_size = min_code_size + 1
+    table = None
+    prev = None
+    out = bytearray()
+    while True:
+        while nbits < code_size:
+            bits |= data[pos] << nbits
+            pos += 1
+            nbits += 8
+        code = bits & ((1 << code_size) - 1)
+        bits >>= code_size
+        nbits -= code_size
+        if code == clear:
+            table = [bytes([i]) for i in range(clear)] + [None, None]
+            code_size = min_code_size + 1
+            prev = None
+            continue
+        if code == end:
+            return out
+        if prev is None:
+            entry = table[code]
+        elif code < len(table):
+            entry = table[code]
+            table.append(prev + entry[:1])
+        else:
+            entry = prev + prev[:1]
+            table.append(entry)
+        out.extend(entry)
+        prev = entry
+        if len(table) == (1 << code_size) and code_size < 12:
+            code_size += 1
+
+
+def decode_frames(gif):
+    assert gif[:6] == b"GIF89a"
+    pos = 13 + 3 * 128
+    frames = []
+    while gif[pos] != 0x3B:
+        if gif[pos] == 0x21:
+            pos += 2
+            while gif[pos]:
+                pos += gif[pos] + 1
+            pos += 1
+            continue
+        assert gif[pos] == 0x2C
+        min_code_size = gif[pos + 10]
+        pos += 11
+        data = bytearray()
+        while gif[pos]:
+            data.extend(gif[pos + 1 : pos + 1 + gif[pos]])
+            pos += gif[pos] + 1
+        pos += 1
+        frames.append(lzw_decode(data, min_code_size))
+    return frames
+
+
+def write(width, height, colorspace, frames, dither=False):
+    f = io.BytesIO()
+    with gifio.GifWriter(f, width, height, colorspace, dither=dither) as g:
+        for frame in frames:
+            g.add_frame(frame)
+    return f.getvalue()
+
+
+def rgb565_index(pixel):
+    return ((pixel >> 14) & 0x3) << 5 | ((pixel >> 8) & 0x7) << 2 | ((pixel >> 3) & 0x3)
+
+
+def check(name, gif, expected):
+    frames = decode_frames(gif)
+    print(name, len(gif), [frame == bytes(e) for frame, e in zip(frames, expected)])
+
+
+# pseudo-random pixels, so that the dictionary fills up and is cleared
+def noise(n, seed):
+    for _ in range(n):
+        seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF
+        yield seed >> 16
+
+
+width, height = 96, 64
+
+l8_ramp = bytes((x * 4) & 0xFF for y in range(height) for x in range(width))
+l8_noise = bytes(v & 0xFF for v in noise(width * height, 1))
+gif = write(width, height, displayio.Colorspace.L8, [l8_ramp, l8_noise])
+check("L8", gif, [[p >> 1 for p in l8_ramp], [p >> 1 for p in l8_noise]])
+
+flat = array.array("H", [0x1234] * (width * height))
+check(
+    "RGB565 flat",
+    write(width, height, displayio.Colorspace.RGB565, [flat]),
+    [[rgb565_index(0x1234)] * (width * height)],
+)
+
+rgb_noise = array.array("H", noise(width * height, 2))
+check(
+    "RGB565 noise",
+    write(width, height, displayio.Colorspace.RGB565, [rgb_noise]),
+    [[rgb565_index(p) for p in rgb_noise]],
+)
+
+swapped = array.array("H", [((p & 0xFF) << 8) | (p >> 8) for p in rgb_noise])
+check(
+    "RGB565_SWAPPED noise",
+    write(width, height, displayio.Colorspace.RGB565_SWAPPED, [swapped]),
+    [[rgb565_index(p) for p in rgb_noise]],
+)
+
+rb_bayer = ((0, 33, 8, 42), (50, 16, 58, 25), (12, 46, 4, 37), (63, 29, 54, 21))
+g_bayer = ((0, 16, 4, 20), (24, 8, 28, 12), (6, 22, 2, 18), (31, 14, 26, 10))
+
+
+def dither_index(pixel, x, y):
+    red = max(0, ((pixel >> 8) & 0xF8) - rb_bayer[x % 4][y % 4])
+    green = max(0, ((pixel >> 3) & 0xFC) - g_bayer[x % 4][(y + 2) % 4])
+    blue = max(0, ((pixel << 3) & 0xF8) - rb_bayer[(x + 2) % 4][y % 4])
+    return ((red >> 1) & 0x60) | ((green >> 3) & 0x1C) | (blue >> 6)
+
+
+gradient = array.array(
+    "H",
+    [
+        (x * 31 // width) << 11 | y << 5 | (x * 31 // width)
+        for y in range(height)
+        for x in range(width)
+    ],
+)
+check(
+    "RGB565 dither",
+    write(width, height, displayio.Colorspace.RGB565, [gradient], dither=True),
+    [
+        [
+            dither_index(gradient[y * width + x], x, y)
+            for y in range(height)
+            for x in range(width)
+        ]
+    ],
+)
+
+try:
+    write(width, height, displayio.Colorspace.RGB565, [flat[:100]])
+except IndexError as e:
+    print(type(e).__name__)
@@ -0,0 +1,46 @@
+try:
+    import hashlib
+    import io
+
+    hashlib.file_digest
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+data = bytes(i * 7 & 0xFF for i in range(10000))
+
+for name in ("md5", "sha1", "sha224", "sha256", "sha384", "sha512"):
+    h = hashlib.new(name, data)
+    print(name, h.digest_size, h.digest().hex())
+    # A digest can be taken part way through and the hash continued
+    h = getattr(hashlib, name)()
+    h.update(memoryview(data)[:1234])
+    h.digest()
+    h.update(memoryview(data)[1234:])
+    print(name, h.digest() == hashlib.new(name, data).digest())
+    print(name, hashlib.file_digest(io.BytesIO(data), name).digest() == h.digest())
+
+
+# An object that is not a native stream, returning fewer bytes than asked for
+class Reader:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def readable(self):
+        return True
+
+    def readinto(self, buf):
+        n = min(len(buf), 300, len(self.data) - self.pos)
+        buf[:n] = self.data[self.pos : self.pos + n]
+        self.pos += n
+        return n
+
+
+print("readinto", hashlib.file_digest(Reader(data), "sha256").digest() == hashlib.sha256(data).digest())
+print("empty", hashlib.file_digest(io.BytesIO(b""), "sha1").digest().hex())
+
+try:
+    hashlib.file_digest(io.BytesIO(data), "nothing")
+except ValueError:
+    print("ValueError")
@@ -0,0 +1,104 @@
+# A JPEG with a restart marker every 3 MCUs, so that decoding can skip the intervals a crop
+# doesn't need. It is the image from jpegio_decompress.py with its entropy-coded data split into
+# restart intervals; the decoded pixels are the same.
+import binascii
+
+from displayio import Bitmap
+import jpegio
+
+content = binascii.a2b_base64(
+    b"""
+/9j/4AAQSkZJRgABAQAAAQABAAD/2wBDACEXGR0ZFSEdGx0lIyEoMlM2Mi4uMmZJTTxTeWp/fXdq
+dHKFlr+ihY21kHJ0puOotcbM1tjWgaDr/OnQ+r/S1s7/2wBDASMlJTIsMmI2NmLOiXSJzs7Ozs7O
+zs7Ozs7Ozs7Ozs7Ozs7Ozs7Ozs7Ozs7Ozs7Ozs7Ozs7Ozs7Ozs7Ozs7Ozs7/wAARCADwAPADASIA
+AhEBAxEB/8QAGgABAAMBAQEAAAAAAAAAAAAAAAIDBAEFBv/EACsQAAICAQMDAwMEAwAAAAAAAAAB
+AgMREiExBEFREyJhMkJSBTNxgRRikf/EABgBAQEBAQEAAAAAAAAAAAAAAAACAQME/8QAIxEBAQAC
+AgICAgMBAAAAAAAAAAECEQMSITFBURMiMmFxof/dAAQAA//aAAwDAQACEQMRAD8A8oAAAAAAAH//
+0PKAAAAAAdjFyexbGnyzZLW6f//R8oF/pRDpXYrpW6qgE5VNcbkCbNMAAB//0vKAAAAAAAB//9Py
+gAAAAAAAf//U8oAAAAAAAH//1fKAw32OqEn2A4djFyeETjS3zsWxiorYqY35bIRSisFtVNt7xVBy
++exGNfq2Qh5Z68+qq6KCrgksdy7b6hll1f/WjPoOqhHU4Jr4Mye7TWGuUz6OvqISpjNyTz4PN/WO
+njHTfBYy8P5LmV+WzJ55CcFJfJMHSza2RrDwwW3R+4qONmqiv//X8oAAAAAAAH//0PKAAAAAAAB/
+/9HygAAAAALkAD//0sa0pbYDnFPGSutRksPkk6lnJ1luvC1gALanRPRdGXhlfXuTuz2fB0Pfncmz
+aMsd2V//08HT2ThNNuWnwbuo66V9Cq9NYXdmYHXr40rpN7QjBr7iYBUmlI2LMGZjVL6WZTnmnJ//
+1PKAAAAAAAB//9XygAAAAAAAf//W8oAAAAAAAH//1/KLISm1tuVpZeC6x6IqEf7NnhWM+a6py/E7
+ql+Jny/LJKyS7lTI2vWp87HUsFKtl3LIWKX8lTKVsr//0MoAPQ6AAAjY8QZmL7niBQcs/aMn/9Hy
+gAAAAAAAf//S8oAAAAAAAH//0/KAAAAAAAB//9TzqI5lqfCITeqTZL1GoaV3IBVs1JAABIdi8NM4
+IrLQH//VyrgBcA7ugADRTe90iolY8zZE4ZXdRX//1vKAAAAAAAB//9fygAAAAAAAf//Q8oAAAAAA
+AH//0fKAAAAACymOZZ8FZtohpgvLNx9unHh3r//SyglPkid3XKaugjN4i2SKbpcIzK6iaqABxQ//
+0/KAAAAAAAB//9TygAAAAAAAf//V8oAAAAAAAH//1vKAAAAAW9PBTsWeEb0oGfp4aYZ7ssbwjpj4
+erHi1jven//XqvUcrHJUAehcmoGWb1SbL7ZYiZzlnfhmQACEv//Q8oAAAAAAAH//0fKAAAAAAAB/
+/9LygAAAAAAAf//T8oAACyit2WJeCs2dNHRDPdmz2vDC5Xwu0tdiNsWo5Jan5K52OW3Y6zTty3km
+pdaf/9TKAcbwsnd0U3SzLHgrDeW2DjbuudAAYP/V8oHVFvsNEvA0OAYwAAAA/9bygAAAAAAAf//X
+8oAAAAAAAH//0PKAW5Z6emOZGybEao65pG9LCwU9JFRi5NcmnMPBWM8PTxW4T+NVyeIlRoslDRju
+ZzpJpGXJc75mn//RyldzxHHksKZ++xLsdsvS6qCTfCNCriuxJJLhEdGdVMam+di2NcV2JAuYyN0/
+/9LKAEsnd0RlBSW6KLIOD34PRgo+njG5n6pLQiM5CY9plb40yA7pfg4c3N//0/KAAAAAAAB//9Ty
+gAAAAAAnCGr+BJsf/9XzqMK6OeC3qPdYoruQlVhZjyifTxdlrlJ8F6s8LkxntfFaYpHSWh+UdVbf
+crVeu8/HJ7Z5PLOHZLEmjhTzW78v/9bKRordkpSQm8QZb0jUaXusna+1Zb+EGmmThBzljgnlPujs
+WtS3Q275cWsbdq51uMscnFBls5LU90QdkF9yMuSsOPHrLlX/1+Yj6fBBJIrfUwUGllsqd05fTHB1
+uW3o47hx7/1p1xgm5PBllJ3T/wBUFW5PM3kmkkthq32jLK5W37dIygpLgkTrrc+CtbTbJN1//9Dy
+5RcXhnC/qoaWvJQbZqts1QAGMAAB/9HygAAAAA21U5gsGI9DpZ6obdkXh7VP43Xt/9LJb7E0yXTR
+xXnyc6rheWyyCxBI6W7r18WFmXlI5KTitmdI2J44Nnt05ddbtW9wAW8j/9PDc/acVW3LF3ZFqTwd
+dbq9bqv0n+THpP8AJl8K5T4INNPBvWHi3Sv0vLYVUSzBOVUlHI6wup7f/9TGoRXYkdw/BOqvU/cd
+3S/rNqwll4RZKvEmk9jsYqLyNrx48spuIOuS5RbUtLJWPgy23fbDnyZbqmOM/FvL3X//1cVz9W/H
+ZHHVE7COlfJM6zH7Xr7Z51OO63RA1me2Gl5XDJyx15jLEAAQl//W8oAAAAll4Asqrzu+CaU65aq3
+/RNLSkjp1mM0vU0//9fBKyU5xUljc2qSx9Jjn+5E1HSeK9PHhM93JPVH8Tk7FoxjkiQs7FSt5eHH
+rtAAFOL/0MNv1R/k1LhGW7hMKduPJ0vt6OPOYW7ba3jJB7szq+2P2oevZ+I23HPCZ3L7aCcm9CMn
+rz/EO+1rGkSmeeGVxv0//9GslD6kZPUufwcxa+ZYOk29efLMsbI0znFN5aKpdRFfSssr9Jd22SUU
+uEbq1H5ctajkp2XPfZHYwUSQNkcpH//SygA9DoHLIZplLwdFvtpfyTl6OtynhkABxc3/0/KAAAlW
+8WRfyRJKEsahBssTbyQw2TqmpwXkurwk9jtLt35MOuPbF//Uw27OL+TZGOYppoourzFtHaJaq18H
+Txt6cMc5lrel+h+UHWnHdkA84ZssXnx8mWOuyl8gAt53/9XHYswZyp5jjwTKf27Phna+LtdXAcgp
+oA01ygB//9bKAk3wgeh0ACTrko6sbBlsiIO4fgnXD3e7gxVl1vT/18pKCzJZ4LZwipbI4drdPTx8
+ffHdTmorDSMXVTy1FdjR1FqhBLuYG23lkZ1ymUx4+kAAQ5v/0PKAAA7qb7nABKE3B5Rrq6mGfdsY
+gbLpXa66v//Rpc4PPuRRVJQucc7Mzg3btea3X9PSwzhVR1TaUZ8l+v4Rc1XbHkzym5P+qnXJvKRA
+0qx+CiUXlsvccbjnu2zw/9LKRlFSWGSB3dFcJ+m9M1t5NNenKktylpNYZXiVTzGW3gnzFTKSas8N
+tqUmivQipdVl+9FkbYS4kZ2268Mw6SP/0+VYSawVuKb4Jwaw90RydbfD14YY98q5pXgtbzWV5Xk6
+7IqveSEreXHH9f8AXDq5RTLqILjcql1MvtWCdxWfLjJrb//UhY0nu8GazqEtof8ASiU5TeZPJEq5
+bdfy2YzGOtuTy3k4AS5AAA//1fKAAAAAAAB//9bygAAJwunDh7EAGy2emmPVeUS/yIfJkBu66zmz
+j//XyO6tkHdHsmUArtXS8lqx2t8bFbbfLAMttc9gAMH/0PLUmuGxrl5ZwA27qflnAAAAA//R8oAA
+AAAAAH//2Q==
+"""
+)
+
+decoder = jpegio.JpegDecoder()
+
+
+def checksum(b):
+    h = 0
+    for y in range(b.height):
+        for x in range(b.width):
+            h = (h * 31 + b[x, y]) & 0xFFFFFFF
+    return h
+
+
+def decode(scale, bits=16, **position_and_crop):
+    w, h = decoder.open(content)
+    b = Bitmap(w >> scale, h >> scale, 1 << bits)
+    b.fill(0)
+    decoder.decode(b, scale=scale, **position_and_crop)
+    return b
+
+
+def test_crop(scale, full, x=0, y=0, x1=0, y1=0, x2=None, y2=None):
+    w, h = full.width, full.height
+    x2 = w if x2 is None else x2
+    y2 = h if y2 is None else y2
+    b = decode(scale, x=x, y=y, x1=x1, y1=y1, x2=x2, y2=y2)
+    ok = True
+    for yy in range(h):
+        for xx in range(w):
+            sx = xx - x + x1
+            sy = yy - y + y1
+            inside = x1 <= sx < x2 and y1 <= sy < y2
+            if b[xx, yy] != (full[sx, sy] if inside else 0):
+                ok = False
+    print(f"scale={scale} x={x} y={y} x1={x1} y1={y1} x2={x2} y2={y2}", ok)
+
+
+for scale in range(4):
+    full = decode(scale)
+    print(f"scale={scale} {full.width}x{full.height}", hex(checksum(full)))
+    w, h = full.width, full.height
+    test_crop(scale, full, x1=w // 4, y1=h // 3, x2=w // 2, y2=h // 2)
+    test_crop(scale, full, x1=w - w // 5, y1=h - h // 5)
+    test_crop(scale, full, x=w // 7, y=h // 9, x1=w // 2, y1=h // 3)
+    test_crop(scale, full, x2=w // 5, y2=h // 6)
@@ -0,0 +1,35 @@
+import audiocore
+from synthio import BlockBiquad, FilterMode, Note, Synthesizer
+
+print(FilterMode.LOW_PASS, FilterMode.HIGH_PASS, FilterMode.BAND_PASS)
+
+f = BlockBiquad(FilterMode.LOW_PASS, 330)
+print(f.mode, f.frequency, f.Q)
+f.frequency = 440
+f.Q = 2
+print(f.mode, f.frequency, f.Q)
+
+try:
+    f.mode = FilterMode.HIGH_PASS
+except AttributeError:
+    print("mode is read-only")
+
+try:
+    BlockBiquad(0, 330)
+except TypeError as e:
+    print(e)
+
+
+# Jump the cutoff from 100Hz to 8kHz between blocks. The coefficients ramp across the next
+# block, so its first samples stay near the heavily filtered level; stepping straight to the
+# new coefficients would put the very first sample at about -10000.
+s = Synthesizer(sample_rate=48000)
+f = BlockBiquad(FilterMode.LOW_PASS, 100)
+s.press(Note(frequency=2000, filter=f))
+for _ in range(8):
+    before = audiocore.get_buffer(s)[1]
+f.frequency = 8000
+after = audiocore.get_buffer(s)[1]
+print("before", max(abs(v) for v in before) < 200)
+print("ramped", max(abs(v) for v in after[:8]) < 2000)
+print("reached", max(abs(v) for v in after[-24:]) > 15000)
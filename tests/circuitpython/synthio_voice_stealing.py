@@ -0,0 +1,72 @@
+import audiocore
+from synthio import Envelope, Note, Synthesizer, VoiceStealing
+
+print(VoiceStealing.NONE, VoiceStealing.OLDEST, VoiceStealing.QUIETEST, VoiceStealing.SAME_NOTE)
+
+s = Synthesizer(sample_rate=8000)
+print(s.polyphony == Synthesizer(sample_rate=8000, polyphony=None).polyphony == Synthesizer.max_polyphony)
+print(s.voice_stealing)
+
+try:
+    Synthesizer(polyphony=0)
+except ValueError as e:
+    print(e)
+
+try:
+    Synthesizer(voice_stealing=1)
+except TypeError as e:
+    print(e)
+
+
+def show(s):
+    print(sorted(n if isinstance(n, int) else round(n.frequency) for n in s.pressed))
+
+
+# a large pool
+s = Synthesizer(sample_rate=8000, polyphony=64)
+print(s.polyphony, s.max_polyphony == Synthesizer.max_polyphony)
+s.press(range(30, 94))
+show(s)
+audiocore.get_buffer(s)
+s.press(100)
+show(s)
+s.release_all()
+
+envelope = Envelope(attack_time=0.1, release_time=0.5)
+for policy in (VoiceStealing.NONE, VoiceStealing.OLDEST, VoiceStealing.QUIETEST):
+    s = Synthesizer(sample_rate=8000, polyphony=3, voice_stealing=policy, envelope=envelope)
+    print(s.voice_stealing)
+    s.press((60, 62))
+    audiocore.get_buffer(s)
+    audiocore.get_buffer(s)
+    s.press(64)
+    audiocore.get_buffer(s)
+    s.press(65)
+    show(s)
+    # a released note is always reused first
+    s.release(62)
+    s.press(67)
+    show(s)
+
+# the voice of a note at the same pitch is taken over, even with voices to spare
+s = Synthesizer(sample_rate=8000, polyphony=3, voice_stealing=VoiceStealing.SAME_NOTE)
+a = Note(frequency=440)
+b = Note(frequency=440)
+s.press((a, 60))
+s.press(b)
+print(s.note_info(a)[0], s.note_info(b)[0] is not None)
+show(s)
+s.press((62, 64))
+show(s)
+
+s.voice_stealing = VoiceStealing.OLDEST
+print(s.voice_stealing)
+
+# a note can be in two synthesizers at once
+s1 = Synthesizer(sample_rate=8000)
+s2 = Synthesizer(sample_rate=8000)
+s1.press((60, a))
+s2.press(a)
+s1.release(a)
+show(s1)
+show(s2)
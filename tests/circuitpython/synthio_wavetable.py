@@ -0,0 +1,71 @@
+import array
+import math
+import audiocore
+import synthio
+
+
+def dump_samples(s):
+    print([i for i in audiocore.get_buffer(s)[1][:24]])
+
+
+def peak(s):
+    buf = audiocore.get_buffer(s)[1]
+    return max(abs(i) for i in buf)
+
+
+square = array.array("h", [-32768, 32767])
+wt = synthio.Wavetable(square)
+print(wt.levels, len(memoryview(wt)), wt.waveform is square)
+
+# the first level is the square wave itself, less its highest harmonic
+print(list(memoryview(wt)[:8]), list(memoryview(wt)[124:132]))
+
+try:
+    synthio.Wavetable(array.array("b", [0, 1]))
+except ValueError as e:
+    print(e)
+
+# a low note, through the synthesizer's waveform
+s = synthio.Synthesizer(sample_rate=8000, waveform=wt)
+s.press(48)
+dump_samples(s)
+dump_samples(s)
+
+# just below nyquist, only the fundamental is left
+s = synthio.Synthesizer(sample_rate=8000)
+n = synthio.Note(3900, waveform=wt)
+s.press(n)
+dump_samples(s)
+
+# above nyquist, nothing is played
+n.frequency = 4100
+print(peak(s))
+
+# ring modulation by a wavetable
+n = synthio.Note(440, waveform=wt, ring_frequency=110, ring_waveform=wt)
+s = synthio.Synthesizer(sample_rate=8000)
+s.press(n)
+dump_samples(s)
+
+# elsewhere a wavetable acts like its first level
+lfo = synthio.LFO(waveform=wt)
+print(lfo.waveform is wt)
+
+# switching a note between a plain waveform and a wavetable keeps its pitch, so each block has
+# as many zero crossings as the others
+sine = array.array("h", [int(32767 * math.sin(i * 2 * math.pi / 64)) for i in range(64)])
+
+
+def crossings(s):
+    buf = audiocore.get_buffer(s)[1]
+    return sum((a < 0) != (b < 0) for a, b in zip(buf, buf[1:]))
+
+
+n = synthio.Note(440, waveform=sine)
+s = synthio.Synthesizer(sample_rate=8000)
+s.press(n)
+print(crossings(s), end=" ")
+n.waveform = synthio.Wavetable(sine)
+print(crossings(s), end=" ")
+n.waveform = sine
+print(crossings(s), crossings(s))
@@ -0,0 +1,59 @@
+import displayio
+import terminalio
+
+font = terminalio.FONT
+w, h = font.get_bounding_box()
+
+
+def grid(width, height=3, bitmap=font.bitmap):
+    return displayio.TileGrid(
+        bitmap,
+        pixel_shader=displayio.Palette(2),
+        width=width,
+        height=height,
+        tile_width=w,
+        tile_height=h,
+    )
+
+
+def show(g):
+    for y in range(g.height):
+        print([g[x, y] for x in range(g.width)])
+
+
+def glyph(c):
+    return font.get_glyph(ord(c)).tile_index
+
+
+print(glyph("A"), glyph("é"), glyph("ñ"), glyph("€"), font.get_glyph(ord("ж")))
+
+# Runs of ASCII wrap at the end of the row, and ESC [ K clears the rest of it
+scroll = grid(8)
+term = terminalio.Terminal(scroll, font)
+term.write(b"0123456789")
+term.write(b"\r\x1b[K")
+term.write(b"ab")
+show(scroll)
+
+# Other characters go through a cache. é and ñ share a slot, so they replace each other in it.
+# Characters missing from the font are skipped.
+scroll = grid(8)
+term = terminalio.Terminal(scroll, font)
+term.write("éñé€ñжé\r\n€a".encode())
+show(scroll)
+
+# The status bar skips control characters, like NUL, that have no glyph
+scroll = grid(8)
+bar = grid(8, 1)
+term = terminalio.Terminal(scroll, font, status_bar=bar)
+term.write("\x1b]0;a\x00é\x01b\x1b\\".encode())
+show(bar)
+
+# A glyph that isn't in the TileGrid's bitmap raises, and the tiles before it are kept
+scroll = grid(8, bitmap=displayio.Bitmap(w * 96, h, 2))
+term = terminalio.Terminal(scroll, font)
+try:
+    term.write("ab€".encode())
+except ValueError as e:
+    print("ValueError", e)
+show(scroll)
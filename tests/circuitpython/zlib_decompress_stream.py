@@ -0,0 +1,173 @@
+import binascii
+import zlib
+
+
+# A small DEFLATE encoder: fixed Huffman codes, with matches only against the data `distance`
+# bytes back, which is enough to make long streams whose matches reach across the window
+class Deflate:
+    LENGTHS = (3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258)
+    DISTANCES = (1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577)
+
+    def __init__(self):
+        self.out = bytearray()
+        self.acc = 0
+        self.nbits = 0
+
+    def bits(self, value, n):
+        self.acc |= value << self.nbits
+        self.nbits += n
+        while self.nbits >= 8:
+            self.out.append(self.acc & 0xFF)
+            self.acc >>= 8
+            self.nbits -= 8
+
+    def code(self, value, n):
+        # Huffman codes go most significant bit first
+        for i in range(n - 1, -1, -1):
+            self.bits((value >> i) & 1, 1)
+
+    def symbol(self, sym):
+        if sym < 144:
+            self.code(0x30 + sym, 8)
+        elif sym < 256:
+            self.code(0x190 + sym - 144, 9)
+        elif sym < 280:
+            self.code(sym - 256, 7)
+        else:
+            self.code(0xC0 + sym - 280, 8)
+
+    def match(self, length, distance):
+        i = len(self.LENGTHS) - 1
+        while self.LENGTHS[i] > length:
+            i -= 1
+        self.symbol(257 + i)
+        n = 0 if i == 28 else max(0, (i - 4) // 4)
+        self.bits(length - self.LENGTHS[i], n)
+        i = len(self.DISTANCES) - 1
+        while self.DISTANCES[i] > distance:
+            i -= 1
+        self.code(i, 5)
+        self.bits(distance - self.DISTANCES[i], max(0, (i - 2) // 2))
+
+    def compress(self, data, distance):
+        self.bits(1, 1)
+        self.bits(1, 2)
+        i = 0
+        while i < len(data):
+            n = 0
+            if i >= distance:
+                while i + n < len(data) and n < 258 and data[i + n] == data[i + n - distance]:
+                    n += 1
+            if n >= 3:
+                self.match(n, distance)
+                i += n
+            else:
+                self.symbol(data[i])
+                i += 1
+        self.symbol(256)
+        self.bits(0, 7)
+        return bytes(self.out)
+
+
+def adler32(data):
+    a, b = 1, 0
+    for c in data:
+        a = (a + c) % 65521
+        b = (b + a) % 65521
+    return b << 16 | a
+
+
+def zlib_stream(data, distance):
+    return b"\x78\x01" + Deflate().compress(data, distance) + adler32(data).to_bytes(4, "big")
+
+
+def gzip_stream(data, distance):
+    crc = binascii.crc32(data)
+    return (
+        b"\x1f\x8b\x08\x00\x00\x00\x00\x00\x00\xff"
+        + Deflate().compress(data, distance)
+        + crc.to_bytes(4, "little")
+        + len(data).to_bytes(4, "little")
+    )
+
+
+# Some noise, then a ramp, repeated so that matches reach back almost 32kB
+seed = 1
+unit = bytearray(30000)
+for i in range(300):
+    seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF
+    unit[i] = seed >> 16 & 0xFF
+for i in range(300, len(unit)):
+    unit[i] = i & 0xFF
+data = bytes(unit) * 3
+
+packed = zlib_stream(data, len(unit))
+print("packed", len(packed), "data", len(data))
+print("zlib", zlib.decompress(packed) == data)
+print("bufsize", zlib.decompress(packed, 15, len(data)) == data)
+print("small bufsize", zlib.decompress(packed, bufsize=10) == data)
+gz = gzip_stream(data, len(unit))
+print("gzip", zlib.decompress(gz, 31) == data)
+raw = packed[2:-4]
+print("raw", zlib.decompress(raw, -15) == data)
+
+buf = bytearray(len(data))
+print("into exact", zlib.decompress_into(packed, buf), buf == data)
+buf = bytearray(len(data) + 5)
+print("into larger", zlib.decompress_into(packed, buf), buf[: len(data)] == data)
+for size in (len(data) - 1, len(data) - 300, 10):
+    try:
+        zlib.decompress_into(packed, bytearray(size))
+    except ValueError as e:
+        print("into", size, repr(e))
+# A stored block that exactly fills the buffer
+stored = b"\x78\x01\x01\x05\x00\xfa\xffhello\x06\x2c\x02\x15"
+buf = bytearray(5)
+print("into stored", zlib.decompress_into(stored, buf), buf)
+try:
+    zlib.decompress_into(stored, bytearray(4))
+except ValueError as e:
+    print("into stored small", repr(e))
+
+# Streamed in pieces of various sizes
+for stream, wbits in ((packed, 0), (gz, 31), (raw, -15)):
+    for piece in (1, 7, 1000, 20000):
+        d = zlib.decompressobj(wbits)
+        out = bytearray()
+        for i in range(0, len(stream), piece):
+            out.extend(d.decompress(stream[i : i + piece]))
+        out.extend(d.flush())
+        print("stream", wbits, piece, out == data, d.eof, d.unused_data)
+
+# Data past the end of the stream
+d = zlib.Decompress()
+out = d.decompress(packed + b"tail")
+print("tail", out == data, d.eof, d.unused_data)
+d.decompress(b"more")
+print("more", d.unused_data)
+
+# At most max_length bytes at a time
+d = zlib.decompressobj()
+out = bytearray()
+chunk = d.decompress(packed, 5000)
+sizes = set()
+while chunk:
+    sizes.add(len(chunk))
+    out.extend(chunk)
+    chunk = d.decompress(b"", 5000)
+print("max_length", sorted(sizes), out == data, d.eof)
+
+# Not yet at the end
+d = zlib.decompressobj()
+out = d.decompress(packed[:100])
+print("partial", len(out) > 0, data.startswith(out), d.eof)
+
+# Errors
+for stream in (b"abc", b"\x78\x01\x07"):
+    d = zlib.decompressobj()
+    try:
+        d.decompress(stream)
+        d.flush()
+        print("no error", d.eof)
+    except ValueError as e:
+        print(repr(e))
@@ -12,3 +12,14 @@ with open(f"{loc}/data/qr.pgm", "rb") as f:
 decoder = qrio.QRDecoder(320, 240)
 for r in decoder.decode(content):
     print(r)
+
+# A subsampled search decodes from the region around the code at full resolution, and
+# tracking looks in that region first. Each combination finds the same code, on the first
+# call and on the next, and tracking goes back to searching everything once it is gone.
+for subsample in (1, 2):
+    for track in (False, True):
+        decoder = qrio.QRDecoder(320, 240)
+        for i in range(2):
+            print(subsample, track, decoder.decode(content, subsample=subsample, track=track))
+        print(decoder.decode(b"\xff" * (320 * 240), subsample=subsample, track=track))
+        print(decoder.decode(content, subsample=subsample, track=track) == decoder.decode(content))
@@ -0,0 +1,49 @@
+# Measure aesio throughput in each mode: ECB one block at a time, CBC encryption and decryption
+# and CTR in place on a 4kB buffer through memoryview slices. The result norm is in bytes
+# processed, so norm / time_us is MB per second.
+
+try:
+    import aesio
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+SIZE = 4096
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 10): (1,),
+    (100, 10): (2,),
+    (1000, 10): (16,),
+    (5000, 10): (64,),
+}
+
+
+def bm_setup(params):
+    (loops,) = params
+    key = bytes(range(16))
+    iv = bytes(range(16, 32))
+    buf = bytearray(i * 7 & 0xFF for i in range(SIZE))
+    view = memoryview(buf)
+    ecb = aesio.AES(key, aesio.MODE_ECB)
+
+    def run():
+        for _ in range(loops):
+            for i in range(0, 1024, 16):
+                block = view[i : i + 16]
+                ecb.encrypt_into(block, block)
+            cbc = aesio.AES(key, aesio.MODE_CBC, iv)
+            cbc.encrypt_into(buf, buf)
+            cbc.rekey(key, iv)
+            cbc.decrypt_into(buf, buf)
+            ctr = aesio.AES(key, aesio.MODE_CTR, iv)
+            for i in range(0, SIZE, 1024):
+                block = view[i : i + 1024]
+                ctr.encrypt_into(block, block)
+
+    def result():
+        return loops * (1024 + SIZE * 3), None
+
+    return run, result
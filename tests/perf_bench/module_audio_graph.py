@@ -0,0 +1,58 @@
+# Measure how fast an audiocore.Graph of 8 WaveFile sources, each through its own gain, renders
+# a mix of them through audiocore.render, the same work as module_audio_mixer. The sample file
+# comes from the manual audiocore tests, so run this from the tests directory. The result norm
+# is in output frames, so norm / time_us / 0.016 is the real-time headroom.
+
+try:
+    import audiocore
+
+    audiocore.Graph
+    audiocore.render
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+SAMPLE_FILE = "circuitpython-manual/audiocore/jeplayer-splash-16000-16bit-stereo-signed.wav"
+SAMPLE_RATE = 16000
+VOICES = 8
+
+
+def graph(voices):
+    g = audiocore.Graph(sample_rate=SAMPLE_RATE, channel_count=2, block_size=1024)
+    sources = [
+        g.gain(g.source(audiocore.WaveFile(SAMPLE_FILE), loop=True), 1 / voices)
+        for i in range(voices)
+    ]
+    g.output = g.mix(sources)
+    return g
+
+
+try:
+    graph(1)
+except OSError:
+    print("SKIP")
+    raise SystemExit
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 10): (SAMPLE_RATE * 2,),
+    (100, 10): (SAMPLE_RATE * 4,),
+    (1000, 10): (SAMPLE_RATE * 60,),
+    (5000, 10): (SAMPLE_RATE * 300,),
+}
+
+
+def bm_setup(params):
+    (frames,) = params
+    sample = graph(VOICES)
+
+    def run():
+        audiocore.render(sample, frames)
+
+    def result():
+        return frames, None
+
+    return run, result
@@ -0,0 +1,57 @@
+# Measure how fast an 8 voice audiomixer.Mixer renders WaveFiles through audiocore.render. The
+# sample file comes from the manual audiocore tests, so run this from the tests directory. The
+# result norm is in output frames, so norm / time_us / 0.016 is the real-time headroom.
+
+try:
+    import audiocore
+    import audiomixer
+
+    audiocore.render
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+SAMPLE_FILE = "circuitpython-manual/audiocore/jeplayer-splash-16000-16bit-stereo-signed.wav"
+SAMPLE_RATE = 16000
+VOICES = 8
+
+
+def graph(voices):
+    mixer = audiomixer.Mixer(
+        voice_count=voices, sample_rate=SAMPLE_RATE, channel_count=2, buffer_size=2048
+    )
+    for i in range(voices):
+        mixer.voice[i].level = 1 / voices
+        mixer.voice[i].play(audiocore.WaveFile(SAMPLE_FILE), loop=True)
+    return mixer
+
+
+try:
+    graph(1)
+except OSError:
+    print("SKIP")
+    raise SystemExit
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 10): (SAMPLE_RATE * 2,),
+    (100, 10): (SAMPLE_RATE * 4,),
+    (1000, 10): (SAMPLE_RATE * 60,),
+    (5000, 10): (SAMPLE_RATE * 300,),
+}
+
+
+def bm_setup(params):
+    (frames,) = params
+    sample = graph(VOICES)
+
+    def run():
+        audiocore.render(sample, frames)
+
+    def result():
+        return frames, None
+
+    return run, result
@@ -0,0 +1,53 @@
+# Measure how fast an 8 voice audiomixer.Mixer renders RawSamples whose format differs from the
+# mixer's, unsigned 8-bit mono into signed 16-bit stereo at the same rate, through
+# audiocore.render. The result norm is in output frames, so norm / time_us / 0.016 is the
+# real-time headroom.
+
+try:
+    import audiocore
+    import audiomixer
+
+    audiocore.render
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+SAMPLE_RATE = 16000
+VOICES = 8
+
+
+def graph(voices):
+    mixer = audiomixer.Mixer(
+        voice_count=voices, sample_rate=SAMPLE_RATE, channel_count=2, buffer_size=2048
+    )
+    # A bytes object is read in place, the way a sample in flash would be
+    data = bytes((i * 7 + (i >> 3) * 13) & 0xFF for i in range(4096))
+    for i in range(voices):
+        mixer.voice[i].level = 1 / voices
+        sample = audiocore.RawSample(data[i * 256 :], sample_rate=SAMPLE_RATE)
+        mixer.voice[i].play(sample, loop=True)
+    return mixer
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 10): (SAMPLE_RATE * 2,),
+    (100, 10): (SAMPLE_RATE * 4,),
+    (1000, 10): (SAMPLE_RATE * 60,),
+    (5000, 10): (SAMPLE_RATE * 300,),
+}
+
+
+def bm_setup(params):
+    (frames,) = params
+    sample = graph(VOICES)
+
+    def run():
+        audiocore.render(sample, frames)
+
+    def result():
+        return frames, None
+
+    return run, result
@@ -0,0 +1,53 @@
+# Measure how fast audiomp3 decodes a 44.1kHz stereo file through audiocore.render. The file
+# comes from the manual audiocore tests, so run this from the tests directory. The result norm
+# is in output frames, so norm / time_us / 0.0441 is the real-time headroom.
+
+try:
+    import audiocore
+    import audiomp3
+
+    audiocore.render
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+SAMPLE_FILE = "circuitpython-manual/audiocore/jeplayer-splash-44100-stereo.mp3"
+
+
+def graph():
+    return audiomp3.MP3Decoder(SAMPLE_FILE)
+
+
+try:
+    graph()
+except OSError:
+    print("SKIP")
+    raise SystemExit
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 10): (1,),
+    (100, 10): (2,),
+    (1000, 10): (10,),
+    (5000, 10): (50,),
+}
+
+
+def bm_setup(params):
+    (repeats,) = params
+    sample = graph()
+    total = 0
+
+    def run():
+        nonlocal total
+        for _ in range(repeats):
+            audiocore.reset_buffer(sample)
+            total += audiocore.render(sample, 1 << 30)[0]
+
+    def result():
+        return total, None
+
+    return run, result
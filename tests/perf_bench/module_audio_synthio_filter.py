@@ -0,0 +1,57 @@
+# Measure how fast synthio renders voices that each sweep a BlockBiquad filter from an LFO, so
+# the filter coefficients change every block. The result norm is in output frames, so
+# norm / time_us / 0.048 is the real-time headroom at 48kHz.
+
+try:
+    import audiocore
+    import synthio
+
+    audiocore.render
+    synthio.BlockBiquad
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+SAMPLE_RATE = 48000
+
+
+def graph(voices):
+    synth = synthio.Synthesizer(sample_rate=SAMPLE_RATE)
+    envelope = synthio.Envelope(attack_time=0.05, release_time=0.2, sustain_level=0.8)
+    notes = []
+    for i in range(voices):
+        frequency = synthio.midi_to_hz(48 + 5 * i)
+        sweep = synthio.LFO(rate=0.5 + i / 8, scale=frequency * 3, offset=frequency * 4)
+        notes.append(
+            synthio.Note(
+                frequency=frequency,
+                envelope=envelope,
+                filter=synthio.BlockBiquad(synthio.FilterMode.LOW_PASS, sweep, Q=1.5),
+            )
+        )
+    synth.press(notes)
+    return synth
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 10): (4, SAMPLE_RATE // 4),
+    (100, 10): (8, SAMPLE_RATE // 2),
+    (1000, 10): (12, SAMPLE_RATE * 2),
+    (5000, 10): (12, SAMPLE_RATE * 10),
+}
+
+
+def bm_setup(params):
+    voices, frames = params
+    sample = graph(voices)
+
+    def run():
+        audiocore.render(sample, frames)
+
+    def result():
+        return frames, None
+
+    return run, result
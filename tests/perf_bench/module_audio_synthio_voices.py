@@ -0,0 +1,67 @@
+# Measure how fast synthio renders a large voice pool where only some of the voices are
+# sounding, and notes are pressed past the pool size so voices get stolen. The result norm is
+# in output frames, so norm / time_us / 0.048 is the real-time headroom at 48kHz.
+
+try:
+    import audiocore
+    import synthio
+
+    audiocore.render
+    synthio.VoiceStealing
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+SAMPLE_RATE = 48000
+BLOCK = 256
+
+
+def graph(voices, sounding):
+    synth = synthio.Synthesizer(
+        sample_rate=SAMPLE_RATE,
+        polyphony=voices,
+        voice_stealing=synthio.VoiceStealing.OLDEST,
+    )
+    envelope = synthio.Envelope(attack_time=0.01, release_time=0.05, sustain_level=0.8)
+    notes = [
+        synthio.Note(frequency=synthio.midi_to_hz(24 + i % 72), envelope=envelope)
+        for i in range(sounding * 2)
+    ]
+    return synth, notes
+
+
+def test(synth, notes, frames):
+    # every block, release one note and press another, cycling through twice as many notes
+    # as are held so that presses find free, releasing and (once full) held voices
+    held = len(notes) // 2
+    synth.press(notes[:held])
+    i = 0
+    for _ in range(frames // BLOCK):
+        synth.release(notes[i % len(notes)])
+        synth.press(notes[(i + held) % len(notes)])
+        audiocore.render(synth, BLOCK)
+        i += 1
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 10): (16, 8, SAMPLE_RATE // 4),
+    (100, 10): (32, 16, SAMPLE_RATE // 2),
+    (1000, 10): (64, 24, SAMPLE_RATE * 2),
+    (5000, 10): (64, 24, SAMPLE_RATE * 10),
+}
+
+
+def bm_setup(params):
+    voices, sounding, frames = params
+    synth, notes = graph(voices, sounding)
+
+    def run():
+        test(synth, notes, frames)
+
+    def result():
+        return frames // BLOCK * BLOCK, None
+
+    return run, result
@@ -0,0 +1,52 @@
+# Measure how fast synthio renders a chord of sawtooth voices from a band-limited Wavetable,
+# which interpolates between samples. Set WAVETABLE to False to time the same chord played by
+# nearest-sample lookup in the plain waveform. The result norm is in output frames, so
+# norm / time_us / 0.048 is the real-time headroom at 48kHz.
+
+try:
+    import array
+    import audiocore
+    import synthio
+
+    audiocore.render
+    synthio.Wavetable
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+SAMPLE_RATE = 48000
+WAVETABLE = True
+
+
+def graph(voices):
+    waveform = array.array("h", [-32767 + 65534 * i // 256 for i in range(256)])
+    if WAVETABLE:
+        waveform = synthio.Wavetable(waveform)
+    synth = synthio.Synthesizer(sample_rate=SAMPLE_RATE, waveform=waveform)
+    # spread the voices over six octaves, so that they play different levels of the wavetable
+    synth.press([synthio.Note(synthio.midi_to_hz(36 + 72 * i // voices)) for i in range(voices)])
+    return synth
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 10): (4, SAMPLE_RATE // 4),
+    (100, 10): (8, SAMPLE_RATE // 2),
+    (1000, 10): (12, SAMPLE_RATE * 2),
+    (5000, 10): (12, SAMPLE_RATE * 10),
+}
+
+
+def bm_setup(params):
+    voices, frames = params
+    sample = graph(voices)
+
+    def run():
+        audiocore.render(sample, frames)
+
+    def result():
+        return frames, None
+
+    return run, result
@@ -0,0 +1,56 @@
+# Measure a camera-style bitmapfilter pipeline on a 320x240 RGB565 frame: a 3x3 gaussian blur
+# with morph, then a chain of mix, solarize and lookup. The result norm is in frames, so
+# 1e6 * norm / time_us is frames per second.
+
+try:
+    import displayio
+    import bitmapfilter
+
+    bitmapfilter.chain
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+WIDTH = 320
+HEIGHT = 240
+
+BLUR = (1, 2, 1, 2, 4, 2, 1, 2, 1)
+SEPIA = bitmapfilter.ChannelMixer(0.393, 0.769, 0.189, 0.349, 0.686, 0.168, 0.272, 0.534, 0.131)
+
+
+def gamma(x):
+    return x * x
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 10): (1,),
+    (100, 10): (2,),
+    (1000, 10): (10,),
+    (5000, 10): (40,),
+}
+
+
+def bm_setup(params):
+    (nframes,) = params
+    frame = displayio.Bitmap(WIDTH, HEIGHT, 65536)
+    for y in range(HEIGHT):
+        for x in range(WIDTH):
+            frame[x, y] = (x * 64 // WIDTH) << 5 | (y * 32 // HEIGHT) | ((x ^ y) & 31) << 11
+    filters = (
+        (bitmapfilter.mix, SEPIA),
+        (bitmapfilter.solarize, 0.75),
+        (bitmapfilter.lookup, gamma),
+    )
+
+    def run():
+        for _ in range(nframes):
+            bitmapfilter.morph(frame, BLUR)
+            bitmapfilter.chain(frame, filters)
+
+    def result():
+        return nframes, None
+
+    return run, result
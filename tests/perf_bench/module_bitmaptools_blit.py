@@ -0,0 +1,68 @@
+# Measure bitmaptools.blit throughput in pixels copied. This mirrors a sprite game's frame:
+# restore the background under each sprite, then draw the sprites with a transparent index.
+# Each frame also scrolls a 1-bit text layer, which blits that bitmap into itself.
+
+try:
+    import displayio
+    import bitmaptools
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+WIDTH = 160
+HEIGHT = 120
+SPRITE = 16
+SPRITES = 12
+
+
+def test(nframes, screen, background, sprites, text):
+    for frame in range(nframes):
+        for i in range(SPRITES):
+            x = (i * 37 + frame * 3) % (WIDTH - SPRITE)
+            y = (i * 23 + frame * 2) % (HEIGHT - SPRITE)
+            bitmaptools.blit(screen, background, x, y, x1=x, y1=y, x2=x + SPRITE, y2=y + SPRITE)
+            bitmaptools.blit(
+                screen, sprites, x, y, x1=i * SPRITE, y1=0, x2=(i + 1) * SPRITE, y2=SPRITE,
+                skip_source_index=0,
+            )
+        bitmaptools.blit(text, text, 0, 0, x1=1, y1=0, x2=WIDTH, y2=HEIGHT)
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 10): (2,),
+    (100, 10): (5,),
+    (1000, 10): (50,),
+    (5000, 10): (250,),
+}
+
+
+def bm_setup(params):
+    (nframes,) = params
+    screen = displayio.Bitmap(WIDTH, HEIGHT, 65536)
+    background = displayio.Bitmap(WIDTH, HEIGHT, 65536)
+    for y in range(HEIGHT):
+        for x in range(WIDTH):
+            background[x, y] = (x * 64 // WIDTH) << 5 | (y * 32 // HEIGHT)
+    sprites = displayio.Bitmap(SPRITE * SPRITES, SPRITE, 65536)
+    for y in range(SPRITE):
+        for x in range(SPRITE * SPRITES):
+            dx = x % SPRITE - SPRITE // 2
+            dy = y - SPRITE // 2
+            if dx * dx + dy * dy < SPRITE * SPRITE // 4:
+                sprites[x, y] = 0xF800 | x
+    text = displayio.Bitmap(WIDTH, HEIGHT, 2)
+    for y in range(HEIGHT):
+        for x in range(WIDTH):
+            text[x, y] = (x * 7 + y * 3) % 5 == 0
+
+    def run():
+        test(nframes, screen, background, sprites, text)
+
+    def result():
+        pixels = nframes * (SPRITES * 2 * SPRITE * SPRITE + (WIDTH - 1) * HEIGHT)
+        return pixels, None
+
+    return run, result
@@ -0,0 +1,55 @@
+# Measure bitmaptools.dither in pixels, for a photo-like RGB565 image reduced to a 1-bit bitmap
+# the way it would be for an e-paper display, with each of the algorithms in turn.
+
+try:
+    import displayio
+    import bitmaptools
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+WIDTH = 200
+HEIGHT = 120
+
+
+def test(niter, dest, source):
+    algorithms = (
+        bitmaptools.DitherAlgorithm.Atkinson,
+        bitmaptools.DitherAlgorithm.FloydStenberg,
+        bitmaptools.DitherAlgorithm.Bayer,
+    )
+    for _ in range(niter):
+        for algorithm in algorithms:
+            bitmaptools.dither(dest, source, displayio.Colorspace.RGB565, algorithm)
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 10): (1,),
+    (100, 10): (2,),
+    (1000, 10): (20,),
+    (5000, 10): (100,),
+}
+
+
+def bm_setup(params):
+    (niter,) = params
+    source = displayio.Bitmap(WIDTH, HEIGHT, 65536)
+    seed = 1
+    for y in range(HEIGHT):
+        for x in range(WIDTH):
+            # A smooth shading with a little noise, as a camera would give
+            seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF
+            g = ((x + y) * 63 // (WIDTH + HEIGHT) + (seed >> 28)) & 63
+            source[x, y] = (g >> 1) << 11 | g << 5 | (x * 31 // WIDTH)
+    dest = displayio.Bitmap(WIDTH, HEIGHT, 2)
+
+    def run():
+        test(niter, dest, source)
+
+    def result():
+        return niter * 3 * WIDTH * HEIGHT, None
+
+    return run, result
@@ -0,0 +1,59 @@
+# Measure bitmaptools.rotozoom in pixels drawn. Each frame of a gauge turns a 64x64 dial face
+# a little, zoomed so that it covers the whole 128x128 screen, and sweeps a needle with a
+# transparent index across it, the kind of thing a UI redraws every frame.
+
+try:
+    import displayio
+    import bitmaptools
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+SIZE = 64
+NEEDLE_W = 6
+NEEDLE_H = 48
+
+
+def test(nframes, screen, dial, needle):
+    for frame in range(nframes):
+        angle = frame * 0.05
+        bitmaptools.rotozoom(screen, dial, angle=-angle / 4, scale=3)
+        bitmaptools.rotozoom(
+            screen, needle, angle=angle, px=NEEDLE_W // 2, py=NEEDLE_H - 4, skip_index=0
+        )
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 10): (2,),
+    (100, 10): (5,),
+    (1000, 10): (50,),
+    (5000, 10): (250,),
+}
+
+
+def bm_setup(params):
+    (nframes,) = params
+    screen = displayio.Bitmap(SIZE * 2, SIZE * 2, 65536)
+    dial = displayio.Bitmap(SIZE, SIZE, 65536)
+    for y in range(SIZE):
+        for x in range(SIZE):
+            dx = x - SIZE // 2
+            dy = y - SIZE // 2
+            dial[x, y] = ((dx * dx + dy * dy) // 8 | (x * 7 + y) << 8) & 0xFFFF
+    needle = displayio.Bitmap(NEEDLE_W, NEEDLE_H, 65536)
+    for y in range(NEEDLE_H):
+        for x in range(1, NEEDLE_W - 1):
+            needle[x, y] = 0xF800
+
+    def run():
+        test(nframes, screen, dial, needle)
+
+    def result():
+        # The dial covers the whole screen, and the needle its own area
+        pixels = nframes * (SIZE * SIZE * 4 + NEEDLE_W * NEEDLE_H)
+        return pixels, None
+
+    return run, result
@@ -0,0 +1,66 @@
+# Measure pixel conversion throughput of displayio pixel shaders while refreshing a board's
+# built in display. The result norm is in pixels so norm / time_us gives megapixels per second.
+# Each frame redraws a full screen TileGrid through a ColorConverter and then a Palette.
+
+try:
+    import board
+    import displayio
+
+    display = board.DISPLAY
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+def test(nframes, grid, bitmap565, converter, bitmap8, palette):
+    for frame in range(nframes):
+        grid.bitmap = bitmap565
+        grid.pixel_shader = converter
+        display.refresh()
+        grid.bitmap = bitmap8
+        grid.pixel_shader = palette
+        display.refresh()
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 10): (1,),
+    (100, 10): (2,),
+    (1000, 10): (10,),
+    (5000, 10): (50,),
+}
+
+
+def bm_setup(params):
+    (nframes,) = params
+    width = display.width
+    height = display.height
+
+    bitmap565 = displayio.Bitmap(width, height, 65536)
+    bitmap8 = displayio.Bitmap(width, height, 256)
+    for y in range(height):
+        for x in range(width):
+            bitmap565[x, y] = (x * 64 // width) << 5 | (y * 32 // height)
+            bitmap8[x, y] = (x + y) & 0xFF
+    converter = displayio.ColorConverter(input_colorspace=displayio.Colorspace.RGB565)
+    palette = displayio.Palette(256)
+    for i in range(256):
+        palette[i] = i << 16 | (255 - i) << 8 | i
+
+    grid = displayio.TileGrid(bitmap565, pixel_shader=converter)
+    group = displayio.Group()
+    group.append(grid)
+    display.auto_refresh = False
+    display.root_group = group
+
+    def run():
+        test(nframes, grid, bitmap565, converter, bitmap8, palette)
+
+    def result():
+        display.root_group = displayio.CIRCUITPYTHON_TERMINAL
+        display.auto_refresh = True
+        return nframes * 2 * width * height, True
+
+    return run, result
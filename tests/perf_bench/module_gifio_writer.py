@@ -0,0 +1,65 @@
+# Measure how fast gifio.GifWriter compresses RGB565 frames that look like a screen capture:
+# flat panels, a gradient and a noisy, camera-like area. The result norm is in frames, so
+# norm / time_us * 1e6 is frames per second.
+
+try:
+    import array
+    import io
+    import displayio
+    import gifio
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+WIDTH = 160
+HEIGHT = 120
+
+
+def frame(seed):
+    pixels = array.array("H", [0x18E3] * (WIDTH * HEIGHT))
+    for y in range(HEIGHT):
+        row = y * WIDTH
+        # a title bar and a panel
+        if y < 16:
+            for x in range(WIDTH):
+                pixels[row + x] = 0x001F
+        elif 24 <= y < 72:
+            for x in range(8, 72):
+                pixels[row + x] = 0xFFFF
+        # a horizontal gradient
+        if 80 <= y < 96:
+            for x in range(WIDTH):
+                pixels[row + x] = (x * 32 // WIDTH) << 11
+        # camera-like noise
+        if y >= 24:
+            for x in range(88, 152):
+                seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF
+                pixels[row + x] = seed >> 15
+    return pixels
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 10): (1,),
+    (100, 10): (2,),
+    (1000, 10): (10,),
+    (5000, 10): (50,),
+}
+
+
+def bm_setup(params):
+    (frames,) = params
+    images = [frame(i) for i in range(4)]
+
+    def run():
+        f = io.BytesIO()
+        with gifio.GifWriter(f, WIDTH, HEIGHT, displayio.Colorspace.RGB565, dither=True) as g:
+            for i in range(frames):
+                g.add_frame(images[i % 4])
+
+    def result():
+        return frames, None
+
+    return run, result
@@ -0,0 +1,46 @@
+# Measure hashlib.file_digest with SHA-256 and SHA-1 on a 256kB file held in a BytesIO, and
+# hashlib's update on memoryview slices of the same data. The result norm is in hashed bytes,
+# so norm / time_us is MB per second.
+
+try:
+    import hashlib
+    import io
+
+    hashlib.file_digest
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+SIZE = 262144
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 10): (1,),
+    (100, 10): (2,),
+    (1000, 10): (10,),
+    (5000, 10): (40,),
+}
+
+
+def bm_setup(params):
+    (loops,) = params
+    data = bytes(i * 7 & 0xFF for i in range(SIZE))
+    view = memoryview(data)
+    f = io.BytesIO(data)
+
+    def run():
+        for _ in range(loops):
+            for name in ("sha256", "sha1"):
+                f.seek(0)
+                hashlib.file_digest(f, name).digest()
+            h = hashlib.sha256()
+            for i in range(0, SIZE, 4096):
+                h.update(view[i : i + 4096])
+            h.digest()
+
+    def result():
+        return loops * SIZE * 3, None
+
+    return run, result
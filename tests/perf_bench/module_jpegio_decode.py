@@ -0,0 +1,145 @@
+# Measure jpegio.JpegDecoder.decode of a 240x240 image into a 16-bit bitmap: the whole image,
+# a 1/8 scale thumbnail, and a 64x64 crop from the lower right, without and with restart
+# markers. The crop box is in image coordinates and has to fit in the bitmap, so the crop is
+# decoded into the corner of the full size bitmap. The result norm is in decoded images.
+
+try:
+    import binascii
+    from displayio import Bitmap
+    import jpegio
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+content = binascii.a2b_base64(
+    b"""
+/9j/4AAQSkZJRgABAQAAAQABAAD/2wBDACEXGR0ZFSEdGx0lIyEoMlM2Mi4uMmZJTTxTeWp/fXdq
+dHKFlr+ihY21kHJ0puOotcbM1tjWgaDr/OnQ+r/S1s7/2wBDASMlJTIsMmI2NmLOiXSJzs7Ozs7O
+zs7Ozs7Ozs7Ozs7Ozs7Ozs7Ozs7Ozs7Ozs7Ozs7Ozs7Ozs7Ozs7Ozs7Ozs7/wAARCADwAPADASIA
+AhEBAxEB/8QAGgABAAMBAQEAAAAAAAAAAAAAAAIDBAEFBv/EACsQAAICAQMDAwMEAwAAAAAAAAAB
+AgMREiExBEFREyJhMkJSBTNxgRRikf/EABgBAQEBAQEAAAAAAAAAAAAAAAACAQME/8QAIxEBAQAC
+AgICAgMBAAAAAAAAAAECEQMSITFBURMiMmFxof/aAAwDAQACEQMRAD8A8oAAAAAAAAAAAAAB2MXJ
+7FsafLNktbpSC/0oh0rsb0pqqATlU1xuQJs0wAAAAAAAAAAAAAAAAAAAAAAAAAAADDfY6oSfYDh2
+MXJ4RONLfOxbGKitipjflshFKKwW1U23vFUHL57EY1+rZCHlnrz6qrooKuCSx3LtvqGWXV58+g6q
+EdTgmvgzJ7tNYa5TPo6+ohKmM3JPPg839Y6eMdN8FjLw/kmZX5Jk88hOCkvkmDpZtbI1h4YLbo/c
+VHGzVRQAGMAAAAAAAAAAAAAAAAAAAC5AA0rSltgOcU8ZK61GSw+STqWcnWW68LWAAtqdE9F0ZeGV
+9e5O7PZ8HQ9+dybNoyx3ZVXT2ThNNuWnwbuo66V9Cq9NYXdmYGdfGm9JvaEYNfcTAKk0pGxZgzMa
+pfSzKc805AAISAAAAAAAAAAAAAAAAAAAAABZCU2ttytLLwXWPRFQj/Zs8KxnzXVOX4ndUvxM+X5Z
+JWSXcqZG161PnY6lgpVsu5ZCxS/kqZStlTABbQAARseIMzF9zxAoOWftGQACGAAAAAAAAAAAAAAA
+AAAAAACyiOZanwiE3qk2S9RqGldyAVbNSQAASHYvDTOCKy0BrXAC4B3dAAGim97pFRKx5myJwyu6
+igAMYAAAAAAAAAAAAAAAAAAAAAAAAAAAWUxzLPgrNtENMF5ZuPt048O9RBKfJE7NymroIzeItkim
+6XCMyuomqgAcUAAAAAAAAAAAAAAAAAAAAAAAAAAAAAC3p4KdizwjelAz9PDTDPdljeEdMfD1Y8Ws
+d70XqOVjkqAOjhJqBlm9Umy+2WImc5Z34ZkAAhIAAAAAAAAAAAAAAAAAAAAAAAAAABZRW7LEvBWb
+OmjohnuzZ7Xhhcr4XaWuxG2LUcktT8lc7HLbsdZp25byTUutIAHG8LJrkpulmWPBWG8tsHG3dc6A
+AwAdUW+w0S8DQ4BjAAAAAAAAAAAAAAAAAAAAAAtyz09McyNk2I1R1zSN6WFgp6SKjFya5NOYeCsZ
+4enitwn8ark8RKjRZKGjHcznSTSMuS53zNBXc8Rx5LCmfvsS7GZekVUEm+EaFXFdiSSXCI6M6qY1
+N87Fsa4rsSBcxkboACWTWoygpLdFFkHB78HowUfTxjcz9UloRGchMe0yt8aZAd0vwcObmAAAAAAA
+AAAAAAABOENX8CTY7RhXRzwW9R7rFFdyEqsLMeUT6eLstcpPgvVnhcmM9r4rTFI6S0Pyjqrb7lar
+13n45PbPJ5Zw7JYk0cKea3fkI0VuyUpITeIMt6RqNL3WTL7Rlv4QaaZOEHOWOCeU+6Oxa1LdDbvl
+xaxt2rnW4yxycUGWzktT3RB2QX3Iy5Kw48esuVW4j6fBBJIrfUwUGllsqd05fTHAuW0cdw49/wCt
+OuME3J4MspO6f+qCrcnmbyTSSWw1b7Rllcrb9ukZQUlwSJ11ufBWtptkm6xSi4vDOF/VQ0teSg42
+aqbNUABjAAAAAAAAA21U5gsGI9DpZ6obdkXh7VP43XtTb7E0yXTRxXnyc6rheWyyCxBI23deniws
+y8pHJScVszpGxPHBs9unLrrdq3uAC3kV3P2nFVtyxd2Rak8Ea3Wa3VfpP8mPSf5MvhXKfBBpp4N6
+w8W6V+l5bCqiWYJyqko5HWF1PapQiuxI7h+CdVep+41t/WbVhLLwiyVeJNJ7HYxUXkbXjx5ZTcQd
+clyi2paWSsfBltu+2HPky3VMcZ+LeXuo3P1b8dkcdUTsI6V8kzJj9uevtnnU47rdEDWZ7YaXlcMn
+LHXmMsQABCQAAAAll4Asqrzu+CaU65aq3/RNLSkjp1mM0vU0qlZKc4qSxubVJY+kxz/ciajJ4rtx
+4TPdyT1R/E5OxaMY5IkLOxUreXhx67QABTirt+qP8mpcIy3cJhTtx5Od9unHnMLdttbxkg92Z1fb
+H7UPXs/EbbjnhM7l9tBOTehGT15/iHfa1jSJTPPDK436aCUPqRk9S5/BzFr5lgTas+WZY2RpnOKb
+y0VS6iK+lZZX6S7tskopcI3VqPy5a1HJTsue+yOxgokgbI5SAAKaHLIZplLwdFvtpfyTl6Otynhk
+ABxcwAACVbxZF/JEkoSxqEGyxNvJDDZOqanBeS6vCT2O0u3fkw649sWK3ZxfybIxzFNNFF1eYto7
+RLVWvgnxtWGOcy1vS/Q/KDrTjuyAecM2WLz4+TLHXZS+QAW86NizBnKnmOPBMp/bs+GTfF2yrgOQ
+U0Aaa5QAAJN8IAACTrko6sbBlsiIO4fgnXD3e7gxVl1vSslBZks8Fs4RUtkcMt06cfH3x3U5qKw0
+jF1U8tRXY0dRaoQS7mBtt5ZGdcplMePpAAEOYAAB3U33OACUJuDyjXV1MM+7YxA2XSu111b3ODz7
+kUVSULnHOzM4G3S81uv6elhnCqjqm0oz5L9fwi5qu2PJnlNyf9VOuTeUiBpVj8FEovLZe443HPdt
+nhEjKKksMkAlXCfpvTNbeTTXpypLcpaTWGV4lU8xlt4J8xUykmrPDbalJor0IqXVZfvRZG2EuJGd
+tuvDMOki6rCTWCtxTfBODWHuiOTbfBhhj3yrmleC1vNZXleTrsiq95ISt5ccf1/1w6uUUy6iC43K
+pdTL7VgncVny4ya212NJ7vBms6hLaH/SiU5TeZPJEy5beb8tmMxjrbk8t5OAEuQAAAAAAAAAAAAA
+E4XThw9iADZbPTTHqvKJf5EPkyA3ddZzZxqd1bIO6PZMoBvapvJasdrfGxW23ywDLbXPYADB1Sa4
+bGuXlnADbup+WcAAAAAAAAAAAAD/2Q=="""
+)
+
+restart_content = binascii.a2b_base64(
+    b"""
+/9j/4AAQSkZJRgABAQAAAQABAAD/2wBDACEXGR0ZFSEdGx0lIyEoMlM2Mi4uMmZJTTxTeWp/fXdq
+dHKFlr+ihY21kHJ0puOotcbM1tjWgaDr/OnQ+r/S1s7/2wBDASMlJTIsMmI2NmLOiXSJzs7Ozs7O
+zs7Ozs7Ozs7Ozs7Ozs7Ozs7Ozs7Ozs7Ozs7Ozs7Ozs7Ozs7Ozs7Ozs7Ozs7/wAARCADwAPADASIA
+AhEBAxEB/8QAGgABAAMBAQEAAAAAAAAAAAAAAAIDBAEFBv/EACsQAAICAQMDAwMEAwAAAAAAAAAB
+AgMREiExBEFREyJhMkJSBTNxgRRikf/EABgBAQEBAQEAAAAAAAAAAAAAAAACAQME/8QAIxEBAQAC
+AgICAgMBAAAAAAAAAAECEQMSITFBURMiMmFxof/dAAQAA//aAAwDAQACEQMRAD8A8oAAAAAAAH//
+0PKAAAAAAdjFyexbGnyzZLW6f//R8oF/pRDpXYrpW6qgE5VNcbkCbNMAAB//0vKAAAAAAAB//9Py
+gAAAAAAAf//U8oAAAAAAAH//1fKAw32OqEn2A4djFyeETjS3zsWxiorYqY35bIRSisFtVNt7xVBy
++exGNfq2Qh5Z68+qq6KCrgksdy7b6hll1f/WjPoOqhHU4Jr4Mye7TWGuUz6OvqISpjNyTz4PN/WO
+njHTfBYy8P5LmV+WzJ55CcFJfJMHSza2RrDwwW3R+4qONmqiv//X8oAAAAAAAH//0PKAAAAAAAB/
+/9HygAAAAALkAD//0sa0pbYDnFPGSutRksPkk6lnJ1luvC1gALanRPRdGXhlfXuTuz2fB0Pfncmz
+aMsd2V//08HT2ThNNuWnwbuo66V9Cq9NYXdmYHXr40rpN7QjBr7iYBUmlI2LMGZjVL6WZTnmnJ//
+1PKAAAAAAAB//9XygAAAAAAAf//W8oAAAAAAAH//1/KLISm1tuVpZeC6x6IqEf7NnhWM+a6py/E7
+ql+Jny/LJKyS7lTI2vWp87HUsFKtl3LIWKX8lTKVsr//0MoAPQ6AAAjY8QZmL7niBQcs/aMn/9Hy
+gAAAAAAAf//S8oAAAAAAAH//0/KAAAAAAAB//9TzqI5lqfCITeqTZL1GoaV3IBVs1JAABIdi8NM4
+IrLQH//VyrgBcA7ugADRTe90iolY8zZE4ZXdRX//1vKAAAAAAAB//9fygAAAAAAAf//Q8oAAAAAA
+AH//0fKAAAAACymOZZ8FZtohpgvLNx9unHh3r//SyglPkid3XKaugjN4i2SKbpcIzK6iaqABxQ//
+0/KAAAAAAAB//9TygAAAAAAAf//V8oAAAAAAAH//1vKAAAAAW9PBTsWeEb0oGfp4aYZ7ssbwjpj4
+erHi1jven//XqvUcrHJUAehcmoGWb1SbL7ZYiZzlnfhmQACEv//Q8oAAAAAAAH//0fKAAAAAAAB/
+/9LygAAAAAAAf//T8oAACyit2WJeCs2dNHRDPdmz2vDC5Xwu0tdiNsWo5Jan5K52OW3Y6zTty3km
+pdaf/9TKAcbwsnd0U3SzLHgrDeW2DjbuudAAYP/V8oHVFvsNEvA0OAYwAAAA/9bygAAAAAAAf//X
+8oAAAAAAAH//0PKAW5Z6emOZGybEao65pG9LCwU9JFRi5NcmnMPBWM8PTxW4T+NVyeIlRoslDRju
+ZzpJpGXJc75mn//RyldzxHHksKZ++xLsdsvS6qCTfCNCriuxJJLhEdGdVMam+di2NcV2JAuYyN0/
+/9LKAEsnd0RlBSW6KLIOD34PRgo+njG5n6pLQiM5CY9plb40yA7pfg4c3N//0/KAAAAAAAB//9Ty
+gAAAAAAnCGr+BJsf/9XzqMK6OeC3qPdYoruQlVhZjyifTxdlrlJ8F6s8LkxntfFaYpHSWh+UdVbf
+crVeu8/HJ7Z5PLOHZLEmjhTzW78v/9bKRordkpSQm8QZb0jUaXusna+1Zb+EGmmThBzljgnlPujs
+WtS3Q275cWsbdq51uMscnFBls5LU90QdkF9yMuSsOPHrLlX/1+Yj6fBBJIrfUwUGllsqd05fTHB1
+uW3o47hx7/1p1xgm5PBllJ3T/wBUFW5PM3kmkkthq32jLK5W37dIygpLgkTrrc+CtbTbJN1//9Dy
+5RcXhnC/qoaWvJQbZqts1QAGMAAB/9HygAAAAA21U5gsGI9DpZ6obdkXh7VP43Xt/9LJb7E0yXTR
+xXnyc6rheWyyCxBI6W7r18WFmXlI5KTitmdI2J44Nnt05ddbtW9wAW8j/9PDc/acVW3LF3ZFqTwd
+dbq9bqv0n+THpP8AJl8K5T4INNPBvWHi3Sv0vLYVUSzBOVUlHI6wup7f/9TGoRXYkdw/BOqvU/cd
+3S/rNqwll4RZKvEmk9jsYqLyNrx48spuIOuS5RbUtLJWPgy23fbDnyZbqmOM/FvL3X//1cVz9W/H
+ZHHVE7COlfJM6zH7Xr7Z51OO63RA1me2Gl5XDJyx15jLEAAQl//W8oAAAAll4Asqrzu+CaU65aq3
+/RNLSkjp1mM0vU0//9fBKyU5xUljc2qSx9Jjn+5E1HSeK9PHhM93JPVH8Tk7FoxjkiQs7FSt5eHH
+rtAAFOL/0MNv1R/k1LhGW7hMKduPJ0vt6OPOYW7ba3jJB7szq+2P2oevZ+I23HPCZ3L7aCcm9CMn
+rz/EO+1rGkSmeeGVxv0//9GslD6kZPUufwcxa+ZYOk29efLMsbI0znFN5aKpdRFfSssr9Jd22SUU
+uEbq1H5ctajkp2XPfZHYwUSQNkcpH//SygA9DoHLIZplLwdFvtpfyTl6OtynhkABxc3/0/KAAAlW
+8WRfyRJKEsahBssTbyQw2TqmpwXkurwk9jtLt35MOuPbF//Uw27OL+TZGOYppoourzFtHaJaq18H
+Txt6cMc5lrel+h+UHWnHdkA84ZssXnx8mWOuyl8gAt53/9XHYswZyp5jjwTKf27Phna+LtdXAcgp
+oA01ygB//9bKAk3wgeh0ACTrko6sbBlsiIO4fgnXD3e7gxVl1vT/18pKCzJZ4LZwipbI4drdPTx8
+ffHdTmorDSMXVTy1FdjR1FqhBLuYG23lkZ1ymUx4+kAAQ5v/0PKAAA7qb7nABKE3B5Rrq6mGfdsY
+gbLpXa66v//Rpc4PPuRRVJQucc7Mzg3btea3X9PSwzhVR1TaUZ8l+v4Rc1XbHkzym5P+qnXJvKRA
+0qx+CiUXlsvccbjnu2zw/9LKRlFSWGSB3dFcJ+m9M1t5NNenKktylpNYZXiVTzGW3gnzFTKSas8N
+tqUmivQipdVl+9FkbYS4kZ2268Mw6SP/0+VYSawVuKb4Jwaw90RydbfD14YY98q5pXgtbzWV5Xk6
+7IqveSEreXHH9f8AXDq5RTLqILjcql1MvtWCdxWfLjJrb//UhY0nu8GazqEtof8ASiU5TeZPJEq5
+bdfy2YzGOtuTy3k4AS5AAA//1fKAAAAAAAB//9bygAAJwunDh7EAGy2emmPVeUS/yIfJkBu66zmz
+j//XyO6tkHdHsmUArtXS8lqx2t8bFbbfLAMttc9gAMH/0PLUmuGxrl5ZwA27qflnAAAAA//R8oAA
+AAAAAH//2Q==
+"""
+)
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 10): (1,),
+    (100, 10): (2,),
+    (1000, 10): (10,),
+    (5000, 10): (50,),
+}
+
+
+def bm_setup(params):
+    (loops,) = params
+    decoder = jpegio.JpegDecoder()
+    full = Bitmap(240, 240, 65536)
+    thumbnail = Bitmap(30, 30, 65536)
+
+    def run():
+        for _ in range(loops):
+            for jpeg in (content, restart_content):
+                decoder.open(jpeg)
+                decoder.decode(full)
+                decoder.open(jpeg)
+                decoder.decode(thumbnail, scale=3)
+                decoder.open(jpeg)
+                decoder.decode(full, x1=160, y1=160, x2=224, y2=224)
+
+    def result():
+        return loops * 6, None
+
+    return run, result
@@ -0,0 +1,88 @@
+# Measure qrio.QRDecoder.find in scans of a 320x240 byte-swapped RGB565 camera frame holding
+# one QR code with 5 pixel squares, which drifts a little from frame to frame. Every frame is
+# scanned at full resolution, subsampled by 2 and by 4, and subsampled by 2 while tracking the
+# code. The result norm is in scans.
+
+try:
+    import qrio
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+WIDTH = 320
+HEIGHT = 240
+MODULES = 25
+MODULE_SIZE = 5
+WHITE = b"\xff\xff"
+BLACK = b"\x00\x00"
+GREY = b"\xc6\x18"
+
+
+def make_modules():
+    # Three finder patterns, and pseudo-random squares for everything else
+    modules = []
+    seed = 1
+    for y in range(MODULES):
+        row = []
+        for x in range(MODULES):
+            seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF
+            row.append(seed >> 16 & 1)
+        modules.append(row)
+    for fx, fy in ((0, 0), (MODULES - 7, 0), (0, MODULES - 7)):
+        for y in range(-1, 8):
+            for x in range(-1, 8):
+                if 0 <= fx + x < MODULES and 0 <= fy + y < MODULES:
+                    ring = max(abs(x - 3), abs(y - 3))
+                    modules[fy + y][fx + x] = ring != 2 and ring != 4
+    return modules
+
+
+def make_frame(modules, left, top):
+    frame = bytearray(GREY * (WIDTH * HEIGHT))
+    quiet = 4 * MODULE_SIZE
+    size = MODULES * MODULE_SIZE
+    for y in range(top - quiet, top + size + quiet):
+        start = (y * WIDTH + left - quiet) * 2
+        frame[start : start + (size + 2 * quiet) * 2] = WHITE * (size + 2 * quiet)
+    for my in range(MODULES):
+        row = b"".join((BLACK if m else WHITE) * MODULE_SIZE for m in modules[my])
+        for y in range(top + my * MODULE_SIZE, top + (my + 1) * MODULE_SIZE):
+            start = (y * WIDTH + left) * 2
+            frame[start : start + size * 2] = row
+    return frame
+
+
+def test(nscans, decoder, frames):
+    policy = qrio.PixelPolicy.RGB565_SWAPPED
+    for i in range(nscans // 4):
+        frame = frames[i % len(frames)]
+        decoder.find(frame, policy)
+        decoder.find(frame, policy, subsample=2)
+        decoder.find(frame, policy, subsample=4)
+        decoder.find(frame, policy, subsample=2, track=True)
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 10): (4,),
+    (100, 10): (8,),
+    (1000, 10): (40,),
+    (5000, 10): (200,),
+}
+
+
+def bm_setup(params):
+    (nscans,) = params
+    decoder = qrio.QRDecoder(WIDTH, HEIGHT)
+    modules = make_modules()
+    frames = [make_frame(modules, 90 + i * 3, 50 + i * 2) for i in range(4)]
+
+    def run():
+        test(nscans, decoder, frames)
+
+    def result():
+        return nscans, None
+
+    return run, result
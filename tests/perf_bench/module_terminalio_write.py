@@ -0,0 +1,55 @@
+# Measure terminalio.Terminal write throughput in characters per second. This is the
+# path taken by REPL and log output to an on-screen console.
+
+try:
+    import displayio
+    import terminalio
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+LINE = b"Traceback (most recent call last): line 42, in <module> 0123456789\r\n"
+CLEAR_LINE = b"\x1b[K"
+
+
+def test(nloop, term):
+    for _ in range(nloop):
+        for _ in range(8):
+            term.write(LINE)
+        term.write(b"status: ok")
+        term.write(CLEAR_LINE)
+        term.write(b"\r\n")
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 10): (10,),
+    (100, 10): (20,),
+    (1000, 10): (200,),
+    (5000, 10): (1000,),
+}
+
+
+def bm_setup(params):
+    (nloop,) = params
+    font = terminalio.FONT
+    width, height = font.get_bounding_box()
+    grid = displayio.TileGrid(
+        font.bitmap,
+        pixel_shader=displayio.Palette(2),
+        width=80,
+        height=24,
+        tile_width=width,
+        tile_height=height,
+    )
+    term = terminalio.Terminal(grid, font)
+
+    def run():
+        test(nloop, term)
+
+    def result():
+        return nloop * (8 * len(LINE) + 10 + len(CLEAR_LINE) + 2), True
+
+    return run, result
@@ -0,0 +1,66 @@
+# Measure how fast a board's built in display redraws a rotating vectorio.Polygon, like a
+# gauge needle or chart. The shape is recomputed and fully redrawn on every refresh.
+
+try:
+    import math
+    import board
+    import displayio
+    import vectorio
+
+    display = board.DISPLAY
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+def star(npoints, radius, angle):
+    points = []
+    for i in range(npoints):
+        a = angle + 2 * math.pi * i / npoints
+        r = radius if i % 2 else radius // 2
+        points.append((int(r * math.cos(a)), int(r * math.sin(a))))
+    return points
+
+
+def test(nframes, npoints, polygon):
+    radius = min(display.width, display.height) // 2 - 1
+    for frame in range(nframes):
+        polygon.points = star(npoints, radius, frame / 8)
+        display.refresh()
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 10): (2, 20),
+    (100, 10): (4, 50),
+    (1000, 10): (20, 100),
+    (5000, 10): (100, 100),
+}
+
+
+def bm_setup(params):
+    nframes, npoints = params
+    palette = displayio.Palette(1)
+    palette[0] = 0xFF8000
+    polygon = vectorio.Polygon(
+        pixel_shader=palette,
+        points=star(npoints, 10, 0),
+        x=display.width // 2,
+        y=display.height // 2,
+    )
+    group = displayio.Group()
+    group.append(polygon)
+    display.auto_refresh = False
+    display.root_group = group
+
+    def run():
+        test(nframes, npoints, polygon)
+
+    def result():
+        display.root_group = displayio.CIRCUITPYTHON_TERMINAL
+        display.auto_refresh = True
+        return nframes, True
+
+    return run, result
@@ -0,0 +1,137 @@
+# Measure zlib.decompress, zlib.decompress_into and streaming with zlib.decompressobj on
+# image-like data in three sizes: 1kB, 16kB and 200kB once decompressed. The result norm is in
+# decompressed bytes, so norm / time_us is MB per second.
+
+try:
+    import zlib
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+
+# A small DEFLATE encoder: fixed Huffman codes, with matches only against the data `distance`
+# bytes back
+class Deflate:
+    LENGTHS = (3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258)
+    DISTANCES = (1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577)
+
+    def __init__(self):
+        self.out = bytearray()
+        self.acc = 0
+        self.nbits = 0
+
+    def bits(self, value, n):
+        self.acc |= value << self.nbits
+        self.nbits += n
+        while self.nbits >= 8:
+            self.out.append(self.acc & 0xFF)
+            self.acc >>= 8
+            self.nbits -= 8
+
+    def code(self, value, n):
+        # Huffman codes go most significant bit first
+        for i in range(n - 1, -1, -1):
+            self.bits((value >> i) & 1, 1)
+
+    def symbol(self, sym):
+        if sym < 144:
+            self.code(0x30 + sym, 8)
+        elif sym < 256:
+            self.code(0x190 + sym - 144, 9)
+        elif sym < 280:
+            self.code(sym - 256, 7)
+        else:
+            self.code(0xC0 + sym - 280, 8)
+
+    def match(self, length, distance):
+        i = len(self.LENGTHS) - 1
+        while self.LENGTHS[i] > length:
+            i -= 1
+        self.symbol(257 + i)
+        n = 0 if i == 28 else max(0, (i - 4) // 4)
+        self.bits(length - self.LENGTHS[i], n)
+        i = len(self.DISTANCES) - 1
+        while self.DISTANCES[i] > distance:
+            i -= 1
+        self.code(i, 5)
+        self.bits(distance - self.DISTANCES[i], max(0, (i - 2) // 2))
+
+    def compress(self, data, distance):
+        self.bits(1, 1)
+        self.bits(1, 2)
+        i = 0
+        while i < len(data):
+            n = 0
+            if i >= distance:
+                while i + n < len(data) and n < 258 and data[i + n] == data[i + n - distance]:
+                    n += 1
+            if n >= 3:
+                self.match(n, distance)
+                i += n
+            else:
+                self.symbol(data[i])
+                i += 1
+        self.symbol(256)
+        self.bits(0, 7)
+        return bytes(self.out)
+
+
+def adler32(data):
+    a, b = 1, 0
+    for c in data:
+        a = (a + c) % 65521
+        b = (b + a) % 65521
+    return b << 16 | a
+
+
+def zlib_stream(data, distance):
+    return b"\x78\x01" + Deflate().compress(data, distance) + adler32(data).to_bytes(4, "big")
+
+
+
+# Rows of 256 bytes: mostly the row above, with a few noisy bytes changed in each
+def image(size):
+    seed = size
+    data = bytearray(size)
+    for i in range(size):
+        if i < 256:
+            data[i] = i
+        else:
+            data[i] = data[i - 256]
+            seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF
+            if seed >> 16 & 15 == 0:
+                data[i] = seed >> 8 & 0xFF
+    return bytes(data)
+
+
+SIZES = (1024, 16384, 204800)
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 10): (1,),
+    (100, 10): (2,),
+    (1000, 10): (10,),
+    (5000, 10): (50,),
+}
+
+
+def bm_setup(params):
+    (loops,) = params
+    streams = [zlib_stream(image(size), 256) for size in SIZES]
+    buffers = [bytearray(size) for size in SIZES]
+
+    def run():
+        for _ in range(loops):
+            for stream, buffer in zip(streams, buffers):
+                zlib.decompress(stream)
+                zlib.decompress_into(stream, buffer)
+                d = zlib.decompressobj()
+                for i in range(0, len(stream), 512):
+                    d.decompress(stream[i : i + 512])
+
+    def result():
+        return loops * sum(SIZES) * 3, None
+
+    return run, result